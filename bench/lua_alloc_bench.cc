@@ -0,0 +1,243 @@
+#include <algorithm>
+#include <chrono>
+#include <unordered_map>
+#include <vector>
+
+#include "common.h"
+#include "lua_alloc.h"
+
+#include <lua.hpp>
+
+/*
+ * compares lua_pool_alloc against plain realloc on a trigger-ish workload:
+ * formatting, stripping escape codes, matching and capturing every line,
+ * with a window of recent lines kept alive. the collector is stopped and
+ * stepped after each batch of lines the same way script.cc does it, so the
+ * step times are the GC pauses you'd see in the client
+ *
+ * it also records the workload's allocations and replays them against
+ * both allocators without running any Lua, which isolates allocator time
+ */
+
+static constexpr int LINES = 400000;
+static constexpr int LINES_PER_BATCH = 100;
+static constexpr int GC_STEP_KB = 64;
+static constexpr int RUNS = 3;
+
+static const char workload[] = R"lua(
+local recent = { }
+local names = { "Bob", "Alice", "a goblin", "the orc", "Gandalf" }
+
+local function line( i )
+	local who = names[ i % #names + 1 ]
+	local text
+	if i % 3 == 0 then
+		text = string.format( "\27[1;31m%s hits you for %d damage!\27[0m", who, i % 97 )
+	elseif i % 3 == 1 then
+		text = string.format( "%s tells you '%s'", who, string.rep( "la", i % 20 ) )
+	else
+		text = string.format( "HP: %d/%d SP: %d/%d > ", i % 500, 500, i % 300, 300 )
+	end
+
+	local clean = text:gsub( "\27%[[%d;]*m", "" )
+	local words = { }
+	for word in clean:gmatch( "%w+" ) do
+		words[ #words + 1 ] = word
+	end
+	local hp, maxhp = clean:match( "^HP: (%d+)/(%d+)" )
+	local speaker, message = clean:match( "^(%w+) tells you '(.*)'$" )
+
+	recent[ i % 2000 + 1 ] = {
+		text = clean,
+		words = words,
+		hp = tonumber( hp ),
+		speaker = speaker,
+		message = message,
+	}
+end
+
+return function( first, count )
+	for i = first, first + count - 1 do
+		line( i )
+	end
+end
+)lua";
+
+static void * system_alloc( void * ud, void * ptr, size_t osize, size_t nsize ) {
+	if( nsize == 0 ) {
+		free( ptr );
+		return NULL;
+	}
+	return realloc( ptr, nsize );
+}
+
+struct AllocOp {
+	u32 old_id;
+	u32 new_id;
+	u32 osize;
+	u32 nsize;
+};
+
+static std::vector< AllocOp > trace;
+static std::unordered_map< void *, u32 > trace_ids;
+static u32 next_trace_id = 1;
+
+static void * recording_alloc( void * ud, void * ptr, size_t osize, size_t nsize ) {
+	void * res = system_alloc( ud, ptr, osize, nsize );
+
+	AllocOp op;
+	op.old_id = 0;
+	op.new_id = 0;
+	op.osize = checked_cast< u32 >( osize );
+	op.nsize = checked_cast< u32 >( nsize );
+
+	if( ptr != NULL ) {
+		auto it = trace_ids.find( ptr );
+		op.old_id = it->second;
+		trace_ids.erase( it );
+	}
+
+	if( res != NULL ) {
+		op.new_id = next_trace_id++;
+		trace_ids[ res ] = op.new_id;
+	}
+
+	trace.push_back( op );
+	return res;
+}
+
+static double seconds_since( std::chrono::steady_clock::time_point start ) {
+	std::chrono::duration< double > dt = std::chrono::steady_clock::now() - start;
+	return dt.count();
+}
+
+static size_t live_bytes( lua_State * L ) {
+	return size_t( lua_gc( L, LUA_GCCOUNT, 0 ) ) * 1024 + size_t( lua_gc( L, LUA_GCCOUNTB, 0 ) );
+}
+
+struct RunResult {
+	double total;
+	double gc_total;
+	double gc_p99;
+	double gc_max;
+	double full_collect;
+};
+
+static RunResult run_workload( lua_Alloc alloc, int lines ) {
+	lua_State * L = lua_newstate( alloc, NULL );
+	if( L == NULL )
+		FATAL( "lua_newstate" );
+	luaL_openlibs( L );
+	lua_gc( L, LUA_GCSTOP, 0 );
+
+	if( luaL_loadbuffer( L, workload, sizeof( workload ) - 1, "workload" ) != LUA_OK || lua_pcall( L, 0, 1, 0 ) != LUA_OK )
+		FATAL( "%s\n", lua_tostring( L, -1 ) );
+
+	std::vector< double > pauses;
+	size_t baseline = live_bytes( L );
+	bool cycle_in_progress = false;
+
+	auto start = std::chrono::steady_clock::now();
+
+	for( int first = 0; first < lines; first += LINES_PER_BATCH ) {
+		lua_pushvalue( L, -1 );
+		lua_pushinteger( L, first );
+		lua_pushinteger( L, LINES_PER_BATCH );
+		if( lua_pcall( L, 2, 0, 0 ) != LUA_OK )
+			FATAL( "%s\n", lua_tostring( L, -1 ) );
+
+		if( cycle_in_progress || live_bytes( L ) > baseline + size_t( GC_STEP_KB ) * 1024 ) {
+			auto step_start = std::chrono::steady_clock::now();
+			bool finished = lua_gc( L, LUA_GCSTEP, GC_STEP_KB ) != 0;
+			pauses.push_back( seconds_since( step_start ) );
+
+			cycle_in_progress = !finished;
+			if( finished )
+				baseline = live_bytes( L );
+		}
+	}
+
+	RunResult res;
+	res.total = seconds_since( start );
+
+	auto collect_start = std::chrono::steady_clock::now();
+	lua_gc( L, LUA_GCCOLLECT, 0 );
+	res.full_collect = seconds_since( collect_start );
+
+	lua_close( L );
+
+	std::sort( pauses.begin(), pauses.end() );
+	res.gc_total = 0;
+	for( double p : pauses ) {
+		res.gc_total += p;
+	}
+	res.gc_p99 = pauses.empty() ? 0 : pauses[ pauses.size() * 99 / 100 ];
+	res.gc_max = pauses.empty() ? 0 : pauses.back();
+
+	return res;
+}
+
+static double replay_trace( lua_Alloc alloc ) {
+	std::vector< void * > blocks( next_trace_id, NULL );
+
+	auto start = std::chrono::steady_clock::now();
+
+	for( const AllocOp & op : trace ) {
+		void * res = alloc( NULL, blocks[ op.old_id ], op.osize, op.nsize );
+		if( op.new_id != 0 )
+			blocks[ op.new_id ] = res;
+	}
+
+	return seconds_since( start );
+}
+
+static RunResult best_of( RunResult a, RunResult b ) {
+	RunResult res;
+	res.total = min( a.total, b.total );
+	res.gc_total = min( a.gc_total, b.gc_total );
+	res.gc_p99 = min( a.gc_p99, b.gc_p99 );
+	res.gc_max = min( a.gc_max, b.gc_max );
+	res.full_collect = min( a.full_collect, b.full_collect );
+	return res;
+}
+
+static void print_result( const char * name, RunResult res ) {
+	printf( "%-8s total %7.1fms   gc steps %6.1fms p99 %6.3fms max %6.3fms   full collect %6.2fms\n",
+		name, res.total * 1000, res.gc_total * 1000, res.gc_p99 * 1000, res.gc_max * 1000, res.full_collect * 1000 );
+}
+
+int main() {
+	printf( "%d lines, best of %d\n", LINES, RUNS );
+
+	RunResult system = { 1e9, 1e9, 1e9, 1e9, 1e9 };
+	RunResult pooled = system;
+
+	// alternate so neither allocator gets a warmer machine
+	for( int i = 0; i < RUNS; i++ ) {
+		system = best_of( system, run_workload( system_alloc, LINES ) );
+
+		lua_alloc_init();
+		pooled = best_of( pooled, run_workload( lua_pool_alloc, LINES ) );
+		lua_alloc_term();
+	}
+
+	print_result( "realloc", system );
+	print_result( "pooled", pooled );
+
+	// a quarter of the lines is plenty and keeps the trace small
+	run_workload( recording_alloc, LINES / 4 );
+
+	double system_replay = 1e9;
+	double pooled_replay = 1e9;
+	for( int i = 0; i < RUNS; i++ ) {
+		system_replay = min( system_replay, replay_trace( system_alloc ) );
+
+		lua_alloc_init();
+		pooled_replay = min( pooled_replay, replay_trace( lua_pool_alloc ) );
+		lua_alloc_term();
+	}
+
+	printf( "replaying %zu allocator calls: realloc %.1fms, pooled %.1fms\n", trace.size(), system_replay * 1000, pooled_replay * 1000 );
+
+	return 0;
+}
@@ -0,0 +1,138 @@
+#include <algorithm>
+#include <chrono>
+#include <stdio.h>
+
+#include "common.h"
+#include "array.h"
+#include "map.h"
+
+/*
+ * paths across a 50k room grid with A* and with Dijkstra, which we force
+ * by adding a room with no coordinates. corner to corner is A*'s best case
+ * and close to Dijkstra's worst, since it has to sweep nearly every room
+ * before it gets there. random pairs are more like real speedwalks
+ */
+
+static constexpr int GRID_SIZE = 224;
+static constexpr int RUNS = 20;
+static constexpr int NUM_RANDOM_PATHS = 1000;
+
+static const char * MAP_PATH = "map_bench.map";
+
+struct RNG {
+	u64 state;
+};
+
+static u32 rng_next( RNG * rng ) {
+	rng->state ^= rng->state << 13;
+	rng->state ^= rng->state >> 7;
+	rng->state ^= rng->state << 17;
+	return u32( rng->state >> 32 );
+}
+
+static Span< const char > str( const char * s ) {
+	return Span< const char >( s, strlen( s ) );
+}
+
+static double seconds_since( std::chrono::steady_clock::time_point start ) {
+	std::chrono::duration< double > dt = std::chrono::steady_clock::now() - start;
+	return dt.count();
+}
+
+static u32 grid_id( int x, int y ) {
+	return u32( y * GRID_SIZE + x ) * 7 + 1000;
+}
+
+static void build_grid() {
+	for( int y = 0; y < GRID_SIZE; y++ ) {
+		for( int x = 0; x < GRID_SIZE; x++ ) {
+			char name[ 64 ];
+			snprintf( name, sizeof( name ), "Room %d,%d", x, y );
+			map_set_room( grid_id( x, y ), str( name ), 0, 0 );
+			map_set_coords( grid_id( x, y ), x, y, 0 );
+
+			if( x > 0 ) {
+				map_set_exit( grid_id( x, y ), str( "w" ), grid_id( x - 1, y ), 1 );
+				map_set_exit( grid_id( x - 1, y ), str( "e" ), grid_id( x, y ), 1 );
+			}
+			if( y > 0 ) {
+				map_set_exit( grid_id( x, y ), str( "n" ), grid_id( x, y - 1 ), 1 );
+				map_set_exit( grid_id( x, y - 1 ), str( "s" ), grid_id( x, y ), 1 );
+			}
+		}
+	}
+}
+
+static DynamicArray< Span< const char > > commands;
+
+static double time_path( u32 from, u32 to ) {
+	u32 cost;
+	auto start = std::chrono::steady_clock::now();
+	bool ok = map_path( from, to, 0, &commands, &cost );
+	double dt = seconds_since( start );
+
+	if( !ok )
+		FATAL( "no path from %u to %u\n", from, to );
+
+	return dt;
+}
+
+static void corner_to_corner( const char * name ) {
+	double best = 1e9;
+	for( int i = 0; i < RUNS; i++ ) {
+		best = min( best, time_path( grid_id( 0, 0 ), grid_id( GRID_SIZE - 1, GRID_SIZE - 1 ) ) );
+	}
+
+	printf( "%-8s corner to corner, best of %d: %.3fms\n", name, RUNS, best * 1000 );
+}
+
+static void random_pairs( const char * name ) {
+	RNG rng = { 0x9e3779b97f4a7c15 };
+	DynamicArray< double > times;
+
+	for( int i = 0; i < NUM_RANDOM_PATHS; i++ ) {
+		u32 from = grid_id( rng_next( &rng ) % GRID_SIZE, rng_next( &rng ) % GRID_SIZE );
+		u32 to = grid_id( rng_next( &rng ) % GRID_SIZE, rng_next( &rng ) % GRID_SIZE );
+		times.add( time_path( from, to ) );
+	}
+
+	std::sort( times.begin(), times.end() );
+	printf( "%-8s %d random pairs: median %.3fms p99 %.3fms max %.3fms\n", name, NUM_RANDOM_PATHS,
+		times[ times.size() / 2 ] * 1000, times[ times.size() * 99 / 100 ] * 1000, times.top() * 1000 );
+}
+
+int main() {
+	auto build_start = std::chrono::steady_clock::now();
+	build_grid();
+	printf( "built %zu rooms in %.1fms\n", map_num_rooms(), seconds_since( build_start ) * 1000 );
+
+	corner_to_corner( "A*" );
+	random_pairs( "A*" );
+
+	const u32 OFF_MAP = 1;
+	map_set_room( OFF_MAP, str( "off the map" ), 0, 0 );
+	corner_to_corner( "Dijkstra" );
+	random_pairs( "Dijkstra" );
+	map_remove_room( OFF_MAP );
+
+	const char * err;
+	auto save_start = std::chrono::steady_clock::now();
+	if( !map_save( &err, MAP_PATH ) )
+		FATAL( "map_save: %s\n", err );
+	double save_time = seconds_since( save_start );
+
+	auto load_start = std::chrono::steady_clock::now();
+	if( !map_load( &err, MAP_PATH ) )
+		FATAL( "map_load: %s\n", err );
+	double load_time = seconds_since( load_start );
+
+	printf( "save %.1fms, load %.1fms\n", save_time * 1000, load_time * 1000 );
+
+	// the first A* search after loading measures every exit
+	double first = time_path( grid_id( 0, 0 ), grid_id( GRID_SIZE - 1, GRID_SIZE - 1 ) );
+	printf( "first search after loading: %.3fms\n", first * 1000 );
+	corner_to_corner( "loaded" );
+
+	remove( MAP_PATH );
+	return 0;
+}
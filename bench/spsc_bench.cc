@@ -0,0 +1,102 @@
+#include <chrono>
+#include <thread>
+
+#include "common.h"
+#include "spsc.h"
+#include "wakeup.h"
+
+/*
+ * SPSCRing throughput between two threads for a few message and batch
+ * sizes. both sides block on Wakeups like the network thread does, so
+ * this includes the cost of waking each other up
+ */
+
+static constexpr size_t RING_SIZE = 1 << 22;
+static constexpr size_t BYTES_PER_RUN = size_t( 512 ) * 1024 * 1024;
+
+static SPSCRing ring( RING_SIZE );
+static Wakeup producer_wakeup;
+static Wakeup consumer_wakeup;
+
+static void produce( size_t message_size, size_t batch, size_t count ) {
+	u8 payload[ 4096 ] = { };
+
+	size_t sent = 0;
+	while( sent < count ) {
+		for( size_t i = 0; i < batch && sent < count; ) {
+			if( !ring.push( payload, message_size ) ) {
+				if( ring.commit() )
+					wakeup_signal( &consumer_wakeup );
+				wakeup_wait( &producer_wakeup, -1 );
+				wakeup_drain( &producer_wakeup );
+				continue;
+			}
+
+			sent++;
+			i++;
+		}
+
+		if( ring.commit() )
+			wakeup_signal( &consumer_wakeup );
+	}
+}
+
+static u64 consume( size_t count ) {
+	u64 checksum = 0;
+
+	size_t received = 0;
+	while( received < count ) {
+		Span< const u8 > msg;
+		while( ring.pop( &msg ) ) {
+			checksum += msg.n + msg.ptr[ 0 ];
+			received++;
+		}
+
+		if( ring.release() )
+			wakeup_signal( &producer_wakeup );
+
+		if( received < count && ring.empty() ) {
+			wakeup_wait( &consumer_wakeup, -1 );
+			wakeup_drain( &consumer_wakeup );
+		}
+	}
+
+	return checksum;
+}
+
+static void run( size_t message_size, size_t batch ) {
+	size_t count = BYTES_PER_RUN / message_size;
+
+	auto start = std::chrono::steady_clock::now();
+
+	std::thread thread( produce, message_size, batch, count );
+	u64 checksum = consume( count );
+	thread.join();
+
+	std::chrono::duration< double > dt = std::chrono::steady_clock::now() - start;
+
+	if( checksum != u64( count ) * message_size )
+		FATAL( "bad checksum\n" );
+
+	printf( "%5zu byte messages, batches of %3zu: %7.2fM msgs/s %7.1f MB/s\n",
+		message_size, batch, count / dt.count() / 1e6, BYTES_PER_RUN / dt.count() / ( 1024 * 1024 ) );
+}
+
+int main() {
+	wakeup_init( &producer_wakeup );
+	wakeup_init( &consumer_wakeup );
+
+	size_t sizes[] = { 16, 64, 512, 4096 };
+	size_t batches[] = { 1, 16, 256 };
+
+	for( size_t size : sizes ) {
+		for( size_t batch : batches ) {
+			run( size, batch );
+		}
+	}
+
+	wakeup_term( &producer_wakeup );
+	wakeup_term( &consumer_wakeup );
+
+	return 0;
+}
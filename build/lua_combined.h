@@ -0,0 +1 @@
+9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,116,105,109,101,114,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,97,100,100,84,105,109,101,114,10,108,111,99,97,108,32,99,97,110,99,101,108,84,105,109,101,114,10,10,108,111,99,97,108,32,84,105,109,101,114,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,114,101,115,117,109,101,40,32,99,111,44,32,46,46,46,32,41,10,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,99,111,114,111,117,116,105,110,101,46,114,101,115,117,109,101,40,32,99,111,44,32,46,46,46,32,41,10,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,99,111,114,111,117,116,105,110,101,32,102,97,105,108,101,100,58,32,37,115,34,44,32,100,101,98,117,103,46,116,114,97,99,101,98,97,99,107,40,32,99,111,44,32,101,114,114,32,41,32,41,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,117,114,114,101,110,116,67,111,114,111,117,116,105,110,101,40,32,110,97,109,101,32,41,10,9,108,111,99,97,108,32,99,111,44,32,109,97,105,110,32,61,32,99,111,114,111,117,116,105,110,101,46,114,117,110,110,105,110,103,40,41,10,9,105,102,32,110,111,116,32,99,111,32,111,114,32,109,97,105,110,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,37,115,32,109,117,115,116,32,98,101,32,99,97,108,108,101,100,32,102,114,111,109,32,97,32,99,111,114,111,117,116,105,110,101,44,32,115,101,101,32,109,117,100,46,115,112,97,119,110,34,32,37,32,110,97,109,101,44,32,51,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,99,111,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,97,100,100,40,32,100,101,97,100,108,105,110,101,44,32,116,97,114,103,101,116,32,41,10,9,108,111,99,97,108,32,105,100,32,61,32,97,100,100,84,105,109,101,114,40,32,100,101,97,100,108,105,110,101,32,41,10,9,84,105,109,101,114,115,91,32,105,100,32,93,32,61,32,116,97,114,103,101,116,10,10,9,114,101,116,117,114,110,32,105,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,97,110,99,101,108,40,32,105,100,32,41,10,9,99,97,110,99,101,108,84,105,109,101,114,40,32,105,100,32,41,10,9,84,105,109,101,114,115,91,32,105,100,32,93,32,61,32,110,105,108,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,102,105,114,101,40,32,105,100,44,32,110,111,119,32,41,10,9,108,111,99,97,108,32,116,97,114,103,101,116,32,61,32,84,105,109,101,114,115,91,32,105,100,32,93,10,9,105,102,32,110,111,116,32,116,97,114,103,101,116,32,116,104,101,110,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,84,105,109,101,114,115,91,32,105,100,32,93,32,61,32,110,105,108,10,10,9,105,102,32,116,121,112,101,40,32,116,97,114,103,101,116,32,41,32,61,61,32,34,116,104,114,101,97,100,34,32,116,104,101,110,10,9,9,114,101,115,117,109,101,40,32,116,97,114,103,101,116,44,32,110,111,119,32,41,10,9,101,108,115,101,10,9,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,120,112,99,97,108,108,40,32,116,97,114,103,101,116,44,32,100,101,98,117,103,46,116,114,97,99,101,98,97,99,107,44,32,110,111,119,32,41,10,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,116,105,109,101,114,32,99,97,108,108,98,97,99,107,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,97,110,99,101,108,65,102,116,101,114,40,32,115,101,108,102,32,41,10,9,105,102,32,115,101,108,102,46,105,100,32,116,104,101,110,10,9,9,99,97,110,99,101,108,40,32,115,101,108,102,46,105,100,32,41,10,9,9,115,101,108,102,46,105,100,32,61,32,110,105,108,10,9,101,110,100,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,97,102,116,101,114,40,32,115,101,99,111,110,100,115,44,32,99,97,108,108,98,97,99,107,32,41,10,9,101,110,102,111,114,99,101,40,32,115,101,99,111,110,100,115,44,32,34,115,101,99,111,110,100,115,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,102,111,114,99,101,40,32,99,97,108,108,98,97,99,107,44,32,34,99,97,108,108,98,97,99,107,34,44,32,34,102,117,110,99,116,105,111,110,34,32,41,10,10,9,108,111,99,97,108,32,97,102,116,101,114,32,61,32,123,10,9,9,99,97,110,99,101,108,32,61,32,99,97,110,99,101,108,65,102,116,101,114,44,10,9,125,10,10,9,97,102,116,101,114,46,105,100,32,61,32,97,100,100,40,32,109,117,100,46,110,111,119,40,41,32,43,32,115,101,99,111,110,100,115,44,32,102,117,110,99,116,105,111,110,40,32,110,111,119,32,41,10,9,9,97,102,116,101,114,46,105,100,32,61,32,110,105,108,10,9,9,99,97,108,108,98,97,99,107,40,32,110,111,119,32,41,10,9,101,110,100,32,41,10,10,9,114,101,116,117,114,110,32,97,102,116,101,114,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,115,108,101,101,112,40,32,115,101,99,111,110,100,115,32,41,10,9,101,110,102,111,114,99,101,40,32,115,101,99,111,110,100,115,44,32,34,115,101,99,111,110,100,115,34,44,32,34,110,117,109,98,101,114,34,32,41,10,10,9,97,100,100,40,32,109,117,100,46,110,111,119,40,41,32,43,32,115,101,99,111,110,100,115,44,32,99,117,114,114,101,110,116,67,111,114,111,117,116,105,110,101,40,32,34,109,117,100,46,115,108,101,101,112,34,32,41,32,41,10,10,9,114,101,116,117,114,110,32,99,111,114,111,117,116,105,110,101,46,121,105,101,108,100,40,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,115,112,97,119,110,40,32,99,97,108,108,98,97,99,107,44,32,46,46,46,32,41,10,9,101,110,102,111,114,99,101,40,32,99,97,108,108,98,97,99,107,44,32,34,99,97,108,108,98,97,99,107,34,44,32,34,102,117,110,99,116,105,111,110,34,32,41,10,10,9,108,111,99,97,108,32,99,111,32,61,32,99,111,114,111,117,116,105,110,101,46,99,114,101,97,116,101,40,32,99,97,108,108,98,97,99,107,32,41,10,9,114,101,115,117,109,101,40,32,99,111,44,32,46,46,46,32,41,10,10,9,114,101,116,117,114,110,32,99,111,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,97,100,100,44,32,99,97,110,99,101,108,32,41,10,9,9,97,100,100,84,105,109,101,114,32,61,32,97,100,100,10,9,9,99,97,110,99,101,108,84,105,109,101,114,32,61,32,99,97,110,99,101,108,10,9,101,110,100,44,10,10,9,97,100,100,32,61,32,97,100,100,44,10,9,99,97,110,99,101,108,32,61,32,99,97,110,99,101,108,44,10,9,102,105,114,101,32,61,32,102,105,114,101,44,10,10,9,114,101,115,117,109,101,32,61,32,114,101,115,117,109,101,44,10,9,99,117,114,114,101,110,116,67,111,114,111,117,116,105,110,101,32,61,32,99,117,114,114,101,110,116,67,111,114,111,117,116,105,110,101,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,102,105,110,100,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,102,105,110,100,44,32,102,105,110,100,78,101,120,116,44,32,99,108,101,97,114,70,105,110,100,10,10,45,45,32,115,101,97,114,99,104,101,115,32,116,104,101,32,109,97,105,110,32,119,105,110,100,111,119,39,115,32,115,99,114,111,108,108,98,97,99,107,44,32,99,97,115,101,32,105,110,115,101,110,115,105,116,105,118,101,108,121,46,32,109,117,100,46,102,105,110,100,32,106,117,109,112,115,10,45,45,32,116,111,32,116,104,101,32,110,101,119,101,115,116,32,109,97,116,99,104,32,97,110,100,32,109,117,100,46,102,105,110,100,78,101,120,116,32,109,111,118,101,115,32,111,110,32,102,114,111,109,32,116,104,101,114,101,44,32,116,111,119,97,114,100,115,32,111,108,100,101,114,10,45,45,32,108,105,110,101,115,32,117,110,108,101,115,115,32,110,101,119,101,114,32,105,115,32,115,101,116,10,102,117,110,99,116,105,111,110,32,109,117,100,46,102,105,110,100,40,32,116,101,120,116,32,41,10,9,101,110,102,111,114,99,101,40,32,116,101,120,116,44,32,34,116,101,120,116,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,114,101,116,117,114,110,32,102,105,110,100,40,32,116,101,120,116,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,102,105,110,100,78,101,120,116,40,32,110,101,119,101,114,32,41,10,9,114,101,116,117,114,110,32,102,105,110,100,78,101,120,116,40,32,110,111,116,32,110,101,119,101,114,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,99,108,101,97,114,70,105,110,100,40,41,10,9,99,108,101,97,114,70,105,110,100,40,41,10,101,110,100,10,10,45,45,32,100,111,110,39,116,32,112,117,116,32,116,104,101,32,113,117,101,114,121,32,105,110,32,116,104,101,32,109,101,115,115,97,103,101,32,111,114,32,119,101,39,100,32,109,97,116,99,104,32,105,116,32,110,101,120,116,32,116,105,109,101,10,109,117,100,46,97,108,105,97,115,40,32,34,47,102,105,110,100,34,44,32,102,117,110,99,116,105,111,110,40,32,116,101,120,116,32,41,10,9,105,102,32,116,101,120,116,32,126,61,32,34,34,32,116,104,101,110,10,9,9,105,102,32,110,111,116,32,109,117,100,46,102,105,110,100,40,32,116,101,120,116,32,41,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,78,111,32,109,97,116,99,104,101,115,34,32,41,10,9,9,101,110,100,10,9,101,108,115,101,105,102,32,110,111,116,32,109,117,100,46,102,105,110,100,78,101,120,116,40,41,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,78,111,32,111,108,100,101,114,32,109,97,116,99,104,101,115,34,32,41,10,9,101,110,100,10,101,110,100,32,41,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,102,105,110,100,110,101,119,101,114,34,44,32,102,117,110,99,116,105,111,110,40,41,10,9,105,102,32,110,111,116,32,109,117,100,46,102,105,110,100,78,101,120,116,40,32,116,114,117,101,32,41,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,78,111,32,110,101,119,101,114,32,109,97,116,99,104,101,115,34,32,41,10,9,101,110,100,10,101,110,100,32,41,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,102,105,110,100,99,108,101,97,114,34,44,32,109,117,100,46,99,108,101,97,114,70,105,110,100,32,41,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,102,44,32,110,44,32,99,32,41,10,9,9,102,105,110,100,32,61,32,102,10,9,9,102,105,110,100,78,101,120,116,32,61,32,110,10,9,9,99,108,101,97,114,70,105,110,100,32,61,32,99,10,9,101,110,100,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,97,108,105,97,115,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,65,108,105,97,115,101,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,111,65,108,105,97,115,40,32,108,105,110,101,32,41,10,9,108,111,99,97,108,32,99,111,109,109,97,110,100,44,32,97,114,103,115,32,61,32,108,105,110,101,58,109,97,116,99,104,40,32,34,94,40,37,83,43,41,37,115,42,40,46,42,41,36,34,32,41,10,9,108,111,99,97,108,32,97,108,105,97,115,32,61,32,65,108,105,97,115,101,115,91,32,99,111,109,109,97,110,100,32,93,10,10,9,105,102,32,97,108,105,97,115,32,97,110,100,32,97,108,105,97,115,46,101,110,97,98,108,101,100,32,116,104,101,110,10,9,9,108,111,99,97,108,32,98,97,100,83,121,110,116,97,120,32,61,32,116,114,117,101,10,10,9,9,102,111,114,32,105,32,61,32,49,44,32,35,97,108,105,97,115,46,99,97,108,108,98,97,99,107,115,32,100,111,10,9,9,9,108,111,99,97,108,32,99,97,108,108,98,97,99,107,32,61,32,97,108,105,97,115,46,99,97,108,108,98,97,99,107,115,91,32,105,32,93,10,9,9,9,108,111,99,97,108,32,111,107,44,32,101,114,114,44,32,115,117,98,115,32,61,32,120,112,99,97,108,108,40,32,115,116,114,105,110,103,46,103,115,117,98,44,32,100,101,98,117,103,46,116,114,97,99,101,98,97,99,107,44,32,97,114,103,115,44,32,99,97,108,108,98,97,99,107,46,112,97,116,116,101,114,110,44,32,99,97,108,108,98,97,99,107,46,99,97,108,108,98,97,99,107,32,41,10,10,9,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,97,108,105,97,115,32,99,97,108,108,98,97,99,107,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,10,9,9,9,9,114,101,116,117,114,110,32,116,114,117,101,10,9,9,9,101,110,100,10,10,9,9,9,105,102,32,115,117,98,115,32,126,61,32,48,32,116,104,101,110,10,9,9,9,9,98,97,100,83,121,110,116,97,120,32,61,32,102,97,108,115,101,10,10,9,9,9,9,98,114,101,97,107,10,9,9,9,101,110,100,10,9,9,101,110,100,10,10,9,9,105,102,32,98,97,100,83,121,110,116,97,120,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,115,121,110,116,97,120,58,32,37,115,32,37,115,34,44,32,99,111,109,109,97,110,100,44,32,97,108,105,97,115,46,115,121,110,116,97,120,32,41,10,9,9,101,110,100,10,10,9,9,114,101,116,117,114,110,32,116,114,117,101,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,102,97,108,115,101,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,105,109,112,108,101,65,108,105,97,115,40,32,99,97,108,108,98,97,99,107,44,32,100,105,115,97,98,108,101,100,32,41,10,9,114,101,116,117,114,110,32,123,10,9,9,99,97,108,108,98,97,99,107,115,32,61,32,123,10,9,9,9,123,10,9,9,9,9,112,97,116,116,101,114,110,32,61,32,34,94,40,46,42,41,36,34,44,10,9,9,9,9,99,97,108,108,98,97,99,107,32,61,32,99,97,108,108,98,97,99,107,44,10,9,9,9,125,44,10,9,9,125,44,10,10,9,9,101,110,97,98,108,101,100,32,61,32,110,111,116,32,100,105,115,97,98,108,101,100,44,10,10,9,9,101,110,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,116,114,117,101,10,9,9,101,110,100,44,10,9,9,100,105,115,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,102,97,108,115,101,10,9,9,101,110,100,44,10,9,125,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,112,97,116,116,101,114,110,65,108,105,97,115,40,32,99,97,108,108,98,97,99,107,115,44,32,115,121,110,116,97,120,44,32,100,105,115,97,98,108,101,100,32,41,10,9,108,111,99,97,108,32,97,108,105,97,115,32,61,32,123,10,9,9,99,97,108,108,98,97,99,107,115,32,61,32,123,32,125,44,10,9,9,115,121,110,116,97,120,32,61,32,115,121,110,116,97,120,44,10,10,9,9,101,110,97,98,108,101,100,32,61,32,110,111,116,32,100,105,115,97,98,108,101,100,44,10,10,9,9,101,110,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,116,114,117,101,10,9,9,101,110,100,44,10,9,9,100,105,115,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,102,97,108,115,101,10,9,9,101,110,100,44,10,9,125,10,10,9,102,111,114,32,112,97,116,116,101,114,110,44,32,99,97,108,108,98,97,99,107,32,105,110,32,112,97,105,114,115,40,32,99,97,108,108,98,97,99,107,115,32,41,32,100,111,10,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,97,108,105,97,115,46,99,97,108,108,98,97,99,107,115,44,32,123,10,9,9,9,112,97,116,116,101,114,110,32,61,32,112,97,116,116,101,114,110,44,10,9,9,9,99,97,108,108,98,97,99,107,32,61,32,99,97,108,108,98,97,99,107,44,10,9,9,125,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,97,108,105,97,115,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,97,108,105,97,115,40,32,99,111,109,109,97,110,100,44,32,104,97,110,100,108,101,114,44,32,46,46,46,32,41,10,9,101,110,102,111,114,99,101,40,32,99,111,109,109,97,110,100,44,32,34,99,111,109,109,97,110,100,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,104,97,110,100,108,101,114,44,32,34,104,97,110,100,108,101,114,34,44,32,34,102,117,110,99,116,105,111,110,34,44,32,34,115,116,114,105,110,103,34,44,32,34,116,97,98,108,101,34,32,41,10,10,9,97,115,115,101,114,116,40,32,110,111,116,32,65,108,105,97,115,101,115,91,32,99,111,109,109,97,110,100,32,93,44,32,34,97,108,105,97,115,32,96,37,115,39,32,97,108,114,101,97,100,121,32,114,101,103,105,115,116,101,114,101,100,34,32,37,32,99,111,109,109,97,110,100,32,41,10,10,9,105,102,32,116,121,112,101,40,32,104,97,110,100,108,101,114,32,41,32,61,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,108,111,99,97,108,32,99,111,109,109,97,110,100,32,61,32,104,97,110,100,108,101,114,10,10,9,9,104,97,110,100,108,101,114,32,61,32,102,117,110,99,116,105,111,110,40,32,97,114,103,115,32,41,10,9,9,9,109,117,100,46,105,110,112,117,116,40,32,99,111,109,109,97,110,100,32,37,32,97,114,103,115,32,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,108,111,99,97,108,32,97,108,105,97,115,32,61,32,116,121,112,101,40,32,104,97,110,100,108,101,114,32,41,32,61,61,32,34,102,117,110,99,116,105,111,110,34,10,9,9,97,110,100,32,115,105,109,112,108,101,65,108,105,97,115,40,32,104,97,110,100,108,101,114,44,32,46,46,46,32,41,10,9,9,111,114,32,112,97,116,116,101,114,110,65,108,105,97,115,40,32,104,97,110,100,108,101,114,44,32,46,46,46,32,41,10,10,9,65,108,105,97,115,101,115,91,32,99,111,109,109,97,110,100,32,93,32,61,32,97,108,105,97,115,10,10,9,114,101,116,117,114,110,32,97,108,105,97,115,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,100,111,65,108,105,97,115,32,61,32,100,111,65,108,105,97,115,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,117,116,105,108,115,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,108,102,115,32,61,32,114,101,113,117,105,114,101,40,32,34,108,102,115,34,32,41,10,10,103,101,116,109,101,116,97,116,97,98,108,101,40,32,34,34,32,41,46,95,95,109,111,100,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,44,32,102,111,114,109,32,41,10,9,105,102,32,116,121,112,101,40,32,102,111,114,109,32,41,32,61,61,32,34,116,97,98,108,101,34,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,115,101,108,102,58,102,111,114,109,97,116,40,32,116,97,98,108,101,46,117,110,112,97,99,107,40,32,102,111,114,109,32,41,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,115,101,108,102,58,102,111,114,109,97,116,40,32,102,111,114,109,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,115,116,114,105,110,103,46,112,108,117,114,97,108,40,32,99,111,117,110,116,44,32,112,108,117,114,44,32,115,105,110,103,32,41,10,9,114,101,116,117,114,110,32,99,111,117,110,116,32,61,61,32,49,32,97,110,100,32,40,32,115,105,110,103,32,111,114,32,34,34,32,41,32,111,114,32,40,32,112,108,117,114,32,111,114,32,34,115,34,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,115,116,114,105,110,103,46,115,116,97,114,116,115,87,105,116,104,40,32,115,101,108,102,44,32,110,101,101,100,108,101,44,32,105,103,110,111,114,101,67,97,115,101,32,41,10,9,105,102,32,105,103,110,111,114,101,67,97,115,101,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,115,101,108,102,58,108,111,119,101,114,40,41,58,115,117,98,40,32,49,44,32,110,101,101,100,108,101,58,108,101,110,40,41,32,41,32,61,61,32,110,101,101,100,108,101,58,108,111,119,101,114,40,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,115,101,108,102,58,115,117,98,40,32,49,44,32,110,101,101,100,108,101,58,108,101,110,40,41,32,41,32,61,61,32,110,101,101,100,108,101,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,115,116,114,105,110,103,46,99,111,109,109,97,115,40,32,110,117,109,32,41,10,9,110,117,109,32,61,32,116,111,110,117,109,98,101,114,40,32,110,117,109,32,41,10,10,9,108,111,99,97,108,32,111,117,116,32,61,32,34,34,10,10,9,119,104,105,108,101,32,110,117,109,32,62,61,32,49,48,48,48,32,100,111,10,9,9,111,117,116,32,61,32,40,32,34,44,37,48,51,100,37,115,34,32,41,58,102,111,114,109,97,116,40,32,110,117,109,32,37,32,49,48,48,48,44,32,111,117,116,32,41,10,10,9,9,110,117,109,32,61,32,109,97,116,104,46,102,108,111,111,114,40,32,110,117,109,32,47,32,49,48,48,48,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,116,111,115,116,114,105,110,103,40,32,110,117,109,32,41,32,46,46,32,111,117,116,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,97,116,104,46,114,111,117,110,100,40,32,110,117,109,32,41,10,9,114,101,116,117,114,110,32,109,97,116,104,46,102,108,111,111,114,40,32,110,117,109,32,43,32,48,46,53,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,97,116,104,46,97,118,103,40,32,97,44,32,98,32,41,10,9,114,101,116,117,114,110,32,40,32,97,32,43,32,98,32,41,32,47,32,50,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,105,111,46,114,101,97,100,97,98,108,101,40,32,112,97,116,104,32,41,10,9,108,111,99,97,108,32,97,116,116,114,44,32,101,114,114,32,61,32,108,102,115,46,97,116,116,114,105,98,117,116,101,115,40,32,112,97,116,104,32,41,10,9,105,102,32,110,111,116,32,97,116,116,114,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,102,97,108,115,101,44,32,101,114,114,10,9,101,110,100,10,10,9,105,102,32,97,116,116,114,46,109,111,100,101,32,61,61,32,34,100,105,114,101,99,116,111,114,121,34,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,116,114,117,101,10,9,101,110,100,10,10,9,108,111,99,97,108,32,102,105,108,101,44,32,101,114,114,32,61,32,105,111,46,111,112,101,110,40,32,112,97,116,104,44,32,34,114,34,32,41,10,9,105,102,32,110,111,116,32,102,105,108,101,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,102,97,108,115,101,44,32,101,114,114,10,9,101,110,100,10,10,9,105,111,46,99,108,111,115,101,40,32,102,105,108,101,32,41,10,10,9,114,101,116,117,114,110,32,116,114,117,101,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,101,110,102,111,114,99,101,40,32,118,97,114,44,32,110,97,109,101,44,32,46,46,46,32,41,10,9,108,111,99,97,108,32,97,99,99,101,112,116,97,98,108,101,32,61,32,123,32,46,46,46,32,125,10,9,108,111,99,97,108,32,111,107,32,61,32,102,97,108,115,101,10,10,9,102,111,114,32,95,44,32,97,99,99,101,112,116,32,105,110,32,105,112,97,105,114,115,40,32,97,99,99,101,112,116,97,98,108,101,32,41,32,100,111,10,9,9,105,102,32,116,121,112,101,40,32,118,97,114,32,41,32,61,61,32,97,99,99,101,112,116,32,116,104,101,110,10,9,9,9,111,107,32,61,32,116,114,117,101,10,10,9,9,9,98,114,101,97,107,10,9,9,101,110,100,10,9,101,110,100,10,10,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,97,114,103,117,109,101,110,116,32,96,37,115,39,32,116,111,32,37,115,32,115,104,111,117,108,100,32,98,101,32,111,102,32,116,121,112,101,32,37,115,32,40,103,111,116,32,37,115,41,34,32,37,32,123,32,110,97,109,101,44,32,100,101,98,117,103,46,103,101,116,105,110,102,111,40,32,50,44,32,34,110,34,32,41,46,110,97,109,101,44,32,116,97,98,108,101,46,99,111,110,99,97,116,40,32,97,99,99,101,112,116,97,98,108,101,44,32,34,32,111,114,32,34,32,41,44,32,116,121,112,101,40,32,118,97,114,32,41,32,125,44,32,51,32,41,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,103,101,110,101,114,105,99,80,114,105,110,116,40,32,109,101,115,115,97,103,101,44,32,109,97,105,110,44,32,99,104,97,116,32,41,10,9,108,111,99,97,108,32,98,111,108,100,32,61,32,102,97,108,115,101,10,9,108,111,99,97,108,32,102,103,32,61,32,55,10,9,108,111,99,97,108,32,98,103,32,61,32,48,10,10,9,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,101,116,70,71,40,32,99,111,108,111,117,114,32,41,10,9,9,114,101,116,117,114,110,32,102,117,110,99,116,105,111,110,40,41,10,9,9,9,102,103,32,61,32,99,111,108,111,117,114,10,9,9,101,110,100,10,9,101,110,100,10,10,9,108,111,99,97,108,32,83,101,113,117,101,110,99,101,115,32,61,32,123,10,9,9,100,32,61,32,115,101,116,70,71,40,32,55,32,41,44,10,9,9,107,32,61,32,115,101,116,70,71,40,32,48,32,41,44,10,9,9,114,32,61,32,115,101,116,70,71,40,32,49,32,41,44,10,9,9,103,32,61,32,115,101,116,70,71,40,32,50,32,41,44,10,9,9,121,32,61,32,115,101,116,70,71,40,32,51,32,41,44,10,9,9,98,32,61,32,115,101,116,70,71,40,32,52,32,41,44,10,9,9,109,32,61,32,115,101,116,70,71,40,32,53,32,41,44,10,9,9,99,32,61,32,115,101,116,70,71,40,32,54,32,41,44,10,9,9,119,32,61,32,115,101,116,70,71,40,32,55,32,41,44,10,9,9,115,32,61,32,115,101,116,70,71,40,32,56,32,41,44,10,9,125,10,10,9,102,111,114,32,108,105,110,101,44,32,110,101,119,76,105,110,101,32,105,110,32,109,101,115,115,97,103,101,58,103,109,97,116,99,104,40,32,34,40,91,94,92,110,93,42,41,40,92,110,63,41,34,32,41,32,100,111,10,9,9,102,111,114,32,116,101,120,116,44,32,104,97,115,104,80,111,115,44,32,108,105,103,104,116,44,32,99,111,108,111,117,114,44,32,99,111,108,111,117,114,80,111,115,32,105,110,32,40,32,108,105,110,101,32,46,46,32,34,35,97,34,32,41,58,103,109,97,116,99,104,40,32,34,40,46,45,41,40,41,35,40,108,63,41,40,37,108,41,40,41,34,32,41,32,100,111,10,9,9,9,105,102,32,109,97,105,110,32,116,104,101,110,10,9,9,9,9,109,117,100,46,112,114,105,110,116,77,97,105,110,40,32,116,101,120,116,58,103,115,117,98,40,32,34,35,35,34,44,32,34,35,34,32,41,44,32,102,103,44,32,98,103,44,32,98,111,108,100,32,41,10,9,9,9,101,110,100,10,10,9,9,9,105,102,32,99,104,97,116,32,116,104,101,110,10,9,9,9,9,109,117,100,46,112,114,105,110,116,67,104,97,116,40,32,116,101,120,116,58,103,115,117,98,40,32,34,35,35,34,44,32,34,35,34,32,41,44,32,102,103,44,32,98,103,44,32,98,111,108,100,32,41,10,9,9,9,101,110,100,10,10,9,9,9,105,102,32,108,105,110,101,58,115,117,98,40,32,104,97,115,104,80,111,115,32,45,32,49,44,32,104,97,115,104,80,111,115,32,45,32,49,32,41,32,126,61,32,34,35,34,32,116,104,101,110,10,9,9,9,9,105,102,32,99,111,108,111,117,114,80,111,115,32,126,61,32,108,105,110,101,58,108,101,110,40,41,32,43,32,51,32,116,104,101,110,10,9,9,9,9,9,97,115,115,101,114,116,40,32,83,101,113,117,101,110,99,101,115,91,32,99,111,108,111,117,114,32,93,44,32,34,105,110,118,97,108,105,100,32,99,111,108,111,117,114,32,115,101,113,117,101,110,99,101,58,32,35,34,32,46,46,32,108,105,103,104,116,32,46,46,32,99,111,108,111,117,114,32,41,10,10,9,9,9,9,9,98,111,108,100,32,61,32,108,105,103,104,116,32,61,61,32,34,108,34,10,9,9,9,9,9,83,101,113,117,101,110,99,101,115,91,32,99,111,108,111,117,114,32,93,40,41,10,9,9,9,9,101,110,100,10,9,9,9,101,108,115,101,10,9,9,9,9,105,102,32,109,97,105,110,32,116,104,101,110,10,9,9,9,9,9,109,117,100,46,112,114,105,110,116,77,97,105,110,40,32,108,105,103,104,116,32,46,46,32,99,111,108,111,117,114,44,32,102,103,44,32,98,103,44,32,98,111,108,100,32,41,10,9,9,9,9,101,110,100,10,10,9,9,9,9,105,102,32,99,104,97,116,32,116,104,101,110,10,9,9,9,9,9,109,117,100,46,112,114,105,110,116,67,104,97,116,40,32,108,105,103,104,116,32,46,46,32,99,111,108,111,117,114,44,32,102,103,44,32,98,103,44,32,98,111,108,100,32,41,10,9,9,9,9,101,110,100,10,9,9,9,101,110,100,10,9,9,101,110,100,10,10,9,9,105,102,32,110,101,119,76,105,110,101,32,126,61,32,34,34,32,116,104,101,110,10,9,9,9,105,102,32,109,97,105,110,32,116,104,101,110,10,9,9,9,9,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,40,41,10,9,9,9,101,110,100,10,10,9,9,9,105,102,32,99,104,97,116,32,116,104,101,110,10,9,9,9,9,109,117,100,46,110,101,119,108,105,110,101,67,104,97,116,40,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,112,114,105,110,116,40,32,102,111,114,109,44,32,46,46,46,32,41,10,9,103,101,110,101,114,105,99,80,114,105,110,116,40,32,102,111,114,109,58,102,111,114,109,97,116,40,32,46,46,46,32,41,44,32,116,114,117,101,44,32,102,97,108,115,101,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,112,114,105,110,116,99,40,32,102,111,114,109,44,32,46,46,46,32,41,10,9,103,101,110,101,114,105,99,80,114,105,110,116,40,32,102,111,114,109,58,102,111,114,109,97,116,40,32,46,46,46,32,41,44,32,102,97,108,115,101,44,32,116,114,117,101,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,112,114,105,110,116,98,40,32,102,111,114,109,44,32,46,46,46,32,41,10,9,103,101,110,101,114,105,99,80,114,105,110,116,40,32,102,111,114,109,58,102,111,114,109,97,116,40,32,46,46,46,32,41,44,32,116,114,117,101,44,32,116,114,117,101,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,112,114,105,110,116,114,40,32,115,116,114,44,32,102,103,44,32,98,103,44,32,98,111,108,100,32,41,10,9,102,103,32,61,32,102,103,32,111,114,32,55,10,9,98,103,32,61,32,98,103,32,111,114,32,48,10,9,98,111,108,100,32,61,32,98,111,108,100,32,111,114,32,102,97,108,115,101,10,10,9,102,111,114,32,108,105,110,101,44,32,110,101,119,76,105,110,101,32,105,110,32,115,116,114,58,103,109,97,116,99,104,40,32,34,40,91,94,92,110,93,42,41,40,92,110,63,41,34,32,41,32,100,111,10,9,9,109,117,100,46,112,114,105,110,116,77,97,105,110,40,32,108,105,110,101,44,32,102,103,44,32,98,103,44,32,98,111,108,100,32,41,10,10,9,9,105,102,32,110,101,119,76,105,110,101,32,126,61,32,34,34,32,116,104,101,110,10,9,9,9,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,40,41,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,101,110,97,98,108,101,40,32,46,46,46,32,41,10,9,108,111,99,97,108,32,116,104,105,110,103,115,32,61,32,123,32,46,46,46,32,125,10,10,9,105,102,32,110,111,116,32,116,104,105,110,103,115,91,32,49,32,93,46,101,110,97,98,108,101,32,116,104,101,110,10,9,9,116,104,105,110,103,115,32,61,32,116,104,105,110,103,115,91,32,49,32,93,10,9,101,110,100,10,10,9,102,111,114,32,95,44,32,116,104,105,110,103,32,105,110,32,105,112,97,105,114,115,40,32,116,104,105,110,103,115,32,41,32,100,111,10,9,9,116,104,105,110,103,58,101,110,97,98,108,101,40,41,10,9,101,110,100,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,100,105,115,97,98,108,101,40,32,46,46,46,32,41,10,9,108,111,99,97,108,32,116,104,105,110,103,115,32,61,32,123,32,46,46,46,32,125,10,10,9,105,102,32,110,111,116,32,116,104,105,110,103,115,91,32,49,32,93,46,101,110,97,98,108,101,32,116,104,101,110,10,9,9,116,104,105,110,103,115,32,61,32,116,104,105,110,103,115,91,32,49,32,93,10,9,101,110,100,10,10,9,102,111,114,32,95,44,32,116,104,105,110,103,32,105,110,32,105,112,97,105,114,115,40,32,116,104,105,110,103,115,32,41,32,100,111,10,9,9,116,104,105,110,103,58,100,105,115,97,98,108,101,40,41,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,67,111,108,111,117,114,83,101,113,117,101,110,99,101,115,32,61,32,123,10,9,100,32,61,32,48,44,10,9,107,32,61,32,51,48,44,10,9,114,32,61,32,51,49,44,10,9,103,32,61,32,51,50,44,10,9,121,32,61,32,51,51,44,10,9,98,32,61,32,51,52,44,10,9,109,32,61,32,51,53,44,10,9,99,32,61,32,51,54,44,10,9,119,32,61,32,51,55,44,10,125,10,10,102,117,110,99,116,105,111,110,32,115,116,114,105,110,103,46,112,97,114,115,101,67,111,108,111,117,114,115,40,32,109,101,115,115,97,103,101,32,41,10,9,109,101,115,115,97,103,101,32,61,32,97,115,115,101,114,116,40,32,116,111,115,116,114,105,110,103,40,32,109,101,115,115,97,103,101,32,41,32,41,10,10,9,114,101,116,117,114,110,32,40,32,109,101,115,115,97,103,101,58,103,115,117,98,40,32,34,40,41,35,40,108,63,41,40,37,108,41,34,44,32,102,117,110,99,116,105,111,110,40,32,112,97,116,116,101,114,110,80,111,115,44,32,98,111,108,100,44,32,115,101,113,117,101,110,99,101,32,41,10,9,9,105,102,32,109,101,115,115,97,103,101,58,115,117,98,40,32,112,97,116,116,101,114,110,80,111,115,32,45,32,49,44,32,112,97,116,116,101,114,110,80,111,115,32,45,32,49,32,41,32,61,61,32,34,35,34,32,116,104,101,110,10,9,9,9,114,101,116,117,114,110,10,9,9,101,110,100,10,10,9,9,105,102,32,98,111,108,100,32,61,61,32,34,108,34,32,116,104,101,110,10,9,9,9,114,101,116,117,114,110,32,34,92,50,55,91,49,109,92,50,55,91,37,100,109,34,32,37,32,123,32,67,111,108,111,117,114,83,101,113,117,101,110,99,101,115,91,32,115,101,113,117,101,110,99,101,32,93,32,125,10,9,9,101,110,100,10,10,9,9,114,101,116,117,114,110,32,34,92,50,55,91,48,109,92,50,55,91,37,100,109,34,32,37,32,123,32,67,111,108,111,117,114,83,101,113,117,101,110,99,101,115,91,32,115,101,113,117,101,110,99,101,32,93,32,125,10,9,101,110,100,32,41,58,103,115,117,98,40,32,34,35,35,34,44,32,34,35,34,32,41,32,41,10,101,110,100,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,97,99,116,105,111,110,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,116,105,109,101,114,32,61,32,114,101,113,117,105,114,101,40,32,34,116,105,109,101,114,34,32,41,10,108,111,99,97,108,32,116,114,105,103,103,101,114,32,61,32,114,101,113,117,105,114,101,40,32,34,116,114,105,103,103,101,114,34,32,41,10,10,108,111,99,97,108,32,67,104,97,116,65,99,116,105,111,110,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,67,104,97,116,83,101,116,40,32,102,97,108,115,101,32,41,10,108,111,99,97,108,32,67,104,97,116,80,114,101,65,99,116,105,111,110,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,67,104,97,116,83,101,116,40,32,102,97,108,115,101,32,41,10,108,111,99,97,108,32,67,104,97,116,65,110,115,105,65,99,116,105,111,110,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,67,104,97,116,83,101,116,40,32,116,114,117,101,32,41,10,108,111,99,97,108,32,67,104,97,116,65,110,115,105,80,114,101,65,99,116,105,111,110,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,67,104,97,116,83,101,116,40,32,116,114,117,101,32,41,10,10,108,111,99,97,108,32,65,99,116,105,111,110,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,83,101,116,40,32,102,97,108,115,101,44,32,67,104,97,116,65,99,116,105,111,110,115,32,41,10,108,111,99,97,108,32,80,114,101,65,99,116,105,111,110,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,83,101,116,40,32,102,97,108,115,101,44,32,67,104,97,116,80,114,101,65,99,116,105,111,110,115,32,41,10,108,111,99,97,108,32,65,110,115,105,65,99,116,105,111,110,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,83,101,116,40,32,116,114,117,101,44,32,67,104,97,116,65,110,115,105,65,99,116,105,111,110,115,32,41,10,108,111,99,97,108,32,65,110,115,105,80,114,101,65,99,116,105,111,110,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,83,101,116,40,32,116,114,117,101,44,32,67,104,97,116,65,110,115,105,80,114,101,65,99,116,105,111,110,115,32,41,10,10,108,111,99,97,108,32,77,117,108,116,105,65,99,116,105,111,110,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,83,101,116,40,32,102,97,108,115,101,32,41,10,10,108,111,99,97,108,32,87,97,105,116,101,114,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,100,111,65,99,116,105,111,110,115,10,108,111,99,97,108,32,100,111,80,114,101,65,99,116,105,111,110,115,10,108,111,99,97,108,32,100,111,65,110,115,105,65,99,116,105,111,110,115,10,108,111,99,97,108,32,100,111,65,110,115,105,80,114,101,65,99,116,105,111,110,115,10,10,108,111,99,97,108,32,100,111,67,104,97,116,65,99,116,105,111,110,115,10,108,111,99,97,108,32,100,111,67,104,97,116,80,114,101,65,99,116,105,111,110,115,10,108,111,99,97,108,32,100,111,67,104,97,116,65,110,115,105,65,99,116,105,111,110,115,10,108,111,99,97,108,32,100,111,67,104,97,116,65,110,115,105,80,114,101,65,99,116,105,111,110,115,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,103,101,110,101,114,105,99,65,99,116,105,111,110,115,40,32,97,99,116,105,111,110,115,32,41,10,9,108,111,99,97,108,32,114,97,119,32,61,32,97,99,116,105,111,110,115,46,114,97,119,10,10,9,45,45,32,99,104,101,99,107,32,102,111,114,32,97,32,109,97,116,99,104,32,110,97,116,105,118,101,108,121,32,102,105,114,115,116,32,115,111,32,108,105,110,101,115,32,110,111,116,104,105,110,103,32,109,97,116,99,104,101,115,32,110,101,118,101,114,10,9,45,45,32,98,101,99,111,109,101,32,76,117,97,32,115,116,114,105,110,103,115,10,9,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,114,117,110,40,32,97,99,116,105,111,110,44,32,108,105,110,101,32,41,10,9,9,108,111,99,97,108,32,111,107,44,32,102,111,117,110,100,32,61,32,112,99,97,108,108,40,32,116,114,105,103,103,101,114,46,102,105,110,100,44,32,108,105,110,101,44,32,97,99,116,105,111,110,46,112,97,116,116,101,114,110,44,32,114,97,119,32,41,10,10,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,97,99,116,105,111,110,32,99,97,108,108,98,97,99,107,32,102,97,105,108,101,100,58,32,37,115,34,44,32,102,111,117,110,100,32,41,10,9,9,101,108,115,101,105,102,32,102,111,117,110,100,32,116,104,101,110,10,9,9,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,120,112,99,97,108,108,40,32,115,116,114,105,110,103,46,103,115,117,98,44,32,100,101,98,117,103,46,116,114,97,99,101,98,97,99,107,44,32,116,114,105,103,103,101,114,46,116,101,120,116,40,32,108,105,110,101,44,32,114,97,119,32,41,44,32,97,99,116,105,111,110,46,112,97,116,116,101,114,110,44,32,97,99,116,105,111,110,46,99,97,108,108,98,97,99,107,32,41,10,10,9,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,97,99,116,105,111,110,32,99,97,108,108,98,97,99,107,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,10,9,114,101,116,117,114,110,10,9,9,102,117,110,99,116,105,111,110,40,32,112,97,116,116,101,114,110,44,32,99,97,108,108,98,97,99,107,44,32,111,112,116,115,32,41,10,9,9,9,101,110,102,111,114,99,101,40,32,112,97,116,116,101,114,110,44,32,34,112,97,116,116,101,114,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,9,9,101,110,102,111,114,99,101,40,32,99,97,108,108,98,97,99,107,44,32,34,99,97,108,108,98,97,99,107,34,44,32,34,102,117,110,99,116,105,111,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,9,9,105,102,32,116,121,112,101,40,32,99,97,108,108,98,97,99,107,32,41,32,61,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,9,9,108,111,99,97,108,32,99,111,109,109,97,110,100,32,61,32,99,97,108,108,98,97,99,107,10,10,9,9,9,9,99,97,108,108,98,97,99,107,32,61,32,102,117,110,99,116,105,111,110,40,41,10,9,9,9,9,9,109,117,100,46,105,110,112,117,116,40,32,99,111,109,109,97,110,100,44,32,116,114,117,101,32,41,10,9,9,9,9,101,110,100,10,9,9,9,101,110,100,10,10,9,9,9,108,111,99,97,108,32,97,99,116,105,111,110,32,61,32,116,114,105,103,103,101,114,46,97,100,100,40,32,97,99,116,105,111,110,115,44,32,123,10,9,9,9,9,112,97,116,116,101,114,110,32,61,32,112,97,116,116,101,114,110,44,10,9,9,9,9,99,97,108,108,98,97,99,107,32,61,32,99,97,108,108,98,97,99,107,44,10,9,9,9,125,44,32,111,112,116,115,32,41,10,10,9,9,9,114,101,116,117,114,110,32,97,99,116,105,111,110,10,9,9,101,110,100,44,10,10,9,9,102,117,110,99,116,105,111,110,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,9,9,116,114,105,103,103,101,114,46,100,105,115,112,97,116,99,104,40,32,97,99,116,105,111,110,115,44,32,108,105,110,101,44,32,112,114,111,109,112,116,44,32,114,117,110,32,41,10,9,9,101,110,100,10,101,110,100,10,10,45,45,32,109,117,108,116,105,45,108,105,110,101,32,97,99,116,105,111,110,115,32,97,114,101,32,97,32,108,105,115,116,32,111,102,32,112,97,116,116,101,114,110,115,32,116,104,97,116,32,104,97,118,101,32,116,111,32,109,97,116,99,104,32,108,105,110,101,115,32,105,110,10,45,45,32,111,114,100,101,114,44,32,97,108,108,32,119,105,116,104,105,110,32,116,104,101,32,108,97,115,116,32,96,119,105,116,104,105,110,96,32,108,105,110,101,115,46,32,101,97,99,104,32,97,99,116,105,111,110,32,107,101,101,112,115,32,116,104,101,32,109,97,116,99,104,101,115,10,45,45,32,105,116,39,115,32,112,97,114,116,119,97,121,32,116,104,114,111,117,103,104,44,32,115,111,32,101,118,101,114,121,32,108,105,110,101,32,105,115,32,111,110,108,121,32,99,104,101,99,107,101,100,32,97,103,97,105,110,115,116,32,116,104,101,32,110,101,120,116,10,45,45,32,112,97,116,116,101,114,110,32,111,102,32,101,97,99,104,32,111,102,32,116,104,101,109,32,97,110,100,32,110,101,118,101,114,32,106,111,105,110,101,100,32,98,97,99,107,32,116,111,103,101,116,104,101,114,46,32,116,104,101,32,108,105,110,101,115,10,45,45,32,116,104,101,109,115,101,108,118,101,115,32,115,116,97,121,32,105,110,32,97,32,110,97,116,105,118,101,32,114,105,110,103,44,32,115,101,101,32,109,117,100,46,114,101,99,101,110,116,76,105,110,101,46,32,116,104,101,32,99,97,108,108,98,97,99,107,32,103,101,116,115,10,45,45,32,101,97,99,104,32,112,97,116,116,101,114,110,39,115,32,99,97,112,116,117,114,101,115,32,105,110,32,111,114,100,101,114,44,32,111,114,32,116,104,101,32,116,101,120,116,32,105,116,32,109,97,116,99,104,101,100,32,105,102,32,105,116,32,104,97,115,32,110,111,110,101,44,10,45,45,32,108,105,107,101,32,109,117,100,46,97,99,116,105,111,110,46,32,97,99,116,105,111,110,46,108,105,110,101,115,32,105,115,32,115,101,116,32,116,111,32,116,104,101,32,110,117,109,98,101,114,32,111,102,32,108,105,110,101,115,32,116,104,101,32,109,97,116,99,104,10,45,45,32,115,112,97,110,110,101,100,32,98,101,102,111,114,101,32,99,97,108,108,105,110,103,32,98,97,99,107,10,10,45,45,32,97,100,100,115,32,119,104,97,116,32,108,105,110,101,58,109,97,116,99,104,32,114,101,116,117,114,110,101,100,32,116,111,32,99,97,112,116,117,114,101,115,44,32,109,97,107,105,110,103,32,116,104,101,32,116,97,98,108,101,32,105,102,32,105,116,32,110,101,101,100,115,10,45,45,32,116,111,46,32,114,101,116,117,114,110,115,32,110,105,108,32,105,102,32,116,104,101,32,112,97,116,116,101,114,110,32,100,105,100,110,39,116,32,109,97,116,99,104,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,97,112,112,101,110,100,67,97,112,116,117,114,101,115,40,32,99,97,112,116,117,114,101,115,44,32,102,105,114,115,116,44,32,46,46,46,32,41,10,9,105,102,32,102,105,114,115,116,32,61,61,32,110,105,108,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,110,105,108,10,9,101,110,100,10,10,9,99,97,112,116,117,114,101,115,32,61,32,99,97,112,116,117,114,101,115,32,111,114,32,123,32,125,10,9,99,97,112,116,117,114,101,115,91,32,35,99,97,112,116,117,114,101,115,32,43,32,49,32,93,32,61,32,102,105,114,115,116,10,9,102,111,114,32,105,32,61,32,49,44,32,115,101,108,101,99,116,40,32,34,35,34,44,32,46,46,46,32,41,32,100,111,10,9,9,99,97,112,116,117,114,101,115,91,32,35,99,97,112,116,117,114,101,115,32,43,32,49,32,93,32,61,32,40,32,115,101,108,101,99,116,40,32,105,44,32,46,46,46,32,41,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,99,97,112,116,117,114,101,115,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,116,101,112,77,117,108,116,105,40,32,97,99,116,105,111,110,44,32,108,105,110,101,32,41,10,9,108,111,99,97,108,32,110,117,109,98,101,114,32,61,32,108,105,110,101,58,110,117,109,98,101,114,40,41,10,9,108,111,99,97,108,32,112,97,116,116,101,114,110,115,32,61,32,97,99,116,105,111,110,46,112,97,116,116,101,114,110,115,10,9,108,111,99,97,108,32,112,97,114,116,105,97,108,115,32,61,32,97,99,116,105,111,110,46,112,97,114,116,105,97,108,115,10,9,108,111,99,97,108,32,107,101,112,116,32,61,32,48,10,9,108,111,99,97,108,32,99,111,109,112,108,101,116,101,10,10,9,45,45,32,111,110,108,121,32,109,97,107,101,115,32,97,32,116,97,98,108,101,32,102,111,114,32,116,104,101,32,99,97,112,116,117,114,101,115,32,105,102,32,116,104,101,32,102,105,114,115,116,32,112,97,116,116,101,114,110,32,109,97,116,99,104,101,100,10,9,108,111,99,97,108,32,99,97,112,116,117,114,101,115,32,61,32,97,112,112,101,110,100,67,97,112,116,117,114,101,115,40,32,110,105,108,44,32,108,105,110,101,58,109,97,116,99,104,40,32,112,97,116,116,101,114,110,115,91,32,49,32,93,32,41,32,41,10,10,9,102,111,114,32,105,32,61,32,49,44,32,35,112,97,114,116,105,97,108,115,32,100,111,10,9,9,108,111,99,97,108,32,112,97,114,116,105,97,108,32,61,32,112,97,114,116,105,97,108,115,91,32,105,32,93,10,9,9,112,97,114,116,105,97,108,115,91,32,105,32,93,32,61,32,110,105,108,10,10,9,9,108,111,99,97,108,32,114,101,109,97,105,110,105,110,103,32,61,32,35,112,97,116,116,101,114,110,115,32,45,32,112,97,114,116,105,97,108,46,115,116,101,112,32,43,32,49,10,9,9,108,111,99,97,108,32,119,105,110,100,111,119,32,61,32,97,99,116,105,111,110,46,119,105,116,104,105,110,32,45,32,40,32,110,117,109,98,101,114,32,45,32,112,97,114,116,105,97,108,46,115,116,97,114,116,32,41,10,10,9,9,105,102,32,114,101,109,97,105,110,105,110,103,32,60,61,32,119,105,110,100,111,119,32,116,104,101,110,10,9,9,9,105,102,32,97,112,112,101,110,100,67,97,112,116,117,114,101,115,40,32,112,97,114,116,105,97,108,46,99,97,112,116,117,114,101,115,44,32,108,105,110,101,58,109,97,116,99,104,40,32,112,97,116,116,101,114,110,115,91,32,112,97,114,116,105,97,108,46,115,116,101,112,32,93,32,41,32,41,32,116,104,101,110,10,9,9,9,9,112,97,114,116,105,97,108,46,115,116,101,112,32,61,32,112,97,114,116,105,97,108,46,115,116,101,112,32,43,32,49,10,9,9,9,101,110,100,10,10,9,9,9,105,102,32,112,97,114,116,105,97,108,46,115,116,101,112,32,62,32,35,112,97,116,116,101,114,110,115,32,116,104,101,110,10,9,9,9,9,99,111,109,112,108,101,116,101,32,61,32,99,111,109,112,108,101,116,101,32,111,114,32,123,32,125,10,9,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,99,111,109,112,108,101,116,101,44,32,112,97,114,116,105,97,108,32,41,10,9,9,9,101,108,115,101,105,102,32,35,112,97,116,116,101,114,110,115,32,45,32,112,97,114,116,105,97,108,46,115,116,101,112,32,43,32,49,32,60,32,119,105,110,100,111,119,32,116,104,101,110,10,9,9,9,9,107,101,112,116,32,61,32,107,101,112,116,32,43,32,49,10,9,9,9,9,112,97,114,116,105,97,108,115,91,32,107,101,112,116,32,93,32,61,32,112,97,114,116,105,97,108,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,10,9,45,45,32,97,32,109,97,116,99,104,32,116,104,97,116,32,115,116,97,114,116,115,32,104,101,114,101,32,109,111,118,101,115,32,111,110,32,116,111,32,105,116,115,32,115,101,99,111,110,100,32,112,97,116,116,101,114,110,32,110,101,120,116,32,108,105,110,101,10,9,105,102,32,99,97,112,116,117,114,101,115,32,116,104,101,110,10,9,9,108,111,99,97,108,32,112,97,114,116,105,97,108,32,61,32,123,32,115,116,97,114,116,32,61,32,110,117,109,98,101,114,44,32,115,116,101,112,32,61,32,50,44,32,99,97,112,116,117,114,101,115,32,61,32,99,97,112,116,117,114,101,115,32,125,10,10,9,9,105,102,32,35,112,97,116,116,101,114,110,115,32,61,61,32,49,32,116,104,101,110,10,9,9,9,99,111,109,112,108,101,116,101,32,61,32,99,111,109,112,108,101,116,101,32,111,114,32,123,32,125,10,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,99,111,109,112,108,101,116,101,44,32,112,97,114,116,105,97,108,32,41,10,9,9,101,108,115,101,10,9,9,9,107,101,112,116,32,61,32,107,101,112,116,32,43,32,49,10,9,9,9,112,97,114,116,105,97,108,115,91,32,107,101,112,116,32,93,32,61,32,112,97,114,116,105,97,108,10,9,9,101,110,100,10,9,101,110,100,10,10,9,105,102,32,99,111,109,112,108,101,116,101,32,116,104,101,110,10,9,9,102,111,114,32,95,44,32,112,97,114,116,105,97,108,32,105,110,32,105,112,97,105,114,115,40,32,99,111,109,112,108,101,116,101,32,41,32,100,111,10,9,9,9,97,99,116,105,111,110,46,108,105,110,101,115,32,61,32,110,117,109,98,101,114,32,45,32,112,97,114,116,105,97,108,46,115,116,97,114,116,32,43,32,49,10,10,9,9,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,120,112,99,97,108,108,40,32,97,99,116,105,111,110,46,99,97,108,108,98,97,99,107,44,32,100,101,98,117,103,46,116,114,97,99,101,98,97,99,107,44,32,116,97,98,108,101,46,117,110,112,97,99,107,40,32,112,97,114,116,105,97,108,46,99,97,112,116,117,114,101,115,32,41,32,41,10,9,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,97,99,116,105,111,110,32,99,97,108,108,98,97,99,107,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,109,117,108,116,105,65,99,116,105,111,110,40,32,112,97,116,116,101,114,110,115,44,32,99,97,108,108,98,97,99,107,44,32,111,112,116,115,32,41,10,9,101,110,102,111,114,99,101,40,32,112,97,116,116,101,114,110,115,44,32,34,112,97,116,116,101,114,110,115,34,44,32,34,116,97,98,108,101,34,32,41,10,9,101,110,102,111,114,99,101,40,32,99,97,108,108,98,97,99,107,44,32,34,99,97,108,108,98,97,99,107,34,44,32,34,102,117,110,99,116,105,111,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,105,102,32,35,112,97,116,116,101,114,110,115,32,61,61,32,48,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,109,117,108,116,105,45,108,105,110,101,32,97,99,116,105,111,110,115,32,110,101,101,100,32,97,116,32,108,101,97,115,116,32,111,110,101,32,112,97,116,116,101,114,110,34,44,32,50,32,41,10,9,101,110,100,10,10,9,102,111,114,32,95,44,32,112,97,116,116,101,114,110,32,105,110,32,105,112,97,105,114,115,40,32,112,97,116,116,101,114,110,115,32,41,32,100,111,10,9,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,112,99,97,108,108,40,32,115,116,114,105,110,103,46,102,105,110,100,44,32,34,34,44,32,112,97,116,116,101,114,110,32,41,10,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,101,114,114,111,114,40,32,101,114,114,44,32,50,32,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,108,111,99,97,108,32,119,105,116,104,105,110,32,61,32,35,112,97,116,116,101,114,110,115,10,9,105,102,32,116,121,112,101,40,32,111,112,116,115,32,41,32,61,61,32,34,116,97,98,108,101,34,32,116,104,101,110,10,9,9,119,105,116,104,105,110,32,61,32,111,112,116,115,46,119,105,116,104,105,110,32,111,114,32,119,105,116,104,105,110,10,10,9,9,105,102,32,116,121,112,101,40,32,119,105,116,104,105,110,32,41,32,126,61,32,34,110,117,109,98,101,114,34,32,111,114,32,119,105,116,104,105,110,32,60,32,35,112,97,116,116,101,114,110,115,32,111,114,32,119,105,116,104,105,110,32,62,32,109,117,100,46,114,101,99,101,110,116,76,105,110,101,76,105,109,105,116,32,116,104,101,110,10,9,9,9,101,114,114,111,114,40,32,34,119,105,116,104,105,110,32,115,104,111,117,108,100,32,98,101,32,97,32,110,117,109,98,101,114,32,98,101,116,119,101,101,110,32,37,100,32,97,110,100,32,37,100,34,32,37,32,123,32,35,112,97,116,116,101,114,110,115,44,32,109,117,100,46,114,101,99,101,110,116,76,105,110,101,76,105,109,105,116,32,125,44,32,50,32,41,10,9,9,101,110,100,10,10,9,9,105,102,32,111,112,116,115,46,108,105,116,101,114,97,108,32,116,104,101,110,10,9,9,9,101,114,114,111,114,40,32,34,109,117,108,116,105,45,108,105,110,101,32,97,99,116,105,111,110,115,32,99,97,110,39,116,32,104,97,118,101,32,97,32,108,105,116,101,114,97,108,34,44,32,50,32,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,105,102,32,116,121,112,101,40,32,99,97,108,108,98,97,99,107,32,41,32,61,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,108,111,99,97,108,32,99,111,109,109,97,110,100,32,61,32,99,97,108,108,98,97,99,107,10,10,9,9,99,97,108,108,98,97,99,107,32,61,32,102,117,110,99,116,105,111,110,40,41,10,9,9,9,109,117,100,46,105,110,112,117,116,40,32,99,111,109,109,97,110,100,44,32,116,114,117,101,32,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,108,111,99,97,108,32,97,99,116,105,111,110,32,61,32,116,114,105,103,103,101,114,46,97,100,100,40,32,77,117,108,116,105,65,99,116,105,111,110,115,44,32,123,10,9,9,112,97,116,116,101,114,110,115,32,61,32,112,97,116,116,101,114,110,115,44,10,9,9,99,97,108,108,98,97,99,107,32,61,32,99,97,108,108,98,97,99,107,44,10,9,9,119,105,116,104,105,110,32,61,32,119,105,116,104,105,110,44,10,9,9,112,97,114,116,105,97,108,115,32,61,32,123,32,125,44,10,9,9,108,105,110,101,115,32,61,32,48,44,10,9,125,44,32,111,112,116,115,32,41,10,10,9,114,101,116,117,114,110,32,97,99,116,105,111,110,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,114,117,110,77,117,108,116,105,40,32,97,99,116,105,111,110,44,32,108,105,110,101,32,41,10,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,112,99,97,108,108,40,32,115,116,101,112,77,117,108,116,105,44,32,97,99,116,105,111,110,44,32,108,105,110,101,32,41,10,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,97,99,116,105,111,110,32,99,97,108,108,98,97,99,107,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,9,9,97,99,116,105,111,110,46,112,97,114,116,105,97,108,115,32,61,32,123,32,125,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,111,77,117,108,116,105,65,99,116,105,111,110,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,116,114,105,103,103,101,114,46,100,105,115,112,97,116,99,104,40,32,77,117,108,116,105,65,99,116,105,111,110,115,44,32,108,105,110,101,44,32,112,114,111,109,112,116,44,32,114,117,110,77,117,108,116,105,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,111,87,97,105,116,115,40,32,108,105,110,101,32,41,10,9,108,111,99,97,108,32,110,32,61,32,35,87,97,105,116,101,114,115,10,9,105,102,32,110,32,61,61,32,48,32,116,104,101,110,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,45,45,32,119,97,105,116,101,114,115,32,114,101,103,105,115,116,101,114,101,100,32,98,121,32,114,101,115,117,109,101,100,32,99,111,114,111,117,116,105,110,101,115,32,115,104,111,117,108,100,32,119,97,105,116,32,102,111,114,32,116,104,101,32,110,101,120,116,32,108,105,110,101,10,9,108,111,99,97,108,32,114,101,97,100,121,10,9,108,111,99,97,108,32,107,101,112,116,32,61,32,48,10,10,9,102,111,114,32,105,32,61,32,49,44,32,110,32,100,111,10,9,9,108,111,99,97,108,32,119,97,105,116,101,114,32,61,32,87,97,105,116,101,114,115,91,32,105,32,93,10,9,9,87,97,105,116,101,114,115,91,32,105,32,93,32,61,32,110,105,108,10,10,9,9,105,102,32,108,105,110,101,58,102,105,110,100,40,32,119,97,105,116,101,114,46,112,97,116,116,101,114,110,32,41,32,116,104,101,110,10,9,9,9,119,97,105,116,101,114,46,99,97,112,116,117,114,101,115,32,61,32,123,32,108,105,110,101,58,109,97,116,99,104,40,32,119,97,105,116,101,114,46,112,97,116,116,101,114,110,32,41,32,125,10,9,9,9,114,101,97,100,121,32,61,32,114,101,97,100,121,32,111,114,32,123,32,125,10,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,114,101,97,100,121,44,32,119,97,105,116,101,114,32,41,10,9,9,101,108,115,101,10,9,9,9,107,101,112,116,32,61,32,107,101,112,116,32,43,32,49,10,9,9,9,87,97,105,116,101,114,115,91,32,107,101,112,116,32,93,32,61,32,119,97,105,116,101,114,10,9,9,101,110,100,10,9,101,110,100,10,10,9,105,102,32,114,101,97,100,121,32,116,104,101,110,10,9,9,102,111,114,32,95,44,32,119,97,105,116,101,114,32,105,110,32,105,112,97,105,114,115,40,32,114,101,97,100,121,32,41,32,100,111,10,9,9,9,105,102,32,119,97,105,116,101,114,46,116,105,109,101,114,32,116,104,101,110,10,9,9,9,9,116,105,109,101,114,46,99,97,110,99,101,108,40,32,119,97,105,116,101,114,46,116,105,109,101,114,32,41,10,9,9,9,101,110,100,10,10,9,9,9,116,105,109,101,114,46,114,101,115,117,109,101,40,32,119,97,105,116,101,114,46,99,111,44,32,116,97,98,108,101,46,117,110,112,97,99,107,40,32,119,97,105,116,101,114,46,99,97,112,116,117,114,101,115,32,41,32,41,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,119,97,105,116,70,111,114,40,32,112,97,116,116,101,114,110,44,32,116,105,109,101,111,117,116,32,41,10,9,101,110,102,111,114,99,101,40,32,112,97,116,116,101,114,110,44,32,34,112,97,116,116,101,114,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,116,105,109,101,111,117,116,44,32,34,116,105,109,101,111,117,116,34,44,32,34,110,117,109,98,101,114,34,44,32,34,110,105,108,34,32,41,10,10,9,108,111,99,97,108,32,99,111,32,61,32,116,105,109,101,114,46,99,117,114,114,101,110,116,67,111,114,111,117,116,105,110,101,40,32,34,109,117,100,46,119,97,105,116,70,111,114,34,32,41,10,10,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,112,99,97,108,108,40,32,115,116,114,105,110,103,46,102,105,110,100,44,32,34,34,44,32,112,97,116,116,101,114,110,32,41,10,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,101,114,114,44,32,50,32,41,10,9,101,110,100,10,10,9,108,111,99,97,108,32,119,97,105,116,101,114,32,61,32,123,10,9,9,112,97,116,116,101,114,110,32,61,32,112,97,116,116,101,114,110,44,10,9,9,99,111,32,61,32,99,111,44,10,9,125,10,10,9,105,102,32,116,105,109,101,111,117,116,32,116,104,101,110,10,9,9,119,97,105,116,101,114,46,116,105,109,101,114,32,61,32,116,105,109,101,114,46,97,100,100,40,32,109,117,100,46,110,111,119,40,41,32,43,32,116,105,109,101,111,117,116,44,32,102,117,110,99,116,105,111,110,40,41,10,9,9,9,102,111,114,32,105,44,32,111,116,104,101,114,32,105,110,32,105,112,97,105,114,115,40,32,87,97,105,116,101,114,115,32,41,32,100,111,10,9,9,9,9,105,102,32,111,116,104,101,114,32,61,61,32,119,97,105,116,101,114,32,116,104,101,110,10,9,9,9,9,9,116,97,98,108,101,46,114,101,109,111,118,101,40,32,87,97,105,116,101,114,115,44,32,105,32,41,10,9,9,9,9,9,98,114,101,97,107,10,9,9,9,9,101,110,100,10,9,9,9,101,110,100,10,10,9,9,9,116,105,109,101,114,46,114,101,115,117,109,101,40,32,99,111,44,32,110,105,108,32,41,10,9,9,101,110,100,32,41,10,9,101,110,100,10,10,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,87,97,105,116,101,114,115,44,32,119,97,105,116,101,114,32,41,10,10,9,114,101,116,117,114,110,32,99,111,114,111,117,116,105,110,101,46,121,105,101,108,100,40,41,10,101,110,100,10,10,109,117,100,46,97,99,116,105,111,110,44,32,32,32,32,32,32,32,32,100,111,65,99,116,105,111,110,115,32,32,32,32,32,32,32,32,61,32,103,101,110,101,114,105,99,65,99,116,105,111,110,115,40,32,65,99,116,105,111,110,115,32,41,10,109,117,100,46,112,114,101,65,99,116,105,111,110,44,32,32,32,32,32,100,111,80,114,101,65,99,116,105,111,110,115,32,32,32,32,32,61,32,103,101,110,101,114,105,99,65,99,116,105,111,110,115,40,32,80,114,101,65,99,116,105,111,110,115,32,41,10,109,117,100,46,97,110,115,105,65,99,116,105,111,110,44,32,32,32,32,100,111,65,110,115,105,65,99,116,105,111,110,115,32,32,32,32,61,32,103,101,110,101,114,105,99,65,99,116,105,111,110,115,40,32,65,110,115,105,65,99,116,105,111,110,115,32,41,10,109,117,100,46,97,110,115,105,80,114,101,65,99,116,105,111,110,44,32,100,111,65,110,115,105,80,114,101,65,99,116,105,111,110,115,32,61,32,103,101,110,101,114,105,99,65,99,116,105,111,110,115,40,32,65,110,115,105,80,114,101,65,99,116,105,111,110,115,32,41,10,10,109,117,100,46,99,104,97,116,65,99,116,105,111,110,44,32,32,32,32,32,32,32,32,100,111,67,104,97,116,65,99,116,105,111,110,115,32,32,32,32,32,32,32,32,61,32,103,101,110,101,114,105,99,65,99,116,105,111,110,115,40,32,67,104,97,116,65,99,116,105,111,110,115,32,41,10,109,117,100,46,112,114,101,67,104,97,116,65,99,116,105,111,110,44,32,32,32,32,32,100,111,67,104,97,116,80,114,101,65,99,116,105,111,110,115,32,32,32,32,32,61,32,103,101,110,101,114,105,99,65,99,116,105,111,110,115,40,32,67,104,97,116,80,114,101,65,99,116,105,111,110,115,32,41,10,109,117,100,46,97,110,115,105,67,104,97,116,65,99,116,105,111,110,44,32,32,32,32,100,111,67,104,97,116,65,110,115,105,65,99,116,105,111,110,115,32,32,32,32,61,32,103,101,110,101,114,105,99,65,99,116,105,111,110,115,40,32,67,104,97,116,65,110,115,105,65,99,116,105,111,110,115,32,41,10,109,117,100,46,97,110,115,105,80,114,101,67,104,97,116,65,99,116,105,111,110,44,32,100,111,67,104,97,116,65,110,115,105,80,114,101,65,99,116,105,111,110,115,32,61,32,103,101,110,101,114,105,99,65,99,116,105,111,110,115,40,32,67,104,97,116,65,110,115,105,80,114,101,65,99,116,105,111,110,115,32,41,10,10,114,101,116,117,114,110,32,123,10,9,100,111,65,99,116,105,111,110,115,32,61,32,100,111,65,99,116,105,111,110,115,44,10,9,100,111,80,114,101,65,99,116,105,111,110,115,32,61,32,100,111,80,114,101,65,99,116,105,111,110,115,44,10,9,100,111,65,110,115,105,65,99,116,105,111,110,115,32,61,32,100,111,65,110,115,105,65,99,116,105,111,110,115,44,10,9,100,111,65,110,115,105,80,114,101,65,99,116,105,111,110,115,32,61,32,100,111,65,110,115,105,80,114,101,65,99,116,105,111,110,115,44,10,10,9,100,111,77,117,108,116,105,65,99,116,105,111,110,115,32,61,32,100,111,77,117,108,116,105,65,99,116,105,111,110,115,44,10,9,100,111,87,97,105,116,115,32,61,32,100,111,87,97,105,116,115,44,10,10,9,100,111,67,104,97,116,65,99,116,105,111,110,115,32,61,32,100,111,67,104,97,116,65,99,116,105,111,110,115,44,10,9,100,111,67,104,97,116,80,114,101,65,99,116,105,111,110,115,32,61,32,100,111,67,104,97,116,80,114,101,65,99,116,105,111,110,115,44,10,9,100,111,67,104,97,116,65,110,115,105,65,99,116,105,111,110,115,32,61,32,100,111,67,104,97,116,65,110,115,105,65,99,116,105,111,110,115,44,10,9,100,111,67,104,97,116,65,110,115,105,80,114,101,65,99,116,105,111,110,115,32,61,32,100,111,67,104,97,116,65,110,115,105,80,114,101,65,99,116,105,111,110,115,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,105,110,116,101,114,118,97,108,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,116,105,109,101,114,32,61,32,114,101,113,117,105,114,101,40,32,34,116,105,109,101,114,34,32,41,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,99,104,101,100,117,108,101,40,32,101,118,101,110,116,32,41,10,9,105,102,32,101,118,101,110,116,46,116,105,109,101,114,32,116,104,101,110,10,9,9,116,105,109,101,114,46,99,97,110,99,101,108,40,32,101,118,101,110,116,46,116,105,109,101,114,32,41,10,9,9,101,118,101,110,116,46,116,105,109,101,114,32,61,32,110,105,108,10,9,101,110,100,10,10,9,105,102,32,101,118,101,110,116,46,101,110,97,98,108,101,100,32,116,104,101,110,10,9,9,101,118,101,110,116,46,116,105,109,101,114,32,61,32,116,105,109,101,114,46,97,100,100,40,32,101,118,101,110,116,46,110,101,120,116,84,105,99,107,44,32,101,118,101,110,116,46,102,105,114,101,32,41,10,9,101,110,100,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,105,110,116,101,114,118,97,108,40,32,99,97,108,108,98,97,99,107,44,32,105,110,116,101,114,118,97,108,44,32,100,105,115,97,98,108,101,100,32,41,10,9,101,110,102,111,114,99,101,40,32,99,97,108,108,98,97,99,107,44,32,34,99,97,108,108,98,97,99,107,34,44,32,34,102,117,110,99,116,105,111,110,34,32,41,10,9,101,110,102,111,114,99,101,40,32,105,110,116,101,114,118,97,108,44,32,34,105,110,116,101,114,118,97,108,34,44,32,34,110,117,109,98,101,114,34,32,41,10,10,9,108,111,99,97,108,32,101,118,101,110,116,32,61,32,123,10,9,9,99,97,108,108,98,97,99,107,32,61,32,99,97,108,108,98,97,99,107,44,10,9,9,105,110,116,101,114,118,97,108,32,61,32,105,110,116,101,114,118,97,108,44,10,9,9,110,101,120,116,84,105,99,107,32,61,32,109,117,100,46,110,111,119,40,41,44,10,10,9,9,101,110,97,98,108,101,100,32,61,32,110,111,116,32,100,105,115,97,98,108,101,100,44,10,10,9,9,101,110,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,105,102,32,110,111,116,32,115,101,108,102,46,101,110,97,98,108,101,100,32,116,104,101,110,10,9,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,116,114,117,101,10,9,9,9,9,115,99,104,101,100,117,108,101,40,32,115,101,108,102,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,44,10,9,9,100,105,115,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,105,102,32,115,101,108,102,46,101,110,97,98,108,101,100,32,116,104,101,110,10,9,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,102,97,108,115,101,10,9,9,9,9,115,99,104,101,100,117,108,101,40,32,115,101,108,102,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,44,10,10,9,9,116,105,99,107,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,44,32,110,111,119,32,41,10,9,9,9,45,45,32,98,101,102,111,114,101,32,116,104,101,32,99,97,108,108,98,97,99,107,32,115,111,32,105,116,32,99,97,110,32,116,101,110,100,32,117,115,10,9,9,9,115,101,108,102,46,110,101,120,116,84,105,99,107,32,61,32,110,111,119,32,43,32,115,101,108,102,46,105,110,116,101,114,118,97,108,10,10,9,9,9,99,97,108,108,98,97,99,107,40,32,110,111,119,32,41,10,9,9,101,110,100,44,10,10,9,9,99,104,101,99,107,84,105,99,107,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,44,32,110,111,119,32,41,10,9,9,9,105,102,32,115,101,108,102,46,110,101,120,116,84,105,99,107,32,61,61,32,45,49,32,116,104,101,110,10,9,9,9,9,115,101,108,102,46,110,101,120,116,84,105,99,107,32,61,32,110,111,119,10,9,9,9,101,110,100,10,10,9,9,9,105,102,32,110,111,119,32,62,61,32,115,101,108,102,46,110,101,120,116,84,105,99,107,32,116,104,101,110,10,9,9,9,9,115,101,108,102,58,116,105,99,107,40,32,110,111,119,32,41,10,9,9,9,101,110,100,10,10,9,9,9,115,99,104,101,100,117,108,101,40,32,115,101,108,102,32,41,10,9,9,101,110,100,44,10,10,9,9,116,101,110,100,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,44,32,116,111,108,101,114,97,110,99,101,44,32,100,101,115,105,114,101,100,32,41,10,9,9,9,116,111,108,101,114,97,110,99,101,32,61,32,116,111,108,101,114,97,110,99,101,32,111,114,32,48,10,9,9,9,100,101,115,105,114,101,100,32,61,32,100,101,115,105,114,101,100,32,111,114,32,109,117,100,46,110,111,119,40,41,10,10,9,9,9,108,111,99,97,108,32,116,111,84,105,99,107,32,61,32,40,32,115,101,108,102,46,110,101,120,116,84,105,99,107,32,45,32,100,101,115,105,114,101,100,32,41,32,37,32,115,101,108,102,46,105,110,116,101,114,118,97,108,10,9,9,9,108,111,99,97,108,32,115,105,110,99,101,84,105,99,107,32,61,32,115,101,108,102,46,105,110,116,101,114,118,97,108,32,45,32,116,111,84,105,99,107,10,10,9,9,9,105,102,32,116,111,84,105,99,107,32,60,61,32,116,111,108,101,114,97,110,99,101,32,116,104,101,110,10,9,9,9,9,115,101,108,102,46,110,101,120,116,84,105,99,107,32,61,32,109,97,116,104,46,97,118,103,40,32,115,101,108,102,46,110,101,120,116,84,105,99,107,44,32,100,101,115,105,114,101,100,32,41,10,9,9,9,9,115,99,104,101,100,117,108,101,40,32,115,101,108,102,32,41,10,9,9,9,101,108,115,101,105,102,32,115,105,110,99,101,84,105,99,107,32,60,61,32,116,111,108,101,114,97,110,99,101,32,116,104,101,110,10,9,9,9,9,115,101,108,102,46,110,101,120,116,84,105,99,107,32,61,32,109,97,116,104,46,97,118,103,40,32,115,101,108,102,46,110,101,120,116,84,105,99,107,44,32,100,101,115,105,114,101,100,32,43,32,115,101,108,102,46,105,110,116,101,114,118,97,108,32,41,10,9,9,9,9,115,99,104,101,100,117,108,101,40,32,115,101,108,102,32,41,10,9,9,9,101,108,115,101,10,9,9,9,9,115,101,108,102,46,110,101,120,116,84,105,99,107,32,61,32,100,101,115,105,114,101,100,10,10,9,9,9,9,115,101,108,102,58,99,104,101,99,107,84,105,99,107,40,32,109,117,100,46,110,111,119,40,41,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,44,10,9,125,10,10,9,101,118,101,110,116,46,102,105,114,101,32,61,32,102,117,110,99,116,105,111,110,40,32,110,111,119,32,41,10,9,9,101,118,101,110,116,46,116,105,109,101,114,32,61,32,110,105,108,10,10,9,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,120,112,99,97,108,108,40,32,101,118,101,110,116,46,116,105,99,107,44,32,100,101,98,117,103,46,116,114,97,99,101,98,97,99,107,44,32,101,118,101,110,116,44,32,110,111,119,32,41,10,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,105,110,116,101,114,118,97,108,32,99,97,108,108,98,97,99,107,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,9,9,101,110,100,10,10,9,9,45,45,32,116,104,101,32,99,97,108,108,98,97,99,107,32,109,105,103,104,116,32,104,97,118,101,32,116,101,110,100,101,100,32,111,114,32,100,105,115,97,98,108,101,100,32,117,115,44,32,115,111,32,97,108,119,97,121,115,32,103,111,32,98,121,10,9,9,45,45,32,110,101,120,116,84,105,99,107,32,97,110,100,32,101,110,97,98,108,101,100,32,114,97,116,104,101,114,32,116,104,97,110,32,119,104,97,116,101,118,101,114,32,105,116,32,115,99,104,101,100,117,108,101,100,10,9,9,115,99,104,101,100,117,108,101,40,32,101,118,101,110,116,32,41,10,9,101,110,100,10,10,9,115,99,104,101,100,117,108,101,40,32,101,118,101,110,116,32,41,10,10,9,114,101,116,117,114,110,32,101,118,101,110,116,10,101,110,100,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,104,97,110,100,108,101,114,115,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,97,99,116,105,111,110,32,61,32,114,101,113,117,105,114,101,40,32,34,97,99,116,105,111,110,34,32,41,10,108,111,99,97,108,32,97,108,105,97,115,32,61,32,114,101,113,117,105,114,101,40,32,34,97,108,105,97,115,34,32,41,10,108,111,99,97,108,32,105,110,116,101,114,99,101,112,116,32,61,32,114,101,113,117,105,114,101,40,32,34,105,110,116,101,114,99,101,112,116,34,32,41,10,108,111,99,97,108,32,103,97,103,32,61,32,114,101,113,117,105,114,101,40,32,34,103,97,103,34,32,41,10,108,111,99,97,108,32,109,97,99,114,111,32,61,32,114,101,113,117,105,114,101,40,32,34,109,97,99,114,111,34,32,41,10,108,111,99,97,108,32,115,117,98,32,61,32,114,101,113,117,105,114,101,40,32,34,115,117,98,34,32,41,10,108,111,99,97,108,32,116,105,109,101,114,32,61,32,114,101,113,117,105,114,101,40,32,34,116,105,109,101,114,34,32,41,10,108,111,99,97,108,32,119,105,110,100,111,119,32,61,32,114,101,113,117,105,114,101,40,32,34,119,105,110,100,111,119,34,32,41,10,10,108,111,99,97,108,32,108,112,101,103,32,61,32,114,101,113,117,105,114,101,40,32,34,108,112,101,103,34,32,41,10,10,108,111,99,97,108,32,112,114,105,110,116,76,105,110,101,10,10,45,45,32,99,111,108,111,117,114,115,32,102,111,114,32,99,104,97,116,32,109,101,115,115,97,103,101,115,44,32,108,105,110,101,115,32,102,114,111,109,32,116,104,101,32,109,117,100,32,107,101,101,112,32,116,104,101,105,114,115,32,110,97,116,105,118,101,108,121,10,108,111,99,97,108,32,98,111,108,100,32,61,32,102,97,108,115,101,10,108,111,99,97,108,32,102,103,32,61,32,55,10,108,111,99,97,108,32,98,103,32,61,32,48,10,10,108,111,99,97,108,32,108,97,115,116,87,97,115,67,104,97,116,32,61,32,102,97,108,115,101,10,108,111,99,97,108,32,108,97,115,116,87,97,115,71,65,32,61,32,102,97,108,115,101,10,10,108,111,99,97,108,32,114,101,99,101,105,118,105,110,103,32,61,32,102,97,108,115,101,10,108,111,99,97,108,32,115,104,111,119,73,110,112,117,116,32,61,32,116,114,117,101,10,10,108,111,99,97,108,32,112,101,110,100,105,110,103,73,110,112,117,116,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,101,116,70,71,40,32,99,111,108,111,117,114,32,41,10,9,114,101,116,117,114,110,32,102,117,110,99,116,105,111,110,40,41,10,9,9,102,103,32,61,32,99,111,108,111,117,114,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,101,116,66,71,40,32,99,111,108,111,117,114,32,41,10,9,114,101,116,117,114,110,32,102,117,110,99,116,105,111,110,40,41,10,9,9,98,103,32,61,32,99,111,108,111,117,114,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,69,115,99,97,112,101,115,32,61,32,123,10,9,109,32,61,32,123,10,9,9,91,32,34,48,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,41,10,9,9,9,98,111,108,100,32,61,32,102,97,108,115,101,10,9,9,9,102,103,32,61,32,55,10,9,9,9,98,103,32,61,32,48,10,9,9,101,110,100,44,10,10,9,9,91,32,34,49,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,41,10,9,9,9,98,111,108,100,32,61,32,116,114,117,101,10,9,9,101,110,100,44,10,10,9,9,91,32,34,51,48,34,32,93,32,61,32,115,101,116,70,71,40,32,48,32,41,44,10,9,9,91,32,34,51,49,34,32,93,32,61,32,115,101,116,70,71,40,32,49,32,41,44,10,9,9,91,32,34,51,50,34,32,93,32,61,32,115,101,116,70,71,40,32,50,32,41,44,10,9,9,91,32,34,51,51,34,32,93,32,61,32,115,101,116,70,71,40,32,51,32,41,44,10,9,9,91,32,34,51,52,34,32,93,32,61,32,115,101,116,70,71,40,32,52,32,41,44,10,9,9,91,32,34,51,53,34,32,93,32,61,32,115,101,116,70,71,40,32,53,32,41,44,10,9,9,91,32,34,51,54,34,32,93,32,61,32,115,101,116,70,71,40,32,54,32,41,44,10,9,9,91,32,34,51,55,34,32,93,32,61,32,115,101,116,70,71,40,32,55,32,41,44,10,10,9,9,91,32,34,52,48,34,32,93,32,61,32,115,101,116,66,71,40,32,48,32,41,44,10,9,9,91,32,34,52,49,34,32,93,32,61,32,115,101,116,66,71,40,32,49,32,41,44,10,9,9,91,32,34,52,50,34,32,93,32,61,32,115,101,116,66,71,40,32,50,32,41,44,10,9,9,91,32,34,52,51,34,32,93,32,61,32,115,101,116,66,71,40,32,51,32,41,44,10,9,9,91,32,34,52,52,34,32,93,32,61,32,115,101,116,66,71,40,32,52,32,41,44,10,9,9,91,32,34,52,53,34,32,93,32,61,32,115,101,116,66,71,40,32,53,32,41,44,10,9,9,91,32,34,52,54,34,32,93,32,61,32,115,101,116,66,71,40,32,54,32,41,44,10,9,9,91,32,34,52,55,34,32,93,32,61,32,115,101,116,66,71,40,32,55,32,41,44,10,9,125,44,10,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,112,114,105,110,116,80,101,110,100,105,110,103,73,110,112,117,116,115,40,41,10,9,105,102,32,108,97,115,116,87,97,115,67,104,97,116,32,116,104,101,110,10,9,9,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,40,41,10,10,9,9,108,97,115,116,87,97,115,67,104,97,116,32,61,32,102,97,108,115,101,10,9,101,110,100,10,10,9,102,111,114,32,105,32,61,32,49,44,32,35,112,101,110,100,105,110,103,73,110,112,117,116,115,32,100,111,10,9,9,109,117,100,46,112,114,105,110,116,114,40,32,112,101,110,100,105,110,103,73,110,112,117,116,115,91,32,105,32,93,32,41,10,10,9,9,108,97,115,116,87,97,115,71,65,32,61,32,102,97,108,115,101,10,9,101,110,100,10,10,9,112,101,110,100,105,110,103,73,110,112,117,116,115,32,61,32,123,32,125,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,104,97,110,100,108,101,67,104,97,116,40,32,109,101,115,115,97,103,101,32,41,10,9,105,102,32,110,111,116,32,109,101,115,115,97,103,101,32,116,104,101,110,10,9,9,108,97,115,116,87,97,115,67,104,97,116,32,61,32,116,114,117,101,10,9,9,108,97,115,116,87,97,115,71,65,32,61,32,102,97,108,115,101,10,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,108,111,99,97,108,32,110,111,65,110,115,105,32,61,32,109,101,115,115,97,103,101,58,103,115,117,98,40,32,34,92,50,55,37,91,91,37,100,59,93,42,37,97,34,44,32,34,34,32,41,10,10,9,108,111,99,97,108,32,103,97,103,103,101,100,32,61,32,103,97,103,46,100,111,67,104,97,116,71,97,103,115,40,32,110,111,65,110,115,105,32,41,32,111,114,32,103,97,103,46,100,111,67,104,97,116,65,110,115,105,71,97,103,115,40,32,109,101,115,115,97,103,101,32,41,10,10,9,97,99,116,105,111,110,46,100,111,67,104,97,116,80,114,101,65,99,116,105,111,110,115,40,32,110,111,65,110,115,105,32,41,10,9,97,99,116,105,111,110,46,100,111,67,104,97,116,65,110,115,105,80,114,101,65,99,116,105,111,110,115,40,32,109,101,115,115,97,103,101,32,41,10,10,9,105,102,32,110,111,116,32,103,97,103,103,101,100,32,116,104,101,110,10,9,9,108,97,115,116,87,97,115,67,104,97,116,32,61,32,116,114,117,101,10,9,9,108,97,115,116,87,97,115,71,65,32,61,32,102,97,108,115,101,10,10,9,9,108,111,99,97,108,32,111,108,100,70,71,32,61,32,102,103,10,9,9,108,111,99,97,108,32,111,108,100,66,71,32,61,32,98,103,10,9,9,108,111,99,97,108,32,111,108,100,66,111,108,100,32,61,32,98,111,108,100,10,10,9,9,102,103,32,61,32,49,10,9,9,98,103,32,61,32,48,10,9,9,98,111,108,100,32,61,32,116,114,117,101,10,10,9,9,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,40,41,10,9,9,109,117,100,46,110,101,119,108,105,110,101,67,104,97,116,40,41,10,10,9,9,102,111,114,32,108,105,110,101,44,32,110,101,119,76,105,110,101,32,105,110,32,109,101,115,115,97,103,101,58,103,109,97,116,99,104,40,32,34,40,91,94,92,110,93,42,41,40,92,110,63,41,34,32,41,32,100,111,10,9,9,9,102,111,114,32,116,101,120,116,44,32,111,112,116,115,44,32,101,115,99,97,112,101,32,105,110,32,40,32,108,105,110,101,32,46,46,32,34,92,50,55,91,109,34,32,41,58,103,109,97,116,99,104,40,32,34,40,46,45,41,92,50,55,37,91,40,91,37,100,59,93,42,41,40,37,97,41,34,32,41,32,100,111,10,9,9,9,9,105,102,32,116,101,120,116,32,126,61,32,34,34,32,116,104,101,110,10,9,9,9,9,9,109,117,100,46,112,114,105,110,116,77,97,105,110,40,32,116,101,120,116,44,32,102,103,44,32,98,103,44,32,98,111,108,100,32,41,10,9,9,9,9,9,109,117,100,46,112,114,105,110,116,67,104,97,116,40,32,116,101,120,116,44,32,102,103,44,32,98,103,44,32,98,111,108,100,32,41,10,9,9,9,9,101,110,100,10,10,9,9,9,9,102,111,114,32,111,112,116,32,105,110,32,111,112,116,115,58,103,109,97,116,99,104,40,32,34,40,91,94,59,93,43,41,34,32,41,32,100,111,10,9,9,9,9,9,105,102,32,69,115,99,97,112,101,115,91,32,101,115,99,97,112,101,32,93,91,32,111,112,116,32,93,32,116,104,101,110,10,9,9,9,9,9,9,69,115,99,97,112,101,115,91,32,101,115,99,97,112,101,32,93,91,32,111,112,116,32,93,40,41,10,9,9,9,9,9,101,110,100,10,9,9,9,9,101,110,100,10,9,9,9,101,110,100,10,10,9,9,9,105,102,32,110,101,119,76,105,110,101,32,61,61,32,34,92,110,34,32,116,104,101,110,10,9,9,9,9,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,40,41,10,9,9,9,9,109,117,100,46,110,101,119,108,105,110,101,67,104,97,116,40,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,10,9,9,102,103,32,61,32,111,108,100,70,71,10,9,9,98,103,32,61,32,111,108,100,66,71,10,9,9,98,111,108,100,32,61,32,111,108,100,66,111,108,100,10,9,101,110,100,10,10,9,97,99,116,105,111,110,46,100,111,67,104,97,116,65,99,116,105,111,110,115,40,32,110,111,65,110,115,105,32,41,10,9,97,99,116,105,111,110,46,100,111,67,104,97,116,65,110,115,105,65,99,116,105,111,110,115,40,32,109,101,115,115,97,103,101,32,41,10,101,110,100,10,10,45,45,32,108,105,110,101,32,105,115,32,97,32,110,97,116,105,118,101,32,108,105,110,101,32,111,98,106,101,99,116,44,32,115,101,101,32,108,105,110,101,58,116,101,120,116,40,41,47,108,105,110,101,58,114,97,119,40,41,47,108,105,110,101,58,102,105,110,100,40,41,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,104,97,110,100,108,101,76,105,110,101,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,114,101,99,101,105,118,105,110,103,32,61,32,116,114,117,101,10,10,9,105,102,32,108,97,115,116,87,97,115,71,65,32,116,104,101,110,10,9,9,105,102,32,35,108,105,110,101,32,62,32,48,32,116,104,101,110,10,9,9,9,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,40,41,10,9,9,101,110,100,10,10,9,9,108,97,115,116,87,97,115,71,65,32,61,32,102,97,108,115,101,10,9,101,110,100,10,10,9,105,102,32,108,97,115,116,87,97,115,67,104,97,116,32,116,104,101,110,10,9,9,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,40,41,10,10,9,9,108,97,115,116,87,97,115,67,104,97,116,32,61,32,102,97,108,115,101,10,9,101,110,100,10,10,9,108,111,99,97,108,32,103,97,103,103,101,100,32,61,32,103,97,103,46,100,111,71,97,103,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,32,111,114,32,103,97,103,46,100,111,65,110,115,105,71,97,103,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,10,9,97,99,116,105,111,110,46,100,111,80,114,101,65,99,116,105,111,110,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,97,99,116,105,111,110,46,100,111,65,110,115,105,80,114,101,65,99,116,105,111,110,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,10,9,115,117,98,46,100,111,83,117,98,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,10,9,105,102,32,119,105,110,100,111,119,46,100,111,82,111,117,116,101,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,32,116,104,101,110,10,9,9,103,97,103,103,101,100,32,61,32,116,114,117,101,10,9,101,110,100,10,10,9,112,114,105,110,116,76,105,110,101,40,32,108,105,110,101,44,32,103,97,103,103,101,100,32,41,10,10,9,105,102,32,112,114,111,109,112,116,32,116,104,101,110,10,9,9,108,97,115,116,87,97,115,71,65,32,61,32,116,114,117,101,10,9,9,114,101,99,101,105,118,105,110,103,32,61,32,102,97,108,115,101,10,9,9,112,114,105,110,116,80,101,110,100,105,110,103,73,110,112,117,116,115,40,41,10,9,101,108,115,101,10,9,9,105,102,32,110,111,116,32,103,97,103,103,101,100,32,116,104,101,110,10,9,9,9,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,40,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,97,99,116,105,111,110,46,100,111,65,99,116,105,111,110,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,97,99,116,105,111,110,46,100,111,65,110,115,105,65,99,116,105,111,110,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,97,99,116,105,111,110,46,100,111,77,117,108,116,105,65,99,116,105,111,110,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,97,99,116,105,111,110,46,100,111,87,97,105,116,115,40,32,108,105,110,101,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,104,97,110,100,108,101,69,99,104,111,40,32,101,99,104,111,32,41,10,9,115,104,111,119,73,110,112,117,116,32,61,32,101,99,104,111,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,104,97,110,100,108,101,67,111,109,109,97,110,100,40,32,105,110,112,117,116,44,32,104,105,100,101,32,41,10,9,105,102,32,110,111,116,32,97,108,105,97,115,46,100,111,65,108,105,97,115,40,32,105,110,112,117,116,32,41,32,116,104,101,110,10,9,9,105,102,32,110,111,116,32,109,117,100,46,99,111,110,110,101,99,116,101,100,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,89,111,117,39,114,101,32,110,111,116,32,99,111,110,110,101,99,116,101,100,46,46,46,34,32,41,10,10,9,9,9,114,101,116,117,114,110,10,9,9,101,110,100,10,10,9,9,105,110,116,101,114,99,101,112,116,46,100,111,73,110,116,101,114,99,101,112,116,40,32,105,110,112,117,116,32,41,10,10,9,9,105,102,32,110,111,116,32,104,105,100,101,32,97,110,100,32,105,110,112,117,116,32,126,61,32,34,34,32,116,104,101,110,10,9,9,9,108,111,99,97,108,32,116,111,83,104,111,119,32,61,32,40,32,115,104,111,119,73,110,112,117,116,32,97,110,100,32,105,110,112,117,116,32,111,114,32,40,32,34,42,34,32,41,58,114,101,112,40,32,105,110,112,117,116,58,108,101,110,40,41,32,41,32,41,32,46,46,32,34,92,110,34,10,10,9,9,9,105,102,32,114,101,99,101,105,118,105,110,103,32,116,104,101,110,10,9,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,112,101,110,100,105,110,103,73,110,112,117,116,115,44,32,116,111,83,104,111,119,32,41,10,9,9,9,101,108,115,101,10,9,9,9,9,105,102,32,108,97,115,116,87,97,115,67,104,97,116,32,116,104,101,110,10,9,9,9,9,9,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,40,41,10,10,9,9,9,9,9,108,97,115,116,87,97,115,67,104,97,116,32,61,32,102,97,108,115,101,10,9,9,9,9,101,110,100,10,10,9,9,9,9,108,97,115,116,87,97,115,71,65,32,61,32,102,97,108,115,101,10,10,9,9,9,9,109,117,100,46,112,114,105,110,116,114,40,32,116,111,83,104,111,119,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,10,9,9,109,117,100,46,115,101,110,100,40,32,105,110,112,117,116,32,46,46,32,34,92,110,34,32,41,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,104,97,110,100,108,101,73,110,112,117,116,40,32,105,110,112,117,116,44,32,100,105,115,112,108,97,121,32,41,10,9,109,117,100,46,108,97,115,116,95,104,117,109,97,110,95,105,110,112,117,116,95,116,105,109,101,32,61,32,109,117,100,46,110,111,119,40,41,10,10,9,102,111,114,32,99,111,109,109,97,110,100,32,105,110,32,40,32,105,110,112,117,116,32,46,46,32,34,59,34,32,41,58,103,109,97,116,99,104,40,32,34,40,91,94,59,93,42,41,59,34,32,41,32,100,111,10,9,9,104,97,110,100,108,101,67,111,109,109,97,110,100,40,32,99,111,109,109,97,110,100,44,32,100,105,115,112,108,97,121,32,41,10,9,101,110,100,10,101,110,100,10,10,109,117,100,46,105,110,112,117,116,32,61,32,104,97,110,100,108,101,73,110,112,117,116,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,104,97,110,100,108,101,77,97,99,114,111,40,32,107,101,121,44,32,115,104,105,102,116,44,32,99,116,114,108,44,32,97,108,116,32,41,10,9,109,117,100,46,108,97,115,116,95,104,117,109,97,110,95,105,110,112,117,116,95,116,105,109,101,32,61,32,109,117,100,46,110,111,119,40,41,10,10,9,105,102,32,115,104,105,102,116,32,116,104,101,110,10,9,9,107,101,121,32,61,32,34,115,34,32,46,46,32,107,101,121,10,9,101,110,100,10,10,9,105,102,32,99,116,114,108,32,116,104,101,110,10,9,9,107,101,121,32,61,32,34,99,34,32,46,46,32,107,101,121,10,9,101,110,100,10,10,9,105,102,32,97,108,116,32,116,104,101,110,10,9,9,107,101,121,32,61,32,34,97,34,32,46,46,32,107,101,121,10,9,101,110,100,10,10,9,109,97,99,114,111,46,100,111,77,97,99,114,111,40,32,107,101,121,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,104,97,110,100,108,101,67,108,111,115,101,40,41,10,9,109,117,100,46,101,118,101,110,116,40,32,34,115,104,117,116,100,111,119,110,34,32,41,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,112,114,105,110,116,95,108,105,110,101,32,41,10,9,9,112,114,105,110,116,76,105,110,101,32,61,32,112,114,105,110,116,95,108,105,110,101,10,9,101,110,100,44,10,10,9,108,105,110,101,32,61,32,104,97,110,100,108,101,76,105,110,101,44,10,9,101,99,104,111,32,61,32,104,97,110,100,108,101,69,99,104,111,44,10,9,99,104,97,116,32,61,32,104,97,110,100,108,101,67,104,97,116,44,10,9,105,110,112,117,116,32,61,32,104,97,110,100,108,101,73,110,112,117,116,44,10,9,109,97,99,114,111,32,61,32,104,97,110,100,108,101,77,97,99,114,111,44,10,9,116,105,109,101,114,32,61,32,116,105,109,101,114,46,102,105,114,101,44,10,9,99,108,111,115,101,32,61,32,104,97,110,100,108,101,67,108,111,115,101,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,116,114,105,103,103,101,114,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,45,45,32,101,97,99,104,32,115,101,116,32,107,101,101,112,115,32,97,32,108,105,115,116,32,111,102,32,105,116,115,32,108,105,118,101,32,116,114,105,103,103,101,114,115,32,102,111,114,32,101,97,99,104,32,107,105,110,100,32,111,102,32,108,105,110,101,44,32,115,111,32,97,10,45,45,32,112,114,111,109,112,116,32,111,110,108,121,32,103,101,116,115,32,99,104,101,99,107,101,100,32,97,103,97,105,110,115,116,32,101,110,97,98,108,101,100,32,116,114,105,103,103,101,114,115,32,116,104,97,116,32,119,97,110,116,32,112,114,111,109,112,116,115,46,10,45,45,32,101,118,101,114,121,32,116,114,105,103,103,101,114,32,104,97,115,32,97,32,115,101,113,117,101,110,99,101,32,110,117,109,98,101,114,32,97,110,100,32,116,104,101,32,108,105,115,116,115,32,97,114,101,32,107,101,112,116,32,105,110,32,116,104,97,116,32,111,114,100,101,114,44,10,45,45,32,115,111,32,115,99,111,112,105,110,103,32,100,111,101,115,110,39,116,32,99,104,97,110,103,101,32,116,104,101,32,111,114,100,101,114,32,99,97,108,108,98,97,99,107,115,32,114,117,110,32,105,110,10,45,45,10,45,45,32,103,114,111,117,112,115,32,107,101,101,112,32,97,32,108,105,115,116,32,111,102,32,116,104,101,105,114,32,109,101,109,98,101,114,115,46,32,101,110,97,98,108,105,110,103,32,111,114,32,100,105,115,97,98,108,105,110,103,32,97,32,116,114,105,103,103,101,114,32,111,114,10,45,45,32,97,32,103,114,111,117,112,32,115,112,108,105,99,101,115,32,105,116,32,105,110,116,111,32,111,114,32,111,117,116,32,111,102,32,116,104,101,32,108,105,115,116,115,44,32,115,111,32,116,104,101,32,112,101,114,45,108,105,110,101,32,99,111,115,116,32,111,110,108,121,10,45,45,32,100,101,112,101,110,100,115,32,111,110,32,104,111,119,32,109,97,110,121,32,116,114,105,103,103,101,114,115,32,97,114,101,32,101,110,97,98,108,101,100,10,10,108,111,99,97,108,32,83,99,111,112,101,115,32,61,32,123,10,9,97,110,121,32,61,32,116,114,117,101,44,10,9,112,114,111,109,112,116,32,61,32,116,114,117,101,44,10,9,108,105,110,101,32,61,32,116,114,117,101,44,10,9,99,104,97,116,32,61,32,116,114,117,101,44,10,125,10,10,108,111,99,97,108,32,71,114,111,117,112,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,110,101,120,116,83,101,113,32,61,32,49,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,108,105,118,101,40,32,116,114,105,103,103,101,114,32,41,10,9,114,101,116,117,114,110,32,110,111,116,32,116,114,105,103,103,101,114,46,114,101,109,111,118,101,100,32,97,110,100,32,116,114,105,103,103,101,114,46,101,110,97,98,108,101,100,32,97,110,100,32,40,32,110,111,116,32,116,114,105,103,103,101,114,46,103,114,111,117,112,32,111,114,32,116,114,105,103,103,101,114,46,103,114,111,117,112,46,101,110,97,98,108,101,100,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,97,112,112,108,105,101,115,40,32,116,114,105,103,103,101,114,44,32,107,105,110,100,32,41,10,9,114,101,116,117,114,110,32,116,114,105,103,103,101,114,46,115,99,111,112,101,32,61,61,32,34,97,110,121,34,32,111,114,32,116,114,105,103,103,101,114,46,115,99,111,112,101,32,61,61,32,107,105,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,98,121,83,101,113,40,32,97,44,32,98,32,41,10,9,114,101,116,117,114,110,32,97,46,115,101,113,32,60,32,98,46,115,101,113,10,101,110,100,10,10,45,45,32,109,97,107,101,115,32,110,101,119,32,108,105,115,116,115,32,114,97,116,104,101,114,32,116,104,97,110,32,101,100,105,116,105,110,103,32,116,104,101,32,111,108,100,32,111,110,101,115,44,32,100,105,115,112,97,116,99,104,32,109,105,103,104,116,32,98,101,10,45,45,32,119,97,108,107,105,110,103,32,116,104,101,109,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,112,108,105,99,101,40,32,115,101,116,44,32,99,104,97,110,103,101,100,32,41,10,9,108,111,99,97,108,32,97,100,100,101,100,32,61,32,123,32,125,10,9,108,111,99,97,108,32,114,101,109,111,118,101,100,32,61,32,123,32,125,10,10,9,102,111,114,32,95,44,32,116,114,105,103,103,101,114,32,105,110,32,105,112,97,105,114,115,40,32,99,104,97,110,103,101,100,32,41,32,100,111,10,9,9,108,111,99,97,108,32,110,111,119,32,61,32,108,105,118,101,40,32,116,114,105,103,103,101,114,32,41,10,9,9,105,102,32,110,111,119,32,126,61,32,116,114,105,103,103,101,114,46,108,105,115,116,101,100,32,116,104,101,110,10,9,9,9,116,114,105,103,103,101,114,46,108,105,115,116,101,100,32,61,32,110,111,119,10,9,9,9,105,102,32,110,111,119,32,116,104,101,110,10,9,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,97,100,100,101,100,44,32,116,114,105,103,103,101,114,32,41,10,9,9,9,101,108,115,101,10,9,9,9,9,114,101,109,111,118,101,100,91,32,116,114,105,103,103,101,114,32,93,32,61,32,116,114,117,101,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,10,9,105,102,32,35,97,100,100,101,100,32,61,61,32,48,32,97,110,100,32,110,101,120,116,40,32,114,101,109,111,118,101,100,32,41,32,61,61,32,110,105,108,32,116,104,101,110,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,116,97,98,108,101,46,115,111,114,116,40,32,97,100,100,101,100,44,32,98,121,83,101,113,32,41,10,10,9,108,111,99,97,108,32,108,105,115,116,115,32,61,32,123,32,125,10,9,102,111,114,32,107,105,110,100,44,32,111,108,100,32,105,110,32,112,97,105,114,115,40,32,115,101,116,46,108,105,118,101,32,41,32,100,111,10,9,9,108,111,99,97,108,32,109,101,114,103,101,100,32,61,32,123,32,125,10,9,9,108,111,99,97,108,32,106,32,61,32,49,10,10,9,9,102,111,114,32,105,32,61,32,49,44,32,35,111,108,100,32,100,111,10,9,9,9,108,111,99,97,108,32,116,114,105,103,103,101,114,32,61,32,111,108,100,91,32,105,32,93,10,9,9,9,105,102,32,110,111,116,32,114,101,109,111,118,101,100,91,32,116,114,105,103,103,101,114,32,93,32,116,104,101,110,10,9,9,9,9,119,104,105,108,101,32,106,32,60,61,32,35,97,100,100,101,100,32,97,110,100,32,97,100,100,101,100,91,32,106,32,93,46,115,101,113,32,60,32,116,114,105,103,103,101,114,46,115,101,113,32,100,111,10,9,9,9,9,9,105,102,32,97,112,112,108,105,101,115,40,32,97,100,100,101,100,91,32,106,32,93,44,32,107,105,110,100,32,41,32,116,104,101,110,10,9,9,9,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,109,101,114,103,101,100,44,32,97,100,100,101,100,91,32,106,32,93,32,41,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,106,32,61,32,106,32,43,32,49,10,9,9,9,9,101,110,100,10,9,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,109,101,114,103,101,100,44,32,116,114,105,103,103,101,114,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,10,9,9,102,111,114,32,107,32,61,32,106,44,32,35,97,100,100,101,100,32,100,111,10,9,9,9,105,102,32,97,112,112,108,105,101,115,40,32,97,100,100,101,100,91,32,107,32,93,44,32,107,105,110,100,32,41,32,116,104,101,110,10,9,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,109,101,114,103,101,100,44,32,97,100,100,101,100,91,32,107,32,93,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,10,9,9,108,105,115,116,115,91,32,107,105,110,100,32,93,32,61,32,109,101,114,103,101,100,10,9,101,110,100,10,10,9,115,101,116,46,108,105,118,101,32,61,32,108,105,115,116,115,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,101,116,69,110,97,98,108,101,100,40,32,115,101,108,102,44,32,101,110,97,98,108,101,100,32,41,10,9,105,102,32,115,101,108,102,46,101,110,97,98,108,101,100,32,61,61,32,101,110,97,98,108,101,100,32,116,104,101,110,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,101,110,97,98,108,101,100,10,10,9,105,102,32,110,111,116,32,115,101,108,102,46,109,101,109,98,101,114,115,32,116,104,101,110,10,9,9,115,112,108,105,99,101,40,32,115,101,108,102,46,116,114,105,103,103,101,114,83,101,116,44,32,123,32,115,101,108,102,32,125,32,41,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,108,111,99,97,108,32,98,121,83,101,116,32,61,32,123,32,125,10,9,102,111,114,32,95,44,32,116,114,105,103,103,101,114,32,105,110,32,105,112,97,105,114,115,40,32,115,101,108,102,46,109,101,109,98,101,114,115,32,41,32,100,111,10,9,9,108,111,99,97,108,32,115,101,116,32,61,32,116,114,105,103,103,101,114,46,116,114,105,103,103,101,114,83,101,116,10,9,9,98,121,83,101,116,91,32,115,101,116,32,93,32,61,32,98,121,83,101,116,91,32,115,101,116,32,93,32,111,114,32,123,32,125,10,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,98,121,83,101,116,91,32,115,101,116,32,93,44,32,116,114,105,103,103,101,114,32,41,10,9,101,110,100,10,10,9,102,111,114,32,115,101,116,44,32,99,104,97,110,103,101,100,32,105,110,32,112,97,105,114,115,40,32,98,121,83,101,116,32,41,32,100,111,10,9,9,115,112,108,105,99,101,40,32,115,101,116,44,32,99,104,97,110,103,101,100,32,41,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,101,110,97,98,108,101,40,32,115,101,108,102,32,41,10,9,115,101,116,69,110,97,98,108,101,100,40,32,115,101,108,102,44,32,116,114,117,101,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,105,115,97,98,108,101,40,32,115,101,108,102,32,41,10,9,115,101,116,69,110,97,98,108,101,100,40,32,115,101,108,102,44,32,102,97,108,115,101,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,103,114,111,117,112,40,32,110,97,109,101,32,41,10,9,101,110,102,111,114,99,101,40,32,110,97,109,101,44,32,34,110,97,109,101,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,108,111,99,97,108,32,103,114,111,117,112,32,61,32,71,114,111,117,112,115,91,32,110,97,109,101,32,93,10,10,9,105,102,32,110,111,116,32,103,114,111,117,112,32,116,104,101,110,10,9,9,103,114,111,117,112,32,61,32,123,10,9,9,9,110,97,109,101,32,61,32,110,97,109,101,44,10,9,9,9,101,110,97,98,108,101,100,32,61,32,116,114,117,101,44,10,9,9,9,109,101,109,98,101,114,115,32,61,32,123,32,125,44,10,10,9,9,9,101,110,97,98,108,101,32,61,32,101,110,97,98,108,101,44,10,9,9,9,100,105,115,97,98,108,101,32,61,32,100,105,115,97,98,108,101,44,10,9,9,9,115,101,116,32,61,32,115,101,116,69,110,97,98,108,101,100,44,10,9,9,125,10,10,9,9,71,114,111,117,112,115,91,32,110,97,109,101,32,93,32,61,32,103,114,111,117,112,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,103,114,111,117,112,10,101,110,100,10,10,45,45,32,99,104,97,116,32,116,114,105,103,103,101,114,115,32,97,114,101,32,97,108,108,32,115,99,111,112,101,100,32,116,111,32,97,110,121,46,32,115,99,111,112,101,32,61,32,34,99,104,97,116,34,32,111,110,32,97,32,109,117,100,32,115,101,116,32,112,117,116,115,10,45,45,32,116,104,101,32,116,114,105,103,103,101,114,32,105,110,32,105,116,115,32,99,104,97,116,32,115,105,98,108,105,110,103,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,110,101,119,83,101,116,40,32,114,97,119,44,32,99,104,97,116,83,101,116,32,41,10,9,114,101,116,117,114,110,32,123,10,9,9,114,97,119,32,61,32,114,97,119,44,10,9,9,99,104,97,116,83,101,116,32,61,32,99,104,97,116,83,101,116,44,10,10,9,9,108,105,118,101,32,61,32,123,10,9,9,9,112,114,111,109,112,116,32,61,32,123,32,125,44,10,9,9,9,108,105,110,101,32,61,32,123,32,125,44,10,9,9,125,44,10,9,125,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,110,101,119,67,104,97,116,83,101,116,40,32,114,97,119,32,41,10,9,108,111,99,97,108,32,115,101,116,32,61,32,110,101,119,83,101,116,40,32,114,97,119,32,41,10,9,115,101,116,46,99,104,97,116,32,61,32,116,114,117,101,10,9,114,101,116,117,114,110,32,115,101,116,10,101,110,100,10,10,45,45,32,109,117,100,32,108,105,110,101,115,32,97,114,101,32,110,97,116,105,118,101,32,108,105,110,101,32,111,98,106,101,99,116,115,32,97,110,100,32,99,104,97,116,32,108,105,110,101,115,32,97,114,101,32,115,116,114,105,110,103,115,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,102,105,110,100,40,32,108,105,110,101,44,32,112,97,116,116,101,114,110,44,32,114,97,119,44,32,112,108,97,105,110,32,41,10,9,105,102,32,116,121,112,101,40,32,108,105,110,101,32,41,32,61,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,108,105,110,101,58,102,105,110,100,40,32,112,97,116,116,101,114,110,44,32,49,44,32,112,108,97,105,110,32,41,10,9,101,110,100,10,10,9,105,102,32,114,97,119,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,108,105,110,101,58,102,105,110,100,82,97,119,40,32,112,97,116,116,101,114,110,44,32,49,44,32,112,108,97,105,110,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,108,105,110,101,58,102,105,110,100,40,32,112,97,116,116,101,114,110,44,32,49,44,32,112,108,97,105,110,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,116,101,120,116,40,32,108,105,110,101,44,32,114,97,119,32,41,10,9,105,102,32,116,121,112,101,40,32,108,105,110,101,32,41,32,61,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,108,105,110,101,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,114,97,119,32,97,110,100,32,108,105,110,101,58,114,97,119,40,41,32,111,114,32,108,105,110,101,58,116,101,120,116,40,41,10,101,110,100,10,10,45,45,32,116,104,101,32,108,97,115,116,32,97,114,103,117,109,101,110,116,32,116,111,32,109,117,100,46,97,99,116,105,111,110,32,97,110,100,32,102,114,105,101,110,100,115,32,117,115,101,100,32,116,111,32,98,101,32,97,32,100,105,115,97,98,108,101,100,32,102,108,97,103,44,10,45,45,32,105,116,32,99,97,110,32,110,111,119,32,97,108,115,111,32,98,101,32,97,32,116,97,98,108,101,32,111,102,32,111,112,116,105,111,110,115,58,10,45,45,10,45,45,32,32,32,100,105,115,97,98,108,101,100,32,61,32,116,114,117,101,10,45,45,32,32,32,115,99,111,112,101,32,61,32,34,97,110,121,34,32,40,100,101,102,97,117,108,116,41,44,32,34,112,114,111,109,112,116,34,44,32,34,108,105,110,101,34,32,40,97,110,121,116,104,105,110,103,32,98,117,116,32,112,114,111,109,112,116,115,41,32,111,114,32,34,99,104,97,116,34,10,45,45,32,32,32,108,105,116,101,114,97,108,32,61,32,112,108,97,105,110,32,116,101,120,116,32,116,104,101,32,108,105,110,101,32,104,97,115,32,116,111,32,99,111,110,116,97,105,110,32,98,101,102,111,114,101,32,119,101,32,116,114,121,32,116,104,101,32,112,97,116,116,101,114,110,10,45,45,32,32,32,103,114,111,117,112,32,61,32,110,97,109,101,32,111,102,32,97,32,103,114,111,117,112,32,102,114,111,109,32,109,117,100,46,103,114,111,117,112,44,32,119,101,32,115,107,105,112,32,116,104,101,32,116,114,105,103,103,101,114,32,119,104,105,108,101,32,116,104,101,10,45,45,32,32,32,32,32,32,32,32,32,32,32,103,114,111,117,112,32,105,115,32,100,105,115,97,98,108,101,100,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,97,100,100,40,32,115,101,116,44,32,116,114,105,103,103,101,114,44,32,111,112,116,115,32,41,10,9,45,45,32,114,101,112,111,114,116,32,101,114,114,111,114,115,32,97,116,32,119,104,111,101,118,101,114,32,99,97,108,108,101,100,32,109,117,100,46,97,99,116,105,111,110,10,9,108,111,99,97,108,32,108,101,118,101,108,32,61,32,51,10,10,9,105,102,32,116,121,112,101,40,32,111,112,116,115,32,41,32,126,61,32,34,116,97,98,108,101,34,32,116,104,101,110,10,9,9,111,112,116,115,32,61,32,123,32,100,105,115,97,98,108,101,100,32,61,32,111,112,116,115,32,125,10,9,101,110,100,10,10,9,108,111,99,97,108,32,115,99,111,112,101,32,61,32,111,112,116,115,46,115,99,111,112,101,32,111,114,32,34,97,110,121,34,10,9,105,102,32,110,111,116,32,83,99,111,112,101,115,91,32,115,99,111,112,101,32,93,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,98,97,100,32,116,114,105,103,103,101,114,32,115,99,111,112,101,32,96,37,115,39,34,32,37,32,116,111,115,116,114,105,110,103,40,32,115,99,111,112,101,32,41,44,32,108,101,118,101,108,32,41,10,9,101,110,100,10,10,9,105,102,32,111,112,116,115,46,108,105,116,101,114,97,108,32,126,61,32,110,105,108,32,97,110,100,32,116,121,112,101,40,32,111,112,116,115,46,108,105,116,101,114,97,108,32,41,32,126,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,116,114,105,103,103,101,114,32,108,105,116,101,114,97,108,32,115,104,111,117,108,100,32,98,101,32,97,32,115,116,114,105,110,103,34,44,32,108,101,118,101,108,32,41,10,9,101,110,100,10,10,9,105,102,32,111,112,116,115,46,103,114,111,117,112,32,126,61,32,110,105,108,32,97,110,100,32,116,121,112,101,40,32,111,112,116,115,46,103,114,111,117,112,32,41,32,126,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,116,114,105,103,103,101,114,32,103,114,111,117,112,32,115,104,111,117,108,100,32,98,101,32,97,32,115,116,114,105,110,103,34,44,32,108,101,118,101,108,32,41,10,9,101,110,100,10,10,9,105,102,32,115,101,116,46,99,104,97,116,32,116,104,101,110,10,9,9,105,102,32,115,99,111,112,101,32,126,61,32,34,97,110,121,34,32,97,110,100,32,115,99,111,112,101,32,126,61,32,34,99,104,97,116,34,32,116,104,101,110,10,9,9,9,101,114,114,111,114,40,32,34,99,104,97,116,32,116,114,105,103,103,101,114,115,32,99,97,110,39,116,32,98,101,32,115,99,111,112,101,100,32,116,111,32,96,37,115,39,34,32,37,32,115,99,111,112,101,44,32,108,101,118,101,108,32,41,10,9,9,101,110,100,10,10,9,9,115,99,111,112,101,32,61,32,34,97,110,121,34,10,9,101,108,115,101,105,102,32,115,99,111,112,101,32,61,61,32,34,99,104,97,116,34,32,116,104,101,110,10,9,9,105,102,32,110,111,116,32,115,101,116,46,99,104,97,116,83,101,116,32,116,104,101,110,10,9,9,9,101,114,114,111,114,40,32,34,116,104,105,115,32,107,105,110,100,32,111,102,32,116,114,105,103,103,101,114,32,99,97,110,39,116,32,98,101,32,115,99,111,112,101,100,32,116,111,32,99,104,97,116,34,44,32,108,101,118,101,108,32,41,10,9,9,101,110,100,10,10,9,9,115,101,116,32,61,32,115,101,116,46,99,104,97,116,83,101,116,10,9,9,115,99,111,112,101,32,61,32,34,97,110,121,34,10,9,101,110,100,10,10,9,116,114,105,103,103,101,114,46,115,101,113,32,61,32,110,101,120,116,83,101,113,10,9,116,114,105,103,103,101,114,46,116,114,105,103,103,101,114,83,101,116,32,61,32,115,101,116,10,9,116,114,105,103,103,101,114,46,115,99,111,112,101,32,61,32,115,99,111,112,101,10,9,116,114,105,103,103,101,114,46,108,105,116,101,114,97,108,32,61,32,111,112,116,115,46,108,105,116,101,114,97,108,10,9,116,114,105,103,103,101,114,46,103,114,111,117,112,32,61,32,111,112,116,115,46,103,114,111,117,112,32,97,110,100,32,109,117,100,46,103,114,111,117,112,40,32,111,112,116,115,46,103,114,111,117,112,32,41,10,9,116,114,105,103,103,101,114,46,101,110,97,98,108,101,100,32,61,32,110,111,116,32,111,112,116,115,46,100,105,115,97,98,108,101,100,10,9,116,114,105,103,103,101,114,46,108,105,115,116,101,100,32,61,32,102,97,108,115,101,10,10,9,116,114,105,103,103,101,114,46,101,110,97,98,108,101,32,61,32,101,110,97,98,108,101,10,9,116,114,105,103,103,101,114,46,100,105,115,97,98,108,101,32,61,32,100,105,115,97,98,108,101,10,10,9,110,101,120,116,83,101,113,32,61,32,110,101,120,116,83,101,113,32,43,32,49,10,10,9,105,102,32,116,114,105,103,103,101,114,46,103,114,111,117,112,32,116,104,101,110,10,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,116,114,105,103,103,101,114,46,103,114,111,117,112,46,109,101,109,98,101,114,115,44,32,116,114,105,103,103,101,114,32,41,10,9,101,110,100,10,10,9,115,112,108,105,99,101,40,32,115,101,116,44,32,123,32,116,114,105,103,103,101,114,32,125,32,41,10,10,9,114,101,116,117,114,110,32,116,114,105,103,103,101,114,10,101,110,100,10,10,45,45,32,116,97,107,101,115,32,116,104,101,32,116,114,105,103,103,101,114,32,111,117,116,32,111,102,32,105,116,115,32,115,101,116,32,102,111,114,32,103,111,111,100,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,114,101,109,111,118,101,40,32,116,114,105,103,103,101,114,32,41,10,9,105,102,32,116,114,105,103,103,101,114,46,114,101,109,111,118,101,100,32,116,104,101,110,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,116,114,105,103,103,101,114,46,114,101,109,111,118,101,100,32,61,32,116,114,117,101,10,10,9,105,102,32,116,114,105,103,103,101,114,46,103,114,111,117,112,32,116,104,101,110,10,9,9,108,111,99,97,108,32,109,101,109,98,101,114,115,32,61,32,116,114,105,103,103,101,114,46,103,114,111,117,112,46,109,101,109,98,101,114,115,10,9,9,102,111,114,32,105,44,32,109,101,109,98,101,114,32,105,110,32,105,112,97,105,114,115,40,32,109,101,109,98,101,114,115,32,41,32,100,111,10,9,9,9,105,102,32,109,101,109,98,101,114,32,61,61,32,116,114,105,103,103,101,114,32,116,104,101,110,10,9,9,9,9,116,97,98,108,101,46,114,101,109,111,118,101,40,32,109,101,109,98,101,114,115,44,32,105,32,41,10,9,9,9,9,98,114,101,97,107,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,10,9,115,112,108,105,99,101,40,32,116,114,105,103,103,101,114,46,116,114,105,103,103,101,114,83,101,116,44,32,123,32,116,114,105,103,103,101,114,32,125,32,41,10,101,110,100,10,10,45,45,32,99,97,108,108,115,32,99,97,108,108,98,97,99,107,40,32,116,114,105,103,103,101,114,44,32,108,105,110,101,32,41,32,102,111,114,32,101,97,99,104,32,108,105,118,101,32,116,114,105,103,103,101,114,32,116,104,97,116,32,97,112,112,108,105,101,115,32,116,111,10,45,45,32,116,104,101,32,108,105,110,101,44,32,115,116,111,112,112,105,110,103,32,101,97,114,108,121,32,105,102,32,105,116,32,114,101,116,117,114,110,115,32,116,114,117,101,46,32,116,114,105,103,103,101,114,115,32,97,100,100,101,100,32,98,121,32,99,97,108,108,98,97,99,107,115,10,45,45,32,119,97,105,116,32,102,111,114,32,116,104,101,32,110,101,120,116,32,108,105,110,101,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,105,115,112,97,116,99,104,40,32,115,101,116,44,32,108,105,110,101,44,32,112,114,111,109,112,116,44,32,99,97,108,108,98,97,99,107,32,41,10,9,108,111,99,97,108,32,107,105,110,100,32,61,32,112,114,111,109,112,116,32,97,110,100,32,34,112,114,111,109,112,116,34,32,111,114,32,34,108,105,110,101,34,10,9,108,111,99,97,108,32,116,114,105,103,103,101,114,115,32,61,32,115,101,116,46,108,105,118,101,91,32,107,105,110,100,32,93,10,9,108,111,99,97,108,32,114,97,119,32,61,32,115,101,116,46,114,97,119,10,10,9,102,111,114,32,105,32,61,32,49,44,32,35,116,114,105,103,103,101,114,115,32,100,111,10,9,9,108,111,99,97,108,32,116,114,105,103,103,101,114,32,61,32,116,114,105,103,103,101,114,115,91,32,105,32,93,10,10,9,9,45,45,32,111,110,108,121,32,114,101,45,99,104,101,99,107,32,119,104,101,110,32,115,111,109,101,116,104,105,110,103,32,119,97,115,32,116,111,103,103,108,101,100,32,98,121,32,97,110,32,101,97,114,108,105,101,114,32,99,97,108,108,98,97,99,107,10,9,9,105,102,32,115,101,116,46,108,105,118,101,91,32,107,105,110,100,32,93,32,61,61,32,116,114,105,103,103,101,114,115,32,111,114,32,108,105,118,101,40,32,116,114,105,103,103,101,114,32,41,32,116,104,101,110,10,9,9,9,105,102,32,110,111,116,32,116,114,105,103,103,101,114,46,108,105,116,101,114,97,108,32,111,114,32,102,105,110,100,40,32,108,105,110,101,44,32,116,114,105,103,103,101,114,46,108,105,116,101,114,97,108,44,32,114,97,119,44,32,116,114,117,101,32,41,32,116,104,101,110,10,9,9,9,9,105,102,32,99,97,108,108,98,97,99,107,40,32,116,114,105,103,103,101,114,44,32,108,105,110,101,32,41,32,116,104,101,110,10,9,9,9,9,9,114,101,116,117,114,110,32,116,114,117,101,10,9,9,9,9,101,110,100,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,102,97,108,115,101,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,110,101,119,83,101,116,32,61,32,110,101,119,83,101,116,44,10,9,110,101,119,67,104,97,116,83,101,116,32,61,32,110,101,119,67,104,97,116,83,101,116,44,10,9,97,100,100,32,61,32,97,100,100,44,10,9,114,101,109,111,118,101,32,61,32,114,101,109,111,118,101,44,10,9,100,105,115,112,97,116,99,104,32,61,32,100,105,115,112,97,116,99,104,44,10,9,102,105,110,100,32,61,32,102,105,110,100,44,10,9,116,101,120,116,32,61,32,116,101,120,116,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,104,105,103,104,108,105,103,104,116,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,97,100,100,44,32,115,101,116,44,32,114,101,109,111,118,101,10,10,108,111,99,97,108,32,67,111,108,111,117,114,115,32,61,32,123,10,9,107,32,61,32,48,44,10,9,114,32,61,32,49,44,10,9,103,32,61,32,50,44,10,9,121,32,61,32,51,44,10,9,98,32,61,32,52,44,10,9,109,32,61,32,53,44,10,9,99,32,61,32,54,44,10,9,119,32,61,32,55,44,10,9,115,32,61,32,56,44,10,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,111,108,111,117,114,40,32,110,97,109,101,44,32,108,101,118,101,108,32,41,10,9,105,102,32,110,97,109,101,32,61,61,32,110,105,108,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,110,105,108,10,9,101,110,100,10,10,9,108,111,99,97,108,32,99,32,61,32,67,111,108,111,117,114,115,91,32,110,97,109,101,32,93,10,9,105,102,32,110,111,116,32,99,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,98,97,100,32,104,105,103,104,108,105,103,104,116,32,99,111,108,111,117,114,32,96,37,115,39,34,32,37,32,116,111,115,116,114,105,110,103,40,32,110,97,109,101,32,41,44,32,108,101,118,101,108,32,43,32,49,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,99,10,101,110,100,10,10,45,45,32,115,116,121,108,101,32,105,115,32,97,32,99,111,108,111,117,114,32,108,105,107,101,32,34,114,34,44,32,97,32,98,111,108,100,32,99,111,108,111,117,114,32,108,105,107,101,32,34,108,114,34,44,32,111,114,32,97,32,116,97,98,108,101,32,119,105,116,104,32,97,110,121,10,45,45,32,111,102,32,102,103,47,98,103,47,98,111,108,100,46,32,111,112,116,115,32,99,97,110,32,104,97,118,101,32,112,97,116,116,101,114,110,32,61,32,116,114,117,101,32,116,111,32,116,114,101,97,116,32,116,101,120,116,32,97,115,32,97,32,76,117,97,10,45,45,32,112,97,116,116,101,114,110,44,32,119,111,114,100,32,61,32,116,114,117,101,32,116,111,32,111,110,108,121,32,109,97,116,99,104,32,119,104,111,108,101,32,119,111,114,100,115,44,32,97,110,100,32,100,105,115,97,98,108,101,100,32,61,32,116,114,117,101,10,102,117,110,99,116,105,111,110,32,109,117,100,46,104,105,103,104,108,105,103,104,116,40,32,116,101,120,116,44,32,115,116,121,108,101,44,32,111,112,116,115,32,41,10,9,101,110,102,111,114,99,101,40,32,116,101,120,116,44,32,34,116,101,120,116,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,115,116,121,108,101,44,32,34,115,116,121,108,101,34,44,32,34,115,116,114,105,110,103,34,44,32,34,116,97,98,108,101,34,32,41,10,9,101,110,102,111,114,99,101,40,32,111,112,116,115,44,32,34,111,112,116,115,34,44,32,34,116,97,98,108,101,34,44,32,34,110,105,108,34,32,41,10,10,9,111,112,116,115,32,61,32,111,112,116,115,32,111,114,32,123,32,125,10,10,9,105,102,32,116,101,120,116,32,61,61,32,34,34,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,99,97,110,39,116,32,104,105,103,104,108,105,103,104,116,32,97,110,32,101,109,112,116,121,32,115,116,114,105,110,103,34,44,32,50,32,41,10,9,101,110,100,10,10,9,105,102,32,111,112,116,115,46,112,97,116,116,101,114,110,32,116,104,101,110,10,9,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,112,99,97,108,108,40,32,115,116,114,105,110,103,46,102,105,110,100,44,32,34,34,44,32,116,101,120,116,32,41,10,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,101,114,114,111,114,40,32,101,114,114,44,32,50,32,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,108,111,99,97,108,32,102,103,44,32,98,103,44,32,98,111,108,100,10,9,105,102,32,116,121,112,101,40,32,115,116,121,108,101,32,41,32,61,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,108,111,99,97,108,32,108,44,32,110,97,109,101,32,61,32,115,116,121,108,101,58,109,97,116,99,104,40,32,34,94,40,108,63,41,40,37,108,41,36,34,32,41,10,9,9,102,103,32,61,32,99,111,108,111,117,114,40,32,110,97,109,101,32,111,114,32,115,116,121,108,101,44,32,50,32,41,10,9,9,98,111,108,100,32,61,32,108,32,61,61,32,34,108,34,32,111,114,32,110,105,108,10,9,101,108,115,101,10,9,9,102,103,32,61,32,99,111,108,111,117,114,40,32,115,116,121,108,101,46,102,103,44,32,50,32,41,10,9,9,98,103,32,61,32,99,111,108,111,117,114,40,32,115,116,121,108,101,46,98,103,44,32,50,32,41,10,9,9,98,111,108,100,32,61,32,115,116,121,108,101,46,98,111,108,100,10,9,101,110,100,10,10,9,108,111,99,97,108,32,104,105,103,104,108,105,103,104,116,32,61,32,123,10,9,9,116,101,120,116,32,61,32,116,101,120,116,44,10,9,9,101,110,97,98,108,101,100,32,61,32,116,114,117,101,44,10,10,9,9,101,110,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,105,102,32,115,101,108,102,46,105,100,32,97,110,100,32,110,111,116,32,115,101,108,102,46,101,110,97,98,108,101,100,32,116,104,101,110,10,9,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,116,114,117,101,10,9,9,9,9,115,101,116,40,32,115,101,108,102,46,105,100,44,32,116,114,117,101,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,44,10,9,9,100,105,115,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,105,102,32,115,101,108,102,46,105,100,32,97,110,100,32,115,101,108,102,46,101,110,97,98,108,101,100,32,116,104,101,110,10,9,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,102,97,108,115,101,10,9,9,9,9,115,101,116,40,32,115,101,108,102,46,105,100,44,32,102,97,108,115,101,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,44,10,9,9,114,101,109,111,118,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,105,102,32,115,101,108,102,46,105,100,32,116,104,101,110,10,9,9,9,9,114,101,109,111,118,101,40,32,115,101,108,102,46,105,100,32,41,10,9,9,9,9,115,101,108,102,46,105,100,32,61,32,110,105,108,10,9,9,9,101,110,100,10,9,9,101,110,100,44,10,9,125,10,10,9,104,105,103,104,108,105,103,104,116,46,105,100,32,61,32,97,100,100,40,32,116,101,120,116,44,32,111,112,116,115,46,112,97,116,116,101,114,110,44,32,111,112,116,115,46,119,111,114,100,44,32,102,103,44,32,98,103,44,32,98,111,108,100,32,41,10,10,9,105,102,32,111,112,116,115,46,100,105,115,97,98,108,101,100,32,116,104,101,110,10,9,9,104,105,103,104,108,105,103,104,116,58,100,105,115,97,98,108,101,40,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,104,105,103,104,108,105,103,104,116,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,104,105,103,104,108,105,103,104,116,65,100,100,44,32,104,105,103,104,108,105,103,104,116,83,101,116,44,32,104,105,103,104,108,105,103,104,116,82,101,109,111,118,101,32,41,10,9,9,97,100,100,32,61,32,104,105,103,104,108,105,103,104,116,65,100,100,10,9,9,115,101,116,32,61,32,104,105,103,104,108,105,103,104,116,83,101,116,10,9,9,114,101,109,111,118,101,32,61,32,104,105,103,104,108,105,103,104,116,82,101,109,111,118,101,10,9,101,110,100,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,101,118,101,110,116,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,69,118,101,110,116,115,32,61,32,123,32,125,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,108,105,115,116,101,110,40,32,110,97,109,101,44,32,99,97,108,108,98,97,99,107,44,32,100,105,115,97,98,108,101,100,32,41,10,9,101,110,102,111,114,99,101,40,32,110,97,109,101,44,32,34,110,97,109,101,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,99,97,108,108,98,97,99,107,44,32,34,99,97,108,108,98,97,99,107,34,44,32,34,102,117,110,99,116,105,111,110,34,32,41,10,10,9,108,111,99,97,108,32,101,118,101,110,116,32,61,32,123,10,9,9,99,97,108,108,98,97,99,107,32,61,32,99,97,108,108,98,97,99,107,44,10,10,9,9,101,110,97,98,108,101,100,32,61,32,110,111,116,32,100,105,115,97,98,108,101,100,44,10,10,9,9,101,110,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,116,114,117,101,10,9,9,101,110,100,44,10,9,9,100,105,115,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,102,97,108,115,101,10,9,9,101,110,100,44,10,9,125,10,10,9,105,102,32,110,111,116,32,69,118,101,110,116,115,91,32,110,97,109,101,32,93,32,116,104,101,110,10,9,9,69,118,101,110,116,115,91,32,110,97,109,101,32,93,32,61,32,123,32,125,10,9,101,110,100,10,10,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,69,118,101,110,116,115,91,32,110,97,109,101,32,93,44,32,101,118,101,110,116,32,41,10,10,9,114,101,116,117,114,110,32,101,118,101,110,116,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,101,118,101,110,116,40,32,110,97,109,101,44,32,46,46,46,32,41,10,9,101,110,102,111,114,99,101,40,32,110,97,109,101,44,32,34,110,97,109,101,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,105,102,32,69,118,101,110,116,115,91,32,110,97,109,101,32,93,32,116,104,101,110,10,9,9,102,111,114,32,95,44,32,101,118,101,110,116,32,105,110,32,105,112,97,105,114,115,40,32,69,118,101,110,116,115,91,32,110,97,109,101,32,93,32,41,32,100,111,10,9,9,9,105,102,32,101,118,101,110,116,46,101,110,97,98,108,101,100,32,116,104,101,110,10,9,9,9,9,101,118,101,110,116,46,99,97,108,108,98,97,99,107,40,32,46,46,46,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,115,117,98,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,116,114,105,103,103,101,114,32,61,32,114,101,113,117,105,114,101,40,32,34,116,114,105,103,103,101,114,34,32,41,10,10,108,111,99,97,108,32,83,117,98,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,83,101,116,40,32,102,97,108,115,101,32,41,10,10,45,45,32,115,117,98,115,32,114,101,119,114,105,116,101,32,116,104,101,32,108,105,110,101,32,110,97,116,105,118,101,108,121,32,97,110,100,32,115,116,97,99,107,44,32,115,111,32,101,118,101,114,121,32,108,105,118,101,32,115,117,98,32,103,101,116,115,32,97,32,103,111,46,10,45,45,32,112,97,116,116,101,114,110,115,32,116,104,97,116,32,109,101,110,116,105,111,110,32,101,115,99,97,112,101,32,99,111,100,101,115,32,115,101,101,32,116,104,101,32,108,105,110,101,32,119,105,116,104,32,105,116,115,32,101,115,99,97,112,101,32,99,111,100,101,115,10,45,45,32,108,105,107,101,32,116,104,101,121,32,117,115,101,100,32,116,111,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,116,114,121,83,117,98,40,32,115,117,98,44,32,108,105,110,101,32,41,10,9,108,111,99,97,108,32,97,112,112,108,121,32,61,32,115,117,98,46,114,97,119,32,97,110,100,32,108,105,110,101,46,103,115,117,98,82,97,119,32,111,114,32,108,105,110,101,46,103,115,117,98,10,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,112,99,97,108,108,40,32,97,112,112,108,121,44,32,108,105,110,101,44,32,115,117,98,46,112,97,116,116,101,114,110,44,32,115,117,98,46,114,101,112,108,97,99,101,109,101,110,116,32,41,10,10,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,115,117,98,32,102,97,105,108,101,100,58,32,37,115,92,110,37,115,92,110,37,115,34,44,32,101,114,114,44,32,115,117,98,46,112,97,116,116,101,114,110,44,32,116,111,115,116,114,105,110,103,40,32,115,117,98,46,114,101,112,108,97,99,101,109,101,110,116,32,41,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,102,97,108,115,101,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,111,83,117,98,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,116,114,105,103,103,101,114,46,100,105,115,112,97,116,99,104,40,32,83,117,98,115,44,32,108,105,110,101,44,32,112,114,111,109,112,116,44,32,116,114,121,83,117,98,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,115,117,98,40,32,112,97,116,116,101,114,110,44,32,114,101,112,108,97,99,101,109,101,110,116,44,32,111,112,116,115,32,41,10,9,101,110,102,111,114,99,101,40,32,112,97,116,116,101,114,110,44,32,34,112,97,116,116,101,114,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,114,101,112,108,97,99,101,109,101,110,116,44,32,34,114,101,112,108,97,99,101,109,101,110,116,34,44,32,34,115,116,114,105,110,103,34,44,32,34,102,117,110,99,116,105,111,110,34,44,32,34,116,97,98,108,101,34,32,41,10,10,9,108,111,99,97,108,32,115,117,98,32,61,32,116,114,105,103,103,101,114,46,97,100,100,40,32,83,117,98,115,44,32,123,10,9,9,112,97,116,116,101,114,110,32,61,32,112,97,116,116,101,114,110,44,10,9,9,114,101,112,108,97,99,101,109,101,110,116,32,61,32,114,101,112,108,97,99,101,109,101,110,116,44,10,9,9,114,97,119,32,61,32,112,97,116,116,101,114,110,58,102,105,110,100,40,32,34,92,50,55,34,44,32,49,44,32,116,114,117,101,32,41,32,126,61,32,110,105,108,44,10,9,125,44,32,111,112,116,115,32,41,10,10,9,114,101,116,117,114,110,32,115,117,98,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,100,111,83,117,98,115,32,61,32,100,111,83,117,98,115,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,103,97,103,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,116,114,105,103,103,101,114,32,61,32,114,101,113,117,105,114,101,40,32,34,116,114,105,103,103,101,114,34,32,41,10,10,108,111,99,97,108,32,67,104,97,116,71,97,103,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,67,104,97,116,83,101,116,40,32,102,97,108,115,101,32,41,10,108,111,99,97,108,32,67,104,97,116,65,110,115,105,71,97,103,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,67,104,97,116,83,101,116,40,32,116,114,117,101,32,41,10,10,108,111,99,97,108,32,71,97,103,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,83,101,116,40,32,102,97,108,115,101,44,32,67,104,97,116,71,97,103,115,32,41,10,108,111,99,97,108,32,65,110,115,105,71,97,103,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,83,101,116,40,32,116,114,117,101,44,32,67,104,97,116,65,110,115,105,71,97,103,115,32,41,10,10,108,111,99,97,108,32,100,111,71,97,103,115,10,108,111,99,97,108,32,100,111,65,110,115,105,71,97,103,115,10,10,108,111,99,97,108,32,100,111,67,104,97,116,71,97,103,115,10,108,111,99,97,108,32,100,111,67,104,97,116,65,110,115,105,71,97,103,115,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,103,101,110,101,114,105,99,71,97,103,115,40,32,103,97,103,115,32,41,10,9,108,111,99,97,108,32,114,97,119,32,61,32,103,97,103,115,46,114,97,119,10,10,9,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,109,97,116,99,104,101,115,40,32,103,97,103,44,32,108,105,110,101,32,41,10,9,9,114,101,116,117,114,110,32,116,114,105,103,103,101,114,46,102,105,110,100,40,32,108,105,110,101,44,32,103,97,103,46,112,97,116,116,101,114,110,44,32,114,97,119,32,41,32,126,61,32,110,105,108,10,9,101,110,100,10,10,9,114,101,116,117,114,110,10,9,9,102,117,110,99,116,105,111,110,40,32,112,97,116,116,101,114,110,44,32,111,112,116,115,32,41,10,9,9,9,101,110,102,111,114,99,101,40,32,112,97,116,116,101,114,110,44,32,34,112,97,116,116,101,114,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,9,9,108,111,99,97,108,32,103,97,103,32,61,32,116,114,105,103,103,101,114,46,97,100,100,40,32,103,97,103,115,44,32,123,32,112,97,116,116,101,114,110,32,61,32,112,97,116,116,101,114,110,32,125,44,32,111,112,116,115,32,41,10,10,9,9,9,114,101,116,117,114,110,32,103,97,103,10,9,9,101,110,100,44,10,10,9,9,102,117,110,99,116,105,111,110,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,9,9,114,101,116,117,114,110,32,116,114,105,103,103,101,114,46,100,105,115,112,97,116,99,104,40,32,103,97,103,115,44,32,108,105,110,101,44,32,112,114,111,109,112,116,44,32,109,97,116,99,104,101,115,32,41,10,9,9,101,110,100,10,101,110,100,10,10,109,117,100,46,103,97,103,44,32,32,32,32,32,100,111,71,97,103,115,32,32,32,32,32,61,32,103,101,110,101,114,105,99,71,97,103,115,40,32,71,97,103,115,32,41,10,109,117,100,46,103,97,103,65,110,115,105,44,32,100,111,65,110,115,105,71,97,103,115,32,61,32,103,101,110,101,114,105,99,71,97,103,115,40,32,65,110,115,105,71,97,103,115,32,41,10,10,109,117,100,46,103,97,103,67,104,97,116,44,32,32,32,32,32,100,111,67,104,97,116,71,97,103,115,32,32,32,32,32,61,32,103,101,110,101,114,105,99,71,97,103,115,40,32,67,104,97,116,71,97,103,115,32,41,10,109,117,100,46,103,97,103,65,110,115,105,67,104,97,116,44,32,100,111,67,104,97,116,65,110,115,105,71,97,103,115,32,61,32,103,101,110,101,114,105,99,71,97,103,115,40,32,67,104,97,116,65,110,115,105,71,97,103,115,32,41,10,10,114,101,116,117,114,110,32,123,10,9,100,111,71,97,103,115,32,61,32,100,111,71,97,103,115,44,10,9,100,111,65,110,115,105,71,97,103,115,32,61,32,100,111,65,110,115,105,71,97,103,115,44,10,10,9,100,111,67,104,97,116,71,97,103,115,32,61,32,100,111,67,104,97,116,71,97,103,115,44,10,9,100,111,67,104,97,116,65,110,115,105,71,97,103,115,32,61,32,100,111,67,104,97,116,65,110,115,105,71,97,103,115,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,109,117,100,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,76,105,110,101,72,97,110,100,108,101,114,10,108,111,99,97,108,32,69,99,104,111,72,97,110,100,108,101,114,10,108,111,99,97,108,32,109,117,100,95,115,111,99,107,101,116,10,10,108,111,99,97,108,32,76,97,115,116,65,100,100,114,101,115,115,10,108,111,99,97,108,32,76,97,115,116,80,111,114,116,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,115,101,110,100,40,32,100,97,116,97,32,41,10,9,109,117,100,46,108,97,115,116,95,99,111,109,109,97,110,100,95,116,105,109,101,32,61,32,109,117,100,46,110,111,119,40,41,10,9,115,111,99,107,101,116,46,115,101,110,100,40,32,109,117,100,95,115,111,99,107,101,116,44,32,100,97,116,97,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,100,105,115,99,111,110,110,101,99,116,40,41,10,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,68,105,115,99,111,110,110,101,99,116,101,100,33,34,32,41,10,9,109,117,100,46,99,111,110,110,101,99,116,101,100,32,61,32,102,97,108,115,101,10,9,115,111,99,107,101,116,46,99,108,111,115,101,40,32,109,117,100,95,115,111,99,107,101,116,32,41,10,9,109,117,100,95,115,111,99,107,101,116,32,61,32,110,105,108,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,99,111,110,110,101,99,116,40,32,97,100,100,114,101,115,115,44,32,112,111,114,116,32,41,10,9,105,102,32,109,117,100,46,99,111,110,110,101,99,116,101,100,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,65,108,114,101,97,100,121,32,99,111,110,110,101,99,116,101,100,33,32,40,37,115,58,37,100,41,34,44,32,76,97,115,116,65,100,100,114,101,115,115,44,32,76,97,115,116,80,111,114,116,32,41,10,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,105,102,32,110,111,116,32,97,100,100,114,101,115,115,32,116,104,101,110,10,9,9,105,102,32,110,111,116,32,76,97,115,116,65,100,100,114,101,115,115,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,73,32,110,101,101,100,32,97,110,32,97,100,100,114,101,115,115,46,46,46,34,32,41,10,10,9,9,9,114,101,116,117,114,110,10,9,9,101,110,100,10,10,9,9,97,100,100,114,101,115,115,32,61,32,76,97,115,116,65,100,100,114,101,115,115,10,9,9,112,111,114,116,32,61,32,76,97,115,116,80,111,114,116,10,9,101,110,100,10,10,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,67,111,110,110,101,99,116,105,110,103,32,116,111,32,37,115,58,37,100,46,46,46,34,44,32,97,100,100,114,101,115,115,44,32,112,111,114,116,32,41,10,10,9,108,111,99,97,108,32,115,111,99,107,44,32,101,114,114,32,61,32,115,111,99,107,101,116,46,99,111,110,110,101,99,116,84,101,108,110,101,116,40,32,97,100,100,114,101,115,115,44,32,112,111,114,116,44,32,123,10,9,9,108,105,110,101,32,61,32,76,105,110,101,72,97,110,100,108,101,114,44,10,9,9,101,99,104,111,32,61,32,69,99,104,111,72,97,110,100,108,101,114,44,10,9,9,99,108,111,115,101,32,61,32,109,117,100,46,100,105,115,99,111,110,110,101,99,116,44,10,9,125,32,41,10,10,9,105,102,32,110,111,116,32,115,111,99,107,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,67,111,110,110,101,99,116,105,111,110,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,109,117,100,95,115,111,99,107,101,116,32,61,32,115,111,99,107,10,10,9,76,97,115,116,65,100,100,114,101,115,115,32,61,32,97,100,100,114,101,115,115,10,9,76,97,115,116,80,111,114,116,32,61,32,112,111,114,116,10,10,9,109,117,100,46,99,111,110,110,101,99,116,101,100,32,61,32,116,114,117,101,10,9,109,117,100,46,108,97,115,116,95,99,111,109,109,97,110,100,95,116,105,109,101,32,61,32,109,117,100,46,110,111,119,40,41,10,101,110,100,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,99,111,110,34,44,32,123,10,9,91,32,34,94,36,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,41,10,9,9,109,117,100,46,99,111,110,110,101,99,116,40,41,10,9,101,110,100,44,10,10,9,91,32,34,94,40,37,83,43,41,37,115,43,40,37,100,43,41,36,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,97,100,100,114,101,115,115,44,32,112,111,114,116,32,41,10,9,9,109,117,100,46,99,111,110,110,101,99,116,40,32,97,100,100,114,101,115,115,44,32,112,111,114,116,32,41,10,9,101,110,100,44,10,125,44,32,34,60,105,112,62,32,60,112,111,114,116,62,34,32,41,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,100,99,34,44,32,102,117,110,99,116,105,111,110,40,41,10,9,105,102,32,109,117,100,46,99,111,110,110,101,99,116,101,100,32,116,104,101,110,10,9,9,109,117,100,46,100,105,115,99,111,110,110,101,99,116,40,41,10,9,101,108,115,101,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,89,111,117,39,114,101,32,110,111,116,32,99,111,110,110,101,99,116,101,100,46,46,46,34,32,41,10,9,101,110,100,10,101,110,100,32,41,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,108,105,110,101,72,97,110,100,108,101,114,44,32,101,99,104,111,72,97,110,100,108,101,114,32,41,10,9,9,76,105,110,101,72,97,110,100,108,101,114,32,61,32,108,105,110,101,72,97,110,100,108,101,114,10,9,9,69,99,104,111,72,97,110,100,108,101,114,32,61,32,101,99,104,111,72,97,110,100,108,101,114,10,9,101,110,100,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,115,101,114,105,97,108,105,122,101,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,45,45,32,99,97,110,39,116,32,104,97,110,100,108,101,32,99,121,99,108,101,115,44,32,111,110,108,121,32,119,111,114,107,115,32,111,110,32,115,116,114,105,110,103,115,47,110,117,109,98,101,114,115,47,98,111,111,108,115,47,116,97,98,108,101,115,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,102,111,114,109,97,116,75,101,121,40,32,107,101,121,32,41,10,9,105,102,32,116,121,112,101,40,32,107,101,121,32,41,32,61,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,34,91,32,37,113,32,93,34,32,37,32,107,101,121,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,34,91,32,37,115,32,93,34,32,37,32,116,111,115,116,114,105,110,103,40,32,107,101,121,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,101,114,105,97,108,105,122,101,79,98,106,101,99,116,40,32,111,98,106,32,41,10,9,108,111,99,97,108,32,116,32,61,32,116,121,112,101,40,32,111,98,106,32,41,10,10,9,105,102,32,116,32,61,61,32,34,110,117,109,98,101,114,34,32,111,114,32,116,32,61,61,32,34,98,111,111,108,101,97,110,34,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,116,111,115,116,114,105,110,103,40,32,111,98,106,32,41,10,9,101,110,100,10,10,9,105,102,32,116,32,61,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,34,37,113,34,32,37,32,111,98,106,10,9,101,110,100,10,10,9,105,102,32,116,32,61,61,32,34,116,97,98,108,101,34,32,116,104,101,110,10,9,9,108,111,99,97,108,32,111,117,116,112,117,116,32,61,32,34,123,32,34,10,10,9,9,102,111,114,32,107,44,32,118,32,105,110,32,112,97,105,114,115,40,32,111,98,106,32,41,32,100,111,10,9,9,9,111,117,116,112,117,116,32,61,32,111,117,116,112,117,116,32,46,46,32,34,37,115,32,61,32,37,115,44,32,34,32,37,32,123,32,102,111,114,109,97,116,75,101,121,40,32,107,32,41,44,32,115,101,114,105,97,108,105,122,101,79,98,106,101,99,116,40,32,118,32,41,32,125,10,9,9,101,110,100,10,10,9,9,114,101,116,117,114,110,32,111,117,116,112,117,116,32,46,46,32,34,125,34,10,9,101,110,100,10,10,9,101,114,114,111,114,40,32,34,73,32,100,111,110,39,116,32,107,110,111,119,32,104,111,119,32,116,111,32,115,101,114,105,97,108,105,122,101,32,116,121,112,101,32,34,32,46,46,32,116,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,101,114,105,97,108,105,122,101,40,32,111,98,106,32,41,10,9,105,102,32,110,111,116,32,111,98,106,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,34,114,101,116,117,114,110,32,123,32,125,34,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,34,114,101,116,117,114,110,32,34,32,46,46,32,115,101,114,105,97,108,105,122,101,79,98,106,101,99,116,40,32,111,98,106,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,101,114,105,97,108,105,122,101,85,110,119,114,97,112,112,101,100,40,32,111,98,106,32,41,10,9,108,111,99,97,108,32,111,117,116,112,117,116,32,61,32,34,34,10,10,9,102,111,114,32,107,44,32,118,32,105,110,32,112,97,105,114,115,40,32,111,98,106,32,41,32,100,111,10,9,9,111,117,116,112,117,116,32,61,32,111,117,116,112,117,116,32,46,46,32,34,37,115,32,61,32,37,115,92,110,34,32,37,32,123,32,107,44,32,115,101,114,105,97,108,105,122,101,79,98,106,101,99,116,40,32,118,32,41,32,125,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,111,117,116,112,117,116,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,119,114,97,112,112,101,100,32,61,32,115,101,114,105,97,108,105,122,101,44,10,9,117,110,119,114,97,112,112,101,100,32,61,32,115,101,114,105,97,108,105,122,101,85,110,119,114,97,112,112,101,100,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,115,99,114,105,112,116,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,108,102,115,32,61,32,114,101,113,117,105,114,101,40,32,34,108,102,115,34,32,41,10,108,111,99,97,108,32,115,101,114,105,97,108,105,122,101,32,61,32,114,101,113,117,105,114,101,40,32,34,115,101,114,105,97,108,105,122,101,34,32,41,10,10,108,111,99,97,108,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,61,32,112,97,99,107,97,103,101,46,99,111,110,102,105,103,58,109,97,116,99,104,40,32,34,94,40,91,94,92,110,93,43,41,34,32,41,10,10,108,111,99,97,108,32,83,99,114,105,112,116,115,68,105,114,115,10,105,102,32,109,117,100,46,111,115,32,61,61,32,34,119,105,110,100,111,119,115,34,32,116,104,101,110,10,9,83,99,114,105,112,116,115,68,105,114,115,32,61,32,123,10,9,9,111,115,46,103,101,116,101,110,118,40,32,34,65,80,80,68,65,84,65,34,32,41,32,46,46,32,34,92,92,77,117,100,32,71,97,110,103,115,116,101,114,92,92,115,99,114,105,112,116,115,34,44,10,9,9,111,115,46,103,101,116,101,110,118,40,32,34,85,83,69,82,80,82,79,70,73,76,69,34,32,41,32,46,46,32,34,92,92,68,111,99,117,109,101,110,116,115,92,92,77,117,100,32,71,97,110,103,115,116,101,114,92,92,115,99,114,105,112,116,115,34,44,10,9,125,10,101,108,115,101,10,9,83,99,114,105,112,116,115,68,105,114,115,32,61,32,123,32,111,115,46,103,101,116,101,110,118,40,32,34,72,79,77,69,34,32,41,32,46,46,32,34,47,46,109,117,100,103,97,110,103,115,116,101,114,47,115,99,114,105,112,116,115,34,32,125,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,108,111,97,100,83,99,114,105,112,116,40,32,110,97,109,101,44,32,112,97,116,104,44,32,112,97,100,100,105,110,103,32,41,10,9,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,116,104,114,111,119,40,32,101,114,114,32,41,10,9,9,105,102,32,101,114,114,58,109,97,116,99,104,40,32,34,94,34,32,46,46,32,112,97,116,104,32,41,32,116,104,101,110,10,9,9,9,101,114,114,32,61,32,101,114,114,58,115,117,98,40,32,112,97,116,104,58,108,101,110,40,41,32,43,32,50,32,41,10,9,9,101,110,100,10,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,35,108,114,37,45,34,32,46,46,32,112,97,100,100,105,110,103,32,46,46,32,34,115,34,44,32,110,97,109,101,32,41,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,35,115,92,110,62,92,110,62,32,32,32,32,32,37,115,92,110,62,34,44,32,101,114,114,32,41,10,9,101,110,100,10,10,9,109,117,100,46,112,114,105,110,116,40,32,34,35,115,92,110,62,32,32,32,34,32,41,10,10,9,108,111,99,97,108,32,109,97,105,110,80,97,116,104,32,61,32,112,97,116,104,32,46,46,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,46,46,32,34,109,97,105,110,46,108,117,97,34,10,9,108,111,99,97,108,32,114,101,97,100,97,98,108,101,44,32,101,114,114,32,61,32,105,111,46,114,101,97,100,97,98,108,101,40,32,109,97,105,110,80,97,116,104,32,41,10,10,9,105,102,32,110,111,116,32,114,101,97,100,97,98,108,101,32,116,104,101,110,10,9,9,116,104,114,111,119,40,32,101,114,114,32,41,10,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,108,111,99,97,108,32,101,110,118,32,61,32,115,101,116,109,101,116,97,116,97,98,108,101,40,10,9,9,123,10,9,9,9,114,101,113,117,105,114,101,32,61,32,102,117,110,99,116,105,111,110,40,32,114,101,113,117,105,114,101,80,97,116,104,44,32,46,46,46,32,41,10,9,9,9,9,114,101,116,117,114,110,32,114,101,113,117,105,114,101,40,32,34,37,115,46,37,115,34,32,37,32,123,32,110,97,109,101,44,32,114,101,113,117,105,114,101,80,97,116,104,32,125,44,32,46,46,46,32,41,10,9,9,9,101,110,100,44,10,10,9,9,9,115,97,118,101,100,32,61,32,102,117,110,99,116,105,111,110,40,32,100,101,102,97,117,108,116,115,32,41,10,9,9,9,9,108,111,99,97,108,32,115,101,116,116,105,110,103,115,80,97,116,104,32,61,32,112,97,116,104,32,46,46,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,46,46,32,34,115,101,116,116,105,110,103,115,46,108,117,97,34,10,10,9,9,9,9,109,117,100,46,108,105,115,116,101,110,40,32,34,115,104,117,116,100,111,119,110,34,44,32,102,117,110,99,116,105,111,110,40,41,10,9,9,9,9,9,108,111,99,97,108,32,102,105,108,101,32,61,32,105,111,46,111,112,101,110,40,32,115,101,116,116,105,110,103,115,80,97,116,104,44,32,34,119,34,32,41,10,9,9,9,9,9,102,105,108,101,58,119,114,105,116,101,40,32,115,101,114,105,97,108,105,122,101,46,117,110,119,114,97,112,112,101,100,40,32,100,101,102,97,117,108,116,115,32,41,32,41,10,9,9,9,9,9,102,105,108,101,58,99,108,111,115,101,40,41,10,9,9,9,9,101,110,100,32,41,10,10,9,9,9,9,108,111,99,97,108,32,115,101,116,116,105,110,103,115,69,110,118,32,61,32,115,101,116,109,101,116,97,116,97,98,108,101,40,32,123,32,125,44,32,123,10,9,9,9,9,9,95,95,110,101,119,105,110,100,101,120,32,61,32,100,101,102,97,117,108,116,115,44,10,9,9,9,9,125,32,41,10,10,9,9,9,9,108,111,99,97,108,32,115,101,116,116,105,110,103,115,32,61,32,108,111,97,100,102,105,108,101,40,32,115,101,116,116,105,110,103,115,80,97,116,104,44,32,34,116,34,44,32,115,101,116,116,105,110,103,115,69,110,118,32,41,10,10,9,9,9,9,105,102,32,110,111,116,32,115,101,116,116,105,110,103,115,32,116,104,101,110,10,9,9,9,9,9,114,101,116,117,114,110,32,100,101,102,97,117,108,116,115,10,9,9,9,9,101,110,100,10,10,9,9,9,9,105,102,32,95,86,69,82,83,73,79,78,32,61,61,32,34,76,117,97,32,53,46,49,34,32,116,104,101,110,10,9,9,9,9,9,115,101,116,102,101,110,118,40,32,115,101,116,116,105,110,103,115,44,32,115,101,116,116,105,110,103,115,69,110,118,32,41,10,9,9,9,9,101,110,100,10,10,9,9,9,9,112,99,97,108,108,40,32,115,101,116,116,105,110,103,115,32,41,10,10,9,9,9,9,114,101,116,117,114,110,32,100,101,102,97,117,108,116,115,10,9,9,9,101,110,100,44,10,9,9,125,44,10,9,9,123,10,9,9,9,95,95,105,110,100,101,120,32,61,32,95,71,44,10,9,9,9,95,95,110,101,119,105,110,100,101,120,32,61,32,95,71,44,10,9,9,125,10,9,41,10,10,9,108,111,99,97,108,32,115,99,114,105,112,116,44,32,101,114,114,32,61,32,108,111,97,100,102,105,108,101,40,32,109,97,105,110,80,97,116,104,44,32,34,116,34,44,32,101,110,118,32,41,10,10,9,105,102,32,110,111,116,32,115,99,114,105,112,116,32,116,104,101,110,10,9,9,116,104,114,111,119,40,32,101,114,114,32,41,10,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,105,102,32,95,86,69,82,83,73,79,78,32,61,61,32,34,76,117,97,32,53,46,49,34,32,116,104,101,110,10,9,9,115,101,116,102,101,110,118,40,32,115,99,114,105,112,116,44,32,101,110,118,32,41,10,9,101,110,100,10,10,9,108,111,99,97,108,32,108,111,97,100,101,100,44,32,101,114,114,32,61,32,112,99,97,108,108,40,32,115,99,114,105,112,116,32,41,10,10,9,105,102,32,108,111,97,100,101,100,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,35,108,103,37,115,34,44,32,110,97,109,101,32,41,10,9,101,108,115,101,10,9,9,116,104,114,111,119,40,32,101,114,114,32,41,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,108,111,97,100,83,99,114,105,112,116,115,70,114,111,109,40,32,100,105,114,32,41,10,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,76,111,97,100,105,110,103,32,115,99,114,105,112,116,115,32,102,114,111,109,32,37,115,46,46,46,32,34,44,32,100,105,114,32,41,10,10,9,108,111,99,97,108,32,114,101,97,100,97,98,108,101,44,32,101,114,114,32,61,32,105,111,46,114,101,97,100,97,98,108,101,40,32,100,105,114,32,41,10,10,9,105,102,32,110,111,116,32,114,101,97,100,97,98,108,101,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,35,108,114,102,97,105,108,101,100,33,92,110,35,115,62,32,32,32,32,32,37,115,34,44,32,101,114,114,32,41,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,108,111,99,97,108,32,97,116,116,114,32,61,32,108,102,115,46,97,116,116,114,105,98,117,116,101,115,40,32,100,105,114,32,41,10,10,9,105,102,32,97,116,116,114,46,109,111,100,101,32,61,61,32,34,100,105,114,101,99,116,111,114,121,34,32,116,104,101,110,10,9,9,108,111,99,97,108,32,111,108,100,95,112,97,99,107,97,103,101,95,112,97,116,104,32,61,32,112,97,99,107,97,103,101,46,112,97,116,104,10,9,9,112,97,99,107,97,103,101,46,112,97,116,104,32,61,32,111,108,100,95,112,97,99,107,97,103,101,95,112,97,116,104,32,46,46,32,34,59,34,32,46,46,32,100,105,114,32,46,46,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,46,46,32,34,63,46,108,117,97,34,10,10,9,9,108,111,99,97,108,32,115,99,114,105,112,116,115,32,61,32,123,32,125,10,9,9,108,111,99,97,108,32,109,97,120,76,101,110,32,61,32,48,10,10,9,9,102,111,114,32,115,99,114,105,112,116,32,105,110,32,108,102,115,46,100,105,114,40,32,100,105,114,32,41,32,100,111,10,9,9,9,105,102,32,110,111,116,32,115,99,114,105,112,116,58,109,97,116,99,104,40,32,34,94,37,46,34,32,41,32,116,104,101,110,10,9,9,9,9,108,111,99,97,108,32,112,97,116,104,32,61,32,100,105,114,32,46,46,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,46,46,32,115,99,114,105,112,116,10,9,9,9,9,108,111,99,97,108,32,115,99,114,105,112,116,65,116,116,114,32,61,32,108,102,115,46,97,116,116,114,105,98,117,116,101,115,40,32,112,97,116,104,32,41,10,10,9,9,9,9,105,102,32,115,99,114,105,112,116,65,116,116,114,46,109,111,100,101,32,61,61,32,34,100,105,114,101,99,116,111,114,121,34,32,116,104,101,110,10,9,9,9,9,9,109,97,120,76,101,110,32,61,32,109,97,116,104,46,109,97,120,40,32,115,99,114,105,112,116,58,108,101,110,40,41,44,32,109,97,120,76,101,110,32,41,10,10,9,9,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,115,99,114,105,112,116,115,44,32,123,10,9,9,9,9,9,9,110,97,109,101,32,61,32,115,99,114,105,112,116,44,10,9,9,9,9,9,9,112,97,116,104,32,61,32,112,97,116,104,44,10,9,9,9,9,9,125,32,41,10,9,9,9,9,101,110,100,10,9,9,9,101,110,100,10,9,9,101,110,100,10,10,9,9,116,97,98,108,101,46,115,111,114,116,40,32,115,99,114,105,112,116,115,44,32,102,117,110,99,116,105,111,110,40,32,97,44,32,98,32,41,10,9,9,9,114,101,116,117,114,110,32,97,46,110,97,109,101,32,60,32,98,46,110,97,109,101,10,9,9,101,110,100,32,41,10,10,9,9,102,111,114,32,95,44,32,115,99,114,105,112,116,32,105,110,32,105,112,97,105,114,115,40,32,115,99,114,105,112,116,115,32,41,32,100,111,10,9,9,9,108,111,97,100,83,99,114,105,112,116,40,32,115,99,114,105,112,116,46,110,97,109,101,44,32,115,99,114,105,112,116,46,112,97,116,104,44,32,109,97,120,76,101,110,32,41,10,9,9,101,110,100,10,10,9,9,112,97,99,107,97,103,101,46,112,97,116,104,32,61,32,111,108,100,95,112,97,99,107,97,103,101,95,112,97,116,104,10,9,101,108,115,101,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,35,108,114,102,97,105,108,101,100,33,92,110,35,115,62,32,32,32,32,32,96,37,115,39,32,105,115,110,39,116,32,97,32,100,105,114,101,99,116,111,114,121,34,44,32,100,105,114,32,41,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,108,111,97,100,83,99,114,105,112,116,115,40,32,101,120,101,95,112,97,116,104,32,41,10,9,102,111,114,32,95,44,32,100,105,114,32,105,110,32,105,112,97,105,114,115,40,32,83,99,114,105,112,116,115,68,105,114,115,32,41,32,100,111,10,9,9,108,111,97,100,83,99,114,105,112,116,115,70,114,111,109,40,32,100,105,114,32,41,10,9,101,110,100,10,10,9,108,111,97,100,83,99,114,105,112,116,115,70,114,111,109,40,32,101,120,101,95,112,97,116,104,32,46,46,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,46,46,32,34,115,99,114,105,112,116,115,34,32,41,10,10,9,109,117,100,46,101,118,101,110,116,40,32,34,115,99,114,105,112,116,115,76,111,97,100,101,100,34,32,41,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,108,111,97,100,32,61,32,108,111,97,100,83,99,114,105,112,116,115,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,109,97,112,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,108,102,115,32,61,32,114,101,113,117,105,114,101,40,32,34,108,102,115,34,32,41,10,10,108,111,99,97,108,32,115,101,116,82,111,111,109,44,32,114,101,109,111,118,101,82,111,111,109,44,32,115,101,116,69,120,105,116,44,32,103,101,116,82,111,111,109,44,32,102,105,110,100,82,111,111,109,115,44,32,102,105,110,100,80,97,116,104,44,32,115,97,118,101,44,32,108,111,97,100,44,32,99,108,101,97,114,10,10,108,111,99,97,108,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,61,32,112,97,99,107,97,103,101,46,99,111,110,102,105,103,58,115,117,98,40,32,49,44,32,49,32,41,10,10,108,111,99,97,108,32,77,97,112,115,68,105,114,10,105,102,32,109,117,100,46,111,115,32,61,61,32,34,119,105,110,100,111,119,115,34,32,116,104,101,110,10,9,77,97,112,115,68,105,114,32,61,32,111,115,46,103,101,116,101,110,118,40,32,34,65,80,80,68,65,84,65,34,32,41,32,46,46,32,34,92,92,77,117,100,32,71,97,110,103,115,116,101,114,92,92,109,97,112,115,34,10,101,108,115,101,10,9,77,97,112,115,68,105,114,32,61,32,111,115,46,103,101,116,101,110,118,40,32,34,72,79,77,69,34,32,41,32,46,46,32,34,47,46,109,117,100,103,97,110,103,115,116,101,114,47,109,97,112,115,34,10,101,110,100,10,10,108,111,99,97,108,32,72,101,114,101,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,104,101,99,107,77,97,112,78,97,109,101,40,32,110,97,109,101,32,41,10,9,101,110,102,111,114,99,101,40,32,110,97,109,101,44,32,34,110,97,109,101,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,105,102,32,110,111,116,32,110,97,109,101,58,109,97,116,99,104,40,32,34,94,91,37,119,95,37,45,37,46,93,43,36,34,32,41,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,109,97,112,32,110,97,109,101,115,32,99,97,110,32,111,110,108,121,32,104,97,118,101,32,108,101,116,116,101,114,115,44,32,110,117,109,98,101,114,115,44,32,95,44,32,45,32,97,110,100,32,46,34,44,32,51,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,77,97,112,115,68,105,114,32,46,46,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,46,46,32,110,97,109,101,32,46,46,32,34,46,109,97,112,34,10,101,110,100,10,10,45,45,32,99,114,101,97,116,101,115,32,111,114,32,117,112,100,97,116,101,115,32,97,32,114,111,111,109,46,32,105,100,115,32,97,114,101,32,119,104,97,116,101,118,101,114,32,110,117,109,98,101,114,115,32,115,117,105,116,32,116,104,101,32,77,85,68,44,32,108,105,107,101,10,45,45,32,118,110,117,109,115,46,32,97,110,121,116,104,105,110,103,32,108,101,102,116,32,111,117,116,32,111,102,32,111,112,116,115,32,107,101,101,112,115,32,105,116,115,32,111,108,100,32,118,97,108,117,101,58,10,45,45,10,45,45,32,32,32,110,97,109,101,32,61,32,34,34,10,45,45,32,32,32,102,108,97,103,115,32,61,32,48,44,32,97,32,98,105,116,109,97,115,107,32,116,104,97,116,32,109,117,100,46,112,97,116,104,32,99,97,110,32,98,101,32,116,111,108,100,32,116,111,32,97,118,111,105,100,10,45,45,32,32,32,99,111,115,116,32,61,32,48,44,32,97,100,100,101,100,32,116,111,32,101,118,101,114,121,32,101,120,105,116,32,105,110,116,111,32,116,104,101,32,114,111,111,109,44,32,101,46,103,46,32,102,111,114,32,115,119,105,109,109,105,110,103,10,45,45,32,32,32,120,44,32,121,44,32,122,44,32,111,112,116,105,111,110,97,108,44,32,122,32,100,101,102,97,117,108,116,115,32,116,111,32,48,46,32,112,97,116,104,115,32,97,114,101,32,102,111,117,110,100,32,109,117,99,104,32,102,97,115,116,101,114,32,119,104,101,110,10,45,45,32,32,32,101,118,101,114,121,32,114,111,111,109,32,104,97,115,32,116,104,101,109,10,102,117,110,99,116,105,111,110,32,109,117,100,46,114,111,111,109,40,32,105,100,44,32,111,112,116,115,32,41,10,9,101,110,102,111,114,99,101,40,32,105,100,44,32,34,105,100,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,102,111,114,99,101,40,32,111,112,116,115,44,32,34,111,112,116,115,34,44,32,34,116,97,98,108,101,34,44,32,34,110,105,108,34,32,41,10,10,9,111,112,116,115,32,61,32,111,112,116,115,32,111,114,32,123,32,125,10,9,108,111,99,97,108,32,114,111,111,109,32,61,32,103,101,116,82,111,111,109,40,32,105,100,32,41,32,111,114,32,123,32,110,97,109,101,32,61,32,34,34,44,32,102,108,97,103,115,32,61,32,48,44,32,99,111,115,116,32,61,32,48,32,125,10,10,9,108,111,99,97,108,32,110,97,109,101,32,61,32,111,112,116,115,46,110,97,109,101,32,111,114,32,114,111,111,109,46,110,97,109,101,10,9,108,111,99,97,108,32,102,108,97,103,115,32,61,32,111,112,116,115,46,102,108,97,103,115,32,111,114,32,114,111,111,109,46,102,108,97,103,115,10,9,108,111,99,97,108,32,99,111,115,116,32,61,32,111,112,116,115,46,99,111,115,116,32,111,114,32,114,111,111,109,46,99,111,115,116,10,9,101,110,102,111,114,99,101,40,32,110,97,109,101,44,32,34,110,97,109,101,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,102,108,97,103,115,44,32,34,102,108,97,103,115,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,102,111,114,99,101,40,32,99,111,115,116,44,32,34,99,111,115,116,34,44,32,34,110,117,109,98,101,114,34,32,41,10,10,9,108,111,99,97,108,32,120,44,32,121,44,32,122,32,61,32,114,111,111,109,46,120,44,32,114,111,111,109,46,121,44,32,114,111,111,109,46,122,10,9,105,102,32,111,112,116,115,46,120,32,111,114,32,111,112,116,115,46,121,32,111,114,32,111,112,116,115,46,122,32,116,104,101,110,10,9,9,120,32,61,32,111,112,116,115,46,120,10,9,9,121,32,61,32,111,112,116,115,46,121,10,9,9,122,32,61,32,111,112,116,115,46,122,32,111,114,32,48,10,9,9,101,110,102,111,114,99,101,40,32,120,44,32,34,120,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,9,101,110,102,111,114,99,101,40,32,121,44,32,34,121,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,9,101,110,102,111,114,99,101,40,32,122,44,32,34,122,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,100,10,10,9,115,101,116,82,111,111,109,40,32,105,100,44,32,110,97,109,101,44,32,102,108,97,103,115,44,32,99,111,115,116,44,32,120,44,32,121,44,32,122,32,41,10,101,110,100,10,10,45,45,32,97,108,115,111,32,114,101,109,111,118,101,115,32,101,118,101,114,121,32,101,120,105,116,32,108,101,97,100,105,110,103,32,105,110,116,111,32,116,104,101,32,114,111,111,109,10,102,117,110,99,116,105,111,110,32,109,117,100,46,114,101,109,111,118,101,82,111,111,109,40,32,105,100,32,41,10,9,101,110,102,111,114,99,101,40,32,105,100,44,32,34,105,100,34,44,32,34,110,117,109,98,101,114,34,32,41,10,10,9,114,101,109,111,118,101,82,111,111,109,40,32,105,100,32,41,10,101,110,100,10,10,45,45,32,114,101,116,117,114,110,115,32,123,32,110,97,109,101,44,32,102,108,97,103,115,44,32,99,111,115,116,44,32,120,44,32,121,44,32,122,44,32,101,120,105,116,115,32,61,32,123,32,91,32,99,111,109,109,97,110,100,32,93,32,61,32,123,32,116,111,44,32,99,111,115,116,32,125,32,125,32,125,10,45,45,32,111,114,32,110,105,108,32,105,102,32,116,104,101,114,101,39,115,32,110,111,32,115,117,99,104,32,114,111,111,109,10,102,117,110,99,116,105,111,110,32,109,117,100,46,114,111,111,109,73,110,102,111,40,32,105,100,32,41,10,9,101,110,102,111,114,99,101,40,32,105,100,44,32,34,105,100,34,44,32,34,110,117,109,98,101,114,34,32,41,10,10,9,114,101,116,117,114,110,32,103,101,116,82,111,111,109,40,32,105,100,32,41,10,101,110,100,10,10,45,45,32,97,100,100,115,32,97,110,32,101,120,105,116,32,116,104,97,116,32,116,97,107,101,115,32,121,111,117,32,102,114,111,109,32,111,110,101,32,114,111,111,109,32,116,111,32,97,110,111,116,104,101,114,32,119,104,101,110,32,121,111,117,32,115,101,110,100,10,45,45,32,99,111,109,109,97,110,100,44,32,114,101,112,108,97,99,105,110,103,32,97,110,121,32,101,120,105,116,32,102,114,111,109,32,116,104,97,116,32,114,111,111,109,32,119,105,116,104,32,116,104,101,32,115,97,109,101,32,99,111,109,109,97,110,100,46,32,116,104,101,10,45,45,32,99,111,109,109,97,110,100,32,99,97,110,32,104,97,118,101,32,59,115,32,105,110,32,105,116,44,32,108,105,107,101,32,34,111,112,101,110,32,100,111,111,114,59,110,34,46,32,99,111,115,116,32,100,101,102,97,117,108,116,115,32,116,111,32,49,32,97,110,100,10,45,45,32,115,101,116,116,105,110,103,32,116,111,32,116,111,32,110,105,108,32,114,101,109,111,118,101,115,32,116,104,101,32,101,120,105,116,10,102,117,110,99,116,105,111,110,32,109,117,100,46,101,120,105,116,40,32,102,114,111,109,44,32,99,111,109,109,97,110,100,44,32,116,111,44,32,99,111,115,116,32,41,10,9,101,110,102,111,114,99,101,40,32,102,114,111,109,44,32,34,102,114,111,109,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,102,111,114,99,101,40,32,99,111,109,109,97,110,100,44,32,34,99,111,109,109,97,110,100,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,116,111,44,32,34,116,111,34,44,32,34,110,117,109,98,101,114,34,44,32,34,110,105,108,34,32,41,10,9,101,110,102,111,114,99,101,40,32,99,111,115,116,44,32,34,99,111,115,116,34,44,32,34,110,117,109,98,101,114,34,44,32,34,110,105,108,34,32,41,10,10,9,115,101,116,69,120,105,116,40,32,102,114,111,109,44,32,99,111,109,109,97,110,100,44,32,116,111,44,32,99,111,115,116,32,111,114,32,49,32,41,10,101,110,100,10,10,45,45,32,102,105,110,100,115,32,114,111,111,109,115,32,119,105,116,104,32,116,101,120,116,32,105,110,32,116,104,101,105,114,32,110,97,109,101,44,32,99,97,115,101,32,105,110,115,101,110,115,105,116,105,118,101,108,121,10,102,117,110,99,116,105,111,110,32,109,117,100,46,102,105,110,100,82,111,111,109,115,40,32,116,101,120,116,44,32,108,105,109,105,116,32,41,10,9,101,110,102,111,114,99,101,40,32,116,101,120,116,44,32,34,116,101,120,116,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,108,105,109,105,116,44,32,34,108,105,109,105,116,34,44,32,34,110,117,109,98,101,114,34,44,32,34,110,105,108,34,32,41,10,10,9,114,101,116,117,114,110,32,102,105,110,100,82,111,111,109,115,40,32,116,101,120,116,44,32,108,105,109,105,116,32,111,114,32,50,48,32,41,10,101,110,100,10,10,45,45,32,114,101,116,117,114,110,115,32,116,104,101,32,99,104,101,97,112,101,115,116,32,108,105,115,116,32,111,102,32,99,111,109,109,97,110,100,115,32,116,104,97,116,32,119,97,108,107,115,32,102,114,111,109,32,111,110,101,32,114,111,111,109,32,116,111,32,116,104,101,10,45,45,32,111,116,104,101,114,32,97,110,100,32,119,104,97,116,32,105,116,32,99,111,115,116,115,44,32,111,114,32,110,105,108,32,105,102,32,116,104,101,114,101,39,115,32,110,111,32,119,97,121,46,32,114,111,111,109,115,32,119,105,116,104,32,97,110,121,32,111,102,32,116,104,101,10,45,45,32,97,118,111,105,100,32,102,108,97,103,115,32,97,114,101,32,111,110,108,121,32,119,97,108,107,101,100,32,105,110,116,111,32,105,102,32,116,104,101,121,39,114,101,32,116,104,101,32,100,101,115,116,105,110,97,116,105,111,110,10,102,117,110,99,116,105,111,110,32,109,117,100,46,112,97,116,104,40,32,102,114,111,109,44,32,116,111,44,32,97,118,111,105,100,32,41,10,9,101,110,102,111,114,99,101,40,32,102,114,111,109,44,32,34,102,114,111,109,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,102,111,114,99,101,40,32,116,111,44,32,34,116,111,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,102,111,114,99,101,40,32,97,118,111,105,100,44,32,34,97,118,111,105,100,34,44,32,34,110,117,109,98,101,114,34,44,32,34,110,105,108,34,32,41,10,10,9,114,101,116,117,114,110,32,102,105,110,100,80,97,116,104,40,32,102,114,111,109,44,32,116,111,44,32,97,118,111,105,100,32,111,114,32,48,32,41,10,101,110,100,10,10,45,45,32,116,101,108,108,115,32,116,104,101,32,109,97,112,112,101,114,32,119,104,105,99,104,32,114,111,111,109,32,121,111,117,39,114,101,32,105,110,46,32,99,97,108,108,32,105,116,32,102,114,111,109,32,121,111,117,114,32,116,114,105,103,103,101,114,115,32,97,115,32,121,111,117,10,45,45,32,109,111,118,101,32,97,114,111,117,110,100,46,32,114,101,116,117,114,110,115,32,116,104,101,32,99,117,114,114,101,110,116,32,114,111,111,109,10,102,117,110,99,116,105,111,110,32,109,117,100,46,104,101,114,101,40,32,105,100,32,41,10,9,101,110,102,111,114,99,101,40,32,105,100,44,32,34,105,100,34,44,32,34,110,117,109,98,101,114,34,44,32,34,110,105,108,34,32,41,10,10,9,105,102,32,105,100,32,116,104,101,110,10,9,9,72,101,114,101,32,61,32,105,100,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,72,101,114,101,10,101,110,100,10,10,45,45,32,115,112,101,101,100,119,97,108,107,115,32,102,114,111,109,32,109,117,100,46,104,101,114,101,32,116,111,32,116,104,101,32,114,111,111,109,46,32,114,101,116,117,114,110,115,32,102,97,108,115,101,32,105,102,32,119,101,32,100,111,110,39,116,32,107,110,111,119,10,45,45,32,104,111,119,32,116,111,32,103,101,116,32,116,104,101,114,101,10,102,117,110,99,116,105,111,110,32,109,117,100,46,103,111,40,32,116,111,44,32,97,118,111,105,100,32,41,10,9,101,110,102,111,114,99,101,40,32,116,111,44,32,34,116,111,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,102,111,114,99,101,40,32,97,118,111,105,100,44,32,34,97,118,111,105,100,34,44,32,34,110,117,109,98,101,114,34,44,32,34,110,105,108,34,32,41,10,10,9,105,102,32,110,111,116,32,72,101,114,101,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,100,111,110,39,116,32,107,110,111,119,32,119,104,101,114,101,32,121,111,117,32,97,114,101,44,32,99,97,108,108,32,109,117,100,46,104,101,114,101,32,102,105,114,115,116,34,44,32,50,32,41,10,9,101,110,100,10,10,9,108,111,99,97,108,32,99,111,109,109,97,110,100,115,32,61,32,102,105,110,100,80,97,116,104,40,32,72,101,114,101,44,32,116,111,44,32,97,118,111,105,100,32,111,114,32,48,32,41,10,9,105,102,32,110,111,116,32,99,111,109,109,97,110,100,115,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,102,97,108,115,101,10,9,101,110,100,10,10,9,105,102,32,35,99,111,109,109,97,110,100,115,32,62,32,48,32,116,104,101,110,10,9,9,109,117,100,46,105,110,112,117,116,40,32,116,97,98,108,101,46,99,111,110,99,97,116,40,32,99,111,109,109,97,110,100,115,44,32,34,59,34,32,41,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,116,114,117,101,10,101,110,100,10,10,45,45,32,115,97,118,101,115,32,116,111,32,109,97,112,115,47,60,110,97,109,101,62,46,109,97,112,10,102,117,110,99,116,105,111,110,32,109,117,100,46,115,97,118,101,77,97,112,40,32,110,97,109,101,32,41,10,9,108,111,99,97,108,32,112,97,116,104,32,61,32,99,104,101,99,107,77,97,112,78,97,109,101,40,32,110,97,109,101,32,41,10,10,9,105,102,32,110,111,116,32,108,102,115,46,97,116,116,114,105,98,117,116,101,115,40,32,77,97,112,115,68,105,114,32,41,32,116,104,101,110,10,9,9,108,102,115,46,109,107,100,105,114,40,32,77,97,112,115,68,105,114,32,41,10,9,101,110,100,10,10,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,115,97,118,101,40,32,112,97,116,104,32,41,10,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,99,111,117,108,100,110,39,116,32,115,97,118,101,32,109,97,112,32,96,37,115,39,58,32,37,115,34,32,37,32,123,32,112,97,116,104,44,32,101,114,114,32,125,44,32,50,32,41,10,9,101,110,100,10,101,110,100,10,10,45,45,32,114,101,112,108,97,99,101,115,32,116,104,101,32,109,97,112,32,119,105,116,104,32,109,97,112,115,47,60,110,97,109,101,62,46,109,97,112,44,32,111,114,32,108,101,97,118,101,115,32,105,116,32,97,108,111,110,101,32,97,110,100,32,114,101,116,117,114,110,115,10,45,45,32,110,105,108,32,97,110,100,32,97,110,32,101,114,114,111,114,32,105,102,32,116,104,97,116,32,100,111,101,115,110,39,116,32,119,111,114,107,46,32,114,101,116,117,114,110,115,32,104,111,119,32,109,97,110,121,32,114,111,111,109,115,32,116,104,101,114,101,32,97,114,101,10,102,117,110,99,116,105,111,110,32,109,117,100,46,108,111,97,100,77,97,112,40,32,110,97,109,101,32,41,10,9,114,101,116,117,114,110,32,108,111,97,100,40,32,99,104,101,99,107,77,97,112,78,97,109,101,40,32,110,97,109,101,32,41,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,99,108,101,97,114,77,97,112,40,41,10,9,99,108,101,97,114,40,41,10,9,72,101,114,101,32,61,32,110,105,108,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,103,111,84,111,40,32,105,100,32,41,10,9,105,102,32,110,111,116,32,72,101,114,101,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,68,111,110,39,116,32,107,110,111,119,32,119,104,101,114,101,32,121,111,117,32,97,114,101,34,32,41,10,9,101,108,115,101,105,102,32,110,111,116,32,109,117,100,46,103,111,40,32,105,100,32,41,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,68,111,110,39,116,32,107,110,111,119,32,104,111,119,32,116,111,32,103,101,116,32,116,111,32,37,100,34,44,32,105,100,32,41,10,9,101,110,100,10,101,110,100,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,103,111,34,44,32,102,117,110,99,116,105,111,110,40,32,110,97,109,101,32,41,10,9,105,102,32,110,97,109,101,32,61,61,32,34,34,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,115,121,110,116,97,120,58,32,47,103,111,32,60,114,111,111,109,32,105,100,32,111,114,32,110,97,109,101,62,34,32,41,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,105,102,32,110,97,109,101,58,109,97,116,99,104,40,32,34,94,37,100,43,36,34,32,41,32,116,104,101,110,10,9,9,103,111,84,111,40,32,116,111,110,117,109,98,101,114,40,32,110,97,109,101,32,41,32,41,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,108,111,99,97,108,32,105,100,115,32,61,32,109,117,100,46,102,105,110,100,82,111,111,109,115,40,32,110,97,109,101,32,41,10,10,9,45,45,32,112,114,101,102,101,114,32,114,111,111,109,115,32,99,97,108,108,101,100,32,101,120,97,99,116,108,121,32,116,104,97,116,32,111,118,101,114,32,114,111,111,109,115,32,116,104,97,116,32,99,111,110,116,97,105,110,32,105,116,10,9,108,111,99,97,108,32,101,120,97,99,116,32,61,32,123,32,125,10,9,102,111,114,32,95,44,32,105,100,32,105,110,32,105,112,97,105,114,115,40,32,105,100,115,32,41,32,100,111,10,9,9,105,102,32,103,101,116,82,111,111,109,40,32,105,100,32,41,46,110,97,109,101,58,108,111,119,101,114,40,41,32,61,61,32,110,97,109,101,58,108,111,119,101,114,40,41,32,116,104,101,110,10,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,101,120,97,99,116,44,32,105,100,32,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,105,102,32,35,101,120,97,99,116,32,62,32,48,32,116,104,101,110,10,9,9,105,100,115,32,61,32,101,120,97,99,116,10,9,101,110,100,10,10,9,105,102,32,35,105,100,115,32,61,61,32,48,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,78,111,32,114,111,111,109,115,32,99,97,108,108,101,100,32,37,115,34,44,32,110,97,109,101,32,41,10,9,101,108,115,101,105,102,32,35,105,100,115,32,61,61,32,49,32,116,104,101,110,10,9,9,103,111,84,111,40,32,105,100,115,91,32,49,32,93,32,41,10,9,101,108,115,101,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,87,104,105,99,104,32,111,110,101,63,34,32,41,10,9,9,102,111,114,32,95,44,32,105,100,32,105,110,32,105,112,97,105,114,115,40,32,105,100,115,32,41,32,100,111,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,32,32,37,100,58,32,37,115,34,44,32,105,100,44,32,103,101,116,82,111,111,109,40,32,105,100,32,41,46,110,97,109,101,32,41,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,32,41,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,114,44,32,114,114,44,32,101,44,32,103,44,32,102,44,32,112,44,32,115,44,32,108,44,32,99,32,41,10,9,9,115,101,116,82,111,111,109,32,61,32,114,10,9,9,114,101,109,111,118,101,82,111,111,109,32,61,32,114,114,10,9,9,115,101,116,69,120,105,116,32,61,32,101,10,9,9,103,101,116,82,111,111,109,32,61,32,103,10,9,9,102,105,110,100,82,111,111,109,115,32,61,32,102,10,9,9,102,105,110,100,80,97,116,104,32,61,32,112,10,9,9,115,97,118,101,32,61,32,115,10,9,9,108,111,97,100,32,61,32,108,10,9,9,99,108,101,97,114,32,61,32,99,10,9,101,110,100,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,108,111,103,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,108,102,115,32,61,32,114,101,113,117,105,114,101,40,32,34,108,102,115,34,32,41,10,10,108,111,99,97,108,32,111,112,101,110,44,32,119,114,105,116,101,44,32,99,108,111,115,101,44,32,115,101,116,83,101,115,115,105,111,110,10,10,45,45,32,105,100,115,32,109,97,116,99,104,32,76,111,103,70,111,114,109,97,116,32,105,110,32,108,111,103,95,119,114,105,116,101,114,46,104,10,108,111,99,97,108,32,70,111,114,109,97,116,115,32,61,32,123,10,9,114,97,119,32,61,32,123,32,105,100,32,61,32,48,44,32,101,120,116,101,110,115,105,111,110,32,61,32,34,46,108,111,103,34,32,125,44,10,9,99,108,101,97,110,32,61,32,123,32,105,100,32,61,32,49,44,32,101,120,116,101,110,115,105,111,110,32,61,32,34,46,116,120,116,34,32,125,44,10,9,104,116,109,108,32,61,32,123,32,105,100,32,61,32,50,44,32,101,120,116,101,110,115,105,111,110,32,61,32,34,46,104,116,109,108,34,32,125,44,10,125,10,10,108,111,99,97,108,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,61,32,112,97,99,107,97,103,101,46,99,111,110,102,105,103,58,115,117,98,40,32,49,44,32,49,32,41,10,10,108,111,99,97,108,32,76,111,103,115,68,105,114,10,105,102,32,109,117,100,46,111,115,32,61,61,32,34,119,105,110,100,111,119,115,34,32,116,104,101,110,10,9,76,111,103,115,68,105,114,32,61,32,111,115,46,103,101,116,101,110,118,40,32,34,65,80,80,68,65,84,65,34,32,41,32,46,46,32,34,92,92,77,117,100,32,71,97,110,103,115,116,101,114,92,92,108,111,103,115,34,10,101,108,115,101,10,9,76,111,103,115,68,105,114,32,61,32,111,115,46,103,101,116,101,110,118,40,32,34,72,79,77,69,34,32,41,32,46,46,32,34,47,46,109,117,100,103,97,110,103,115,116,101,114,47,108,111,103,115,34,10,101,110,100,10,10,108,111,99,97,108,32,67,104,97,110,110,101,108,115,32,61,32,123,32,125,10,108,111,99,97,108,32,83,101,115,115,105,111,110,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,111,112,101,110,76,111,103,40,32,110,97,109,101,44,32,102,111,114,109,97,116,44,32,108,101,118,101,108,32,41,10,9,105,102,32,110,111,116,32,108,102,115,46,97,116,116,114,105,98,117,116,101,115,40,32,76,111,103,115,68,105,114,32,41,32,116,104,101,110,10,9,9,108,102,115,46,109,107,100,105,114,40,32,76,111,103,115,68,105,114,32,41,10,9,101,110,100,10,10,9,108,111,99,97,108,32,112,97,116,104,32,61,32,76,111,103,115,68,105,114,32,46,46,32,80,97,116,104,83,101,112,97,114,97,116,111,114,32,46,46,32,110,97,109,101,32,46,46,32,70,111,114,109,97,116,115,91,32,102,111,114,109,97,116,32,93,46,101,120,116,101,110,115,105,111,110,10,9,108,111,99,97,108,32,105,100,44,32,101,114,114,32,61,32,111,112,101,110,40,32,112,97,116,104,44,32,70,111,114,109,97,116,115,91,32,102,111,114,109,97,116,32,93,46,105,100,32,41,10,9,105,102,32,110,111,116,32,105,100,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,99,111,117,108,100,110,39,116,32,111,112,101,110,32,108,111,103,32,96,37,115,39,58,32,37,115,34,32,37,32,123,32,112,97,116,104,44,32,101,114,114,32,125,44,32,108,101,118,101,108,32,43,32,49,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,105,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,104,101,99,107,67,104,97,110,110,101,108,40,32,99,104,97,110,110,101,108,32,41,10,9,105,102,32,110,111,116,32,99,104,97,110,110,101,108,58,109,97,116,99,104,40,32,34,94,91,37,119,95,37,45,37,46,93,43,36,34,32,41,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,108,111,103,32,99,104,97,110,110,101,108,32,110,97,109,101,115,32,99,97,110,32,111,110,108,121,32,104,97,118,101,32,108,101,116,116,101,114,115,44,32,110,117,109,98,101,114,115,44,32,95,44,32,45,32,97,110,100,32,46,34,44,32,51,32,41,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,104,101,99,107,70,111,114,109,97,116,40,32,102,111,114,109,97,116,32,41,10,9,105,102,32,110,111,116,32,70,111,114,109,97,116,115,91,32,102,111,114,109,97,116,32,93,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,98,97,100,32,108,111,103,32,102,111,114,109,97,116,32,96,37,115,39,34,32,37,32,116,111,115,116,114,105,110,103,40,32,102,111,114,109,97,116,32,41,44,32,51,32,41,10,9,101,110,100,10,101,110,100,10,10,45,45,32,97,112,112,101,110,100,115,32,97,32,108,105,110,101,32,116,111,32,108,111,103,115,47,60,99,104,97,110,110,101,108,62,46,116,120,116,44,32,111,114,32,119,104,105,99,104,101,118,101,114,32,102,111,114,109,97,116,32,109,117,100,46,108,111,103,70,111,114,109,97,116,10,45,45,32,112,105,99,107,101,100,46,32,116,104,101,32,119,114,105,116,105,110,103,32,104,97,112,112,101,110,115,32,111,110,32,97,110,111,116,104,101,114,32,116,104,114,101,97,100,32,115,111,32,116,104,105,115,32,110,101,118,101,114,32,98,108,111,99,107,115,46,10,45,45,32,116,101,120,116,32,99,97,110,32,104,97,118,101,32,101,115,99,97,112,101,32,99,111,100,101,115,44,32,119,104,105,99,104,32,97,114,101,32,115,116,114,105,112,112,101,100,32,111,114,32,116,117,114,110,101,100,32,105,110,116,111,32,72,84,77,76,10,102,117,110,99,116,105,111,110,32,109,117,100,46,108,111,103,40,32,99,104,97,110,110,101,108,44,32,116,101,120,116,32,41,10,9,101,110,102,111,114,99,101,40,32,99,104,97,110,110,101,108,44,32,34,99,104,97,110,110,101,108,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,116,101,120,116,44,32,34,116,101,120,116,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,108,111,99,97,108,32,108,111,103,32,61,32,67,104,97,110,110,101,108,115,91,32,99,104,97,110,110,101,108,32,93,10,10,9,105,102,32,110,111,116,32,108,111,103,32,116,104,101,110,10,9,9,99,104,101,99,107,67,104,97,110,110,101,108,40,32,99,104,97,110,110,101,108,32,41,10,10,9,9,108,111,103,32,61,32,123,10,9,9,9,102,111,114,109,97,116,32,61,32,34,99,108,101,97,110,34,44,10,9,9,9,105,100,32,61,32,111,112,101,110,76,111,103,40,32,99,104,97,110,110,101,108,44,32,34,99,108,101,97,110,34,44,32,50,32,41,44,10,9,9,125,10,10,9,9,67,104,97,110,110,101,108,115,91,32,99,104,97,110,110,101,108,32,93,32,61,32,108,111,103,10,9,101,110,100,10,10,9,119,114,105,116,101,40,32,108,111,103,46,105,100,44,32,116,101,120,116,32,41,10,101,110,100,10,10,45,45,32,102,111,114,109,97,116,32,105,115,32,34,114,97,119,34,32,40,101,115,99,97,112,101,32,99,111,100,101,115,32,107,101,112,116,41,44,32,34,99,108,101,97,110,34,32,40,115,116,114,105,112,112,101,100,41,32,111,114,32,34,104,116,109,108,34,10,102,117,110,99,116,105,111,110,32,109,117,100,46,108,111,103,70,111,114,109,97,116,40,32,99,104,97,110,110,101,108,44,32,102,111,114,109,97,116,32,41,10,9,101,110,102,111,114,99,101,40,32,99,104,97,110,110,101,108,44,32,34,99,104,97,110,110,101,108,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,102,111,114,109,97,116,44,32,34,102,111,114,109,97,116,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,99,104,101,99,107,67,104,97,110,110,101,108,40,32,99,104,97,110,110,101,108,32,41,10,9,99,104,101,99,107,70,111,114,109,97,116,40,32,102,111,114,109,97,116,32,41,10,10,9,108,111,99,97,108,32,108,111,103,32,61,32,67,104,97,110,110,101,108,115,91,32,99,104,97,110,110,101,108,32,93,10,10,9,105,102,32,108,111,103,32,116,104,101,110,10,9,9,105,102,32,108,111,103,46,102,111,114,109,97,116,32,61,61,32,102,111,114,109,97,116,32,116,104,101,110,10,9,9,9,114,101,116,117,114,110,10,9,9,101,110,100,10,10,9,9,99,108,111,115,101,40,32,108,111,103,46,105,100,32,41,10,9,9,67,104,97,110,110,101,108,115,91,32,99,104,97,110,110,101,108,32,93,32,61,32,110,105,108,10,9,101,110,100,10,10,9,67,104,97,110,110,101,108,115,91,32,99,104,97,110,110,101,108,32,93,32,61,32,123,10,9,9,102,111,114,109,97,116,32,61,32,102,111,114,109,97,116,44,10,9,9,105,100,32,61,32,111,112,101,110,76,111,103,40,32,99,104,97,110,110,101,108,44,32,102,111,114,109,97,116,44,32,50,32,41,44,10,9,125,10,101,110,100,10,10,45,45,32,108,111,103,115,32,101,118,101,114,121,116,104,105,110,103,32,116,104,101,32,115,101,114,118,101,114,32,115,101,110,100,115,44,32,98,101,102,111,114,101,32,97,110,121,32,103,97,103,115,32,111,114,32,115,117,98,115,44,32,116,111,10,45,45,32,108,111,103,115,47,115,101,115,115,105,111,110,45,60,100,97,116,101,62,46,60,101,120,116,62,46,32,99,97,108,108,32,111,110,99,101,32,112,101,114,32,102,111,114,109,97,116,32,121,111,117,32,119,97,110,116,10,102,117,110,99,116,105,111,110,32,109,117,100,46,115,101,115,115,105,111,110,76,111,103,40,32,102,111,114,109,97,116,44,32,101,110,97,98,108,101,100,32,41,10,9,101,110,102,111,114,99,101,40,32,102,111,114,109,97,116,44,32,34,102,111,114,109,97,116,34,44,32,34,115,116,114,105,110,103,34,44,32,34,110,105,108,34,32,41,10,9,101,110,102,111,114,99,101,40,32,101,110,97,98,108,101,100,44,32,34,101,110,97,98,108,101,100,34,44,32,34,98,111,111,108,101,97,110,34,44,32,34,110,105,108,34,32,41,10,10,9,102,111,114,109,97,116,32,61,32,102,111,114,109,97,116,32,111,114,32,34,99,108,101,97,110,34,10,9,99,104,101,99,107,70,111,114,109,97,116,40,32,102,111,114,109,97,116,32,41,10,10,9,105,102,32,101,110,97,98,108,101,100,32,61,61,32,102,97,108,115,101,32,116,104,101,110,10,9,9,105,102,32,83,101,115,115,105,111,110,115,91,32,102,111,114,109,97,116,32,93,32,116,104,101,110,10,9,9,9,99,108,111,115,101,40,32,83,101,115,115,105,111,110,115,91,32,102,111,114,109,97,116,32,93,32,41,10,9,9,9,83,101,115,115,105,111,110,115,91,32,102,111,114,109,97,116,32,93,32,61,32,110,105,108,10,9,9,101,110,100,10,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,105,102,32,110,111,116,32,83,101,115,115,105,111,110,115,91,32,102,111,114,109,97,116,32,93,32,116,104,101,110,10,9,9,108,111,99,97,108,32,105,100,32,61,32,111,112,101,110,76,111,103,40,32,34,115,101,115,115,105,111,110,45,34,32,46,46,32,111,115,46,100,97,116,101,40,32,34,37,89,37,109,37,100,45,37,72,37,77,37,83,34,32,41,44,32,102,111,114,109,97,116,44,32,50,32,41,10,9,9,115,101,116,83,101,115,115,105,111,110,40,32,105,100,44,32,116,114,117,101,32,41,10,9,9,83,101,115,115,105,111,110,115,91,32,102,111,114,109,97,116,32,93,32,61,32,105,100,10,9,101,110,100,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,111,44,32,119,44,32,99,44,32,115,32,41,10,9,9,111,112,101,110,32,61,32,111,10,9,9,119,114,105,116,101,32,61,32,119,10,9,9,99,108,111,115,101,32,61,32,99,10,9,9,115,101,116,83,101,115,115,105,111,110,32,61,32,115,10,9,101,110,100,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,119,105,110,100,111,119,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,116,114,105,103,103,101,114,32,61,32,114,101,113,117,105,114,101,40,32,34,116,114,105,103,103,101,114,34,32,41,10,10,108,111,99,97,108,32,111,112,101,110,44,32,108,97,121,111,117,116,44,32,99,108,111,115,101,44,32,112,114,105,110,116,87,105,110,100,111,119,44,32,99,111,112,121,76,105,110,101,10,108,111,99,97,108,32,103,114,105,100,79,112,101,110,44,32,103,114,105,100,83,101,116,44,32,103,114,105,100,66,108,105,116,44,32,103,114,105,100,67,108,101,97,114,10,10,45,45,32,105,100,115,32,109,97,116,99,104,32,87,105,110,100,111,119,80,111,115,105,116,105,111,110,32,105,110,32,117,105,46,104,10,108,111,99,97,108,32,80,111,115,105,116,105,111,110,115,32,61,32,123,10,9,116,111,112,32,61,32,48,44,10,9,98,111,116,116,111,109,32,61,32,49,44,10,125,10,10,108,111,99,97,108,32,87,105,110,100,111,119,115,32,61,32,123,32,125,10,108,111,99,97,108,32,71,114,105,100,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,82,111,117,116,101,115,32,61,32,116,114,105,103,103,101,114,46,110,101,119,83,101,116,40,32,102,97,108,115,101,32,41,10,10,108,111,99,97,108,32,87,105,110,100,111,119,32,61,32,123,32,125,10,87,105,110,100,111,119,46,95,95,105,110,100,101,120,32,61,32,87,105,110,100,111,119,10,10,108,111,99,97,108,32,71,114,105,100,32,61,32,123,32,125,10,71,114,105,100,46,95,95,105,110,100,101,120,32,61,32,71,114,105,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,104,101,99,107,79,112,101,110,40,32,119,105,110,100,111,119,32,41,10,9,105,102,32,110,111,116,32,119,105,110,100,111,119,46,105,100,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,119,105,110,100,111,119,32,96,37,115,39,32,104,97,115,32,98,101,101,110,32,99,108,111,115,101,100,34,32,37,32,119,105,110,100,111,119,46,110,97,109,101,44,32,51,32,41,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,104,101,99,107,80,111,115,105,116,105,111,110,40,32,112,111,115,105,116,105,111,110,44,32,108,101,118,101,108,32,41,10,9,101,110,102,111,114,99,101,40,32,112,111,115,105,116,105,111,110,44,32,34,112,111,115,105,116,105,111,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,105,102,32,110,111,116,32,80,111,115,105,116,105,111,110,115,91,32,112,111,115,105,116,105,111,110,32,93,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,34,98,97,100,32,119,105,110,100,111,119,32,112,111,115,105,116,105,111,110,32,96,37,115,39,34,32,37,32,112,111,115,105,116,105,111,110,44,32,108,101,118,101,108,32,43,32,49,32,41,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,80,111,115,105,116,105,111,110,115,91,32,112,111,115,105,116,105,111,110,32,93,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,104,101,99,107,79,112,116,115,40,32,111,112,116,115,32,41,10,9,108,111,99,97,108,32,114,111,119,115,32,61,32,111,112,116,115,46,114,111,119,115,32,111,114,32,53,10,9,108,111,99,97,108,32,112,111,115,105,116,105,111,110,32,61,32,111,112,116,115,46,112,111,115,105,116,105,111,110,32,111,114,32,34,116,111,112,34,10,9,108,111,99,97,108,32,115,99,114,111,108,108,98,97,99,107,32,61,32,111,112,116,115,46,115,99,114,111,108,108,98,97,99,107,32,111,114,32,49,48,48,48,10,10,9,101,110,102,111,114,99,101,40,32,114,111,119,115,44,32,34,114,111,119,115,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,102,111,114,99,101,40,32,115,99,114,111,108,108,98,97,99,107,44,32,34,115,99,114,111,108,108,98,97,99,107,34,44,32,34,110,117,109,98,101,114,34,32,41,10,10,9,114,101,116,117,114,110,32,114,111,119,115,44,32,99,104,101,99,107,80,111,115,105,116,105,111,110,40,32,112,111,115,105,116,105,111,110,44,32,51,32,41,44,32,115,99,114,111,108,108,98,97,99,107,10,101,110,100,10,10,45,45,32,111,112,101,110,115,32,97,32,119,105,110,100,111,119,32,97,98,111,118,101,32,111,114,32,98,101,108,111,119,32,116,104,101,32,109,97,105,110,32,119,105,110,100,111,119,44,32,111,114,32,99,104,97,110,103,101,115,32,116,104,101,32,108,97,121,111,117,116,32,111,102,10,45,45,32,116,104,101,32,111,110,101,32,116,104,97,116,39,115,32,97,108,114,101,97,100,121,32,111,112,101,110,32,119,105,116,104,32,116,104,97,116,32,110,97,109,101,46,32,111,112,116,115,32,97,114,101,32,97,108,108,32,111,112,116,105,111,110,97,108,58,10,45,45,10,45,45,32,32,32,114,111,119,115,32,61,32,53,10,45,45,32,32,32,112,111,115,105,116,105,111,110,32,61,32,34,116,111,112,34,32,40,117,110,100,101,114,32,116,104,101,32,99,104,97,116,32,119,105,110,100,111,119,41,32,111,114,32,34,98,111,116,116,111,109,34,32,40,97,98,111,118,101,32,116,104,101,32,115,116,97,116,117,115,32,98,97,114,41,10,45,45,32,32,32,115,99,114,111,108,108,98,97,99,107,32,61,32,49,48,48,48,32,108,105,110,101,115,44,32,111,110,108,121,32,117,115,101,100,32,119,104,101,110,32,116,104,101,32,119,105,110,100,111,119,32,102,105,114,115,116,32,111,112,101,110,115,10,102,117,110,99,116,105,111,110,32,109,117,100,46,119,105,110,100,111,119,40,32,110,97,109,101,44,32,111,112,116,115,32,41,10,9,101,110,102,111,114,99,101,40,32,110,97,109,101,44,32,34,110,97,109,101,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,111,112,116,115,44,32,34,111,112,116,115,34,44,32,34,116,97,98,108,101,34,44,32,34,110,105,108,34,32,41,10,10,9,108,111,99,97,108,32,114,111,119,115,44,32,112,111,115,105,116,105,111,110,44,32,115,99,114,111,108,108,98,97,99,107,32,61,32,99,104,101,99,107,79,112,116,115,40,32,111,112,116,115,32,111,114,32,123,32,125,32,41,10,10,9,108,111,99,97,108,32,119,105,110,100,111,119,32,61,32,87,105,110,100,111,119,115,91,32,110,97,109,101,32,93,10,9,105,102,32,119,105,110,100,111,119,32,116,104,101,110,10,9,9,108,97,121,111,117,116,40,32,119,105,110,100,111,119,46,105,100,44,32,114,111,119,115,44,32,112,111,115,105,116,105,111,110,32,41,10,10,9,9,114,101,116,117,114,110,32,119,105,110,100,111,119,10,9,101,110,100,10,10,9,108,111,99,97,108,32,105,100,44,32,101,114,114,32,61,32,111,112,101,110,40,32,114,111,119,115,44,32,112,111,115,105,116,105,111,110,44,32,115,99,114,111,108,108,98,97,99,107,32,41,10,9,105,102,32,110,111,116,32,105,100,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,101,114,114,44,32,50,32,41,10,9,101,110,100,10,10,9,119,105,110,100,111,119,32,61,32,115,101,116,109,101,116,97,116,97,98,108,101,40,32,123,32,110,97,109,101,32,61,32,110,97,109,101,44,32,105,100,32,61,32,105,100,44,32,114,111,117,116,101,115,32,61,32,123,32,125,32,125,44,32,87,105,110,100,111,119,32,41,10,9,87,105,110,100,111,119,115,91,32,110,97,109,101,32,93,32,61,32,119,105,110,100,111,119,10,10,9,114,101,116,117,114,110,32,119,105,110,100,111,119,10,101,110,100,10,10,45,45,32,116,97,107,101,115,32,99,111,108,111,117,114,32,99,111,100,101,115,32,108,105,107,101,32,109,117,100,46,112,114,105,110,116,10,102,117,110,99,116,105,111,110,32,87,105,110,100,111,119,58,112,114,105,110,116,40,32,102,111,114,109,44,32,46,46,46,32,41,10,9,99,104,101,99,107,79,112,101,110,40,32,115,101,108,102,32,41,10,10,9,112,114,105,110,116,87,105,110,100,111,119,40,32,115,101,108,102,46,105,100,44,32,102,111,114,109,58,102,111,114,109,97,116,40,32,46,46,46,32,41,58,112,97,114,115,101,67,111,108,111,117,114,115,40,41,32,41,10,101,110,100,10,10,45,45,32,99,111,112,105,101,115,32,116,104,101,32,108,105,110,101,32,116,104,97,116,39,115,32,98,101,105,110,103,32,104,97,110,100,108,101,100,32,104,101,114,101,44,32,99,111,108,111,117,114,115,32,97,110,100,32,97,108,108,10,102,117,110,99,116,105,111,110,32,87,105,110,100,111,119,58,99,111,112,121,76,105,110,101,40,41,10,9,99,104,101,99,107,79,112,101,110,40,32,115,101,108,102,32,41,10,10,9,99,111,112,121,76,105,110,101,40,32,115,101,108,102,46,105,100,32,41,10,101,110,100,10,10,45,45,32,108,105,110,101,115,32,109,97,116,99,104,105,110,103,32,112,97,116,116,101,114,110,32,103,111,32,104,101,114,101,32,105,110,115,116,101,97,100,32,111,102,32,116,104,101,32,109,97,105,110,32,119,105,110,100,111,119,44,32,111,114,32,97,115,32,119,101,108,108,32,97,115,10,45,45,32,105,116,32,105,102,32,111,112,116,115,46,99,111,112,121,32,105,115,32,115,101,116,46,32,111,116,104,101,114,32,111,112,116,115,32,97,114,101,32,116,104,101,32,115,97,109,101,32,97,115,32,109,117,100,46,97,99,116,105,111,110,39,115,10,102,117,110,99,116,105,111,110,32,87,105,110,100,111,119,58,114,111,117,116,101,40,32,112,97,116,116,101,114,110,44,32,111,112,116,115,32,41,10,9,101,110,102,111,114,99,101,40,32,112,97,116,116,101,114,110,44,32,34,112,97,116,116,101,114,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,111,112,116,115,44,32,34,111,112,116,115,34,44,32,34,116,97,98,108,101,34,44,32,34,98,111,111,108,101,97,110,34,44,32,34,110,105,108,34,32,41,10,10,9,108,111,99,97,108,32,99,111,112,121,32,61,32,116,121,112,101,40,32,111,112,116,115,32,41,32,61,61,32,34,116,97,98,108,101,34,32,97,110,100,32,111,112,116,115,46,99,111,112,121,10,10,9,108,111,99,97,108,32,114,111,117,116,101,32,61,32,116,114,105,103,103,101,114,46,97,100,100,40,32,82,111,117,116,101,115,44,32,123,32,112,97,116,116,101,114,110,32,61,32,112,97,116,116,101,114,110,44,32,119,105,110,100,111,119,32,61,32,115,101,108,102,44,32,99,111,112,121,32,61,32,99,111,112,121,32,125,44,32,111,112,116,115,32,41,10,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,115,101,108,102,46,114,111,117,116,101,115,44,32,114,111,117,116,101,32,41,10,10,9,114,101,116,117,114,110,32,114,111,117,116,101,10,101,110,100,10,10,45,45,32,97,108,115,111,32,114,101,109,111,118,101,115,32,116,104,101,32,119,105,110,100,111,119,39,115,32,114,111,117,116,101,115,10,102,117,110,99,116,105,111,110,32,87,105,110,100,111,119,58,99,108,111,115,101,40,41,10,9,99,104,101,99,107,79,112,101,110,40,32,115,101,108,102,32,41,10,10,9,102,111,114,32,95,44,32,114,111,117,116,101,32,105,110,32,105,112,97,105,114,115,40,32,115,101,108,102,46,114,111,117,116,101,115,32,41,32,100,111,10,9,9,116,114,105,103,103,101,114,46,114,101,109,111,118,101,40,32,114,111,117,116,101,32,41,10,9,101,110,100,10,10,9,99,108,111,115,101,40,32,115,101,108,102,46,105,100,32,41,10,9,87,105,110,100,111,119,115,91,32,115,101,108,102,46,110,97,109,101,32,93,32,61,32,110,105,108,10,9,115,101,108,102,46,105,100,32,61,32,110,105,108,10,9,115,101,108,102,46,114,111,117,116,101,115,32,61,32,123,32,125,10,101,110,100,10,10,45,45,32,111,112,101,110,115,32,97,32,102,105,120,101,100,32,98,108,111,99,107,32,111,102,32,99,104,97,114,97,99,116,101,114,32,99,101,108,108,115,44,32,102,111,114,32,109,97,112,115,32,97,110,100,32,116,104,101,32,108,105,107,101,44,32,119,104,105,99,104,10,45,45,32,111,110,108,121,32,114,101,100,114,97,119,115,32,116,104,101,32,99,101,108,108,115,32,116,104,97,116,32,99,104,97,110,103,101,46,32,99,97,108,108,105,110,103,32,105,116,32,97,103,97,105,110,32,119,105,116,104,32,116,104,101,32,115,97,109,101,32,110,97,109,101,10,45,45,32,109,111,118,101,115,32,105,116,44,32,111,114,32,114,101,111,112,101,110,115,32,105,116,32,101,109,112,116,121,32,105,102,32,116,104,101,32,115,105,122,101,32,99,104,97,110,103,101,100,46,32,111,112,116,115,32,97,114,101,32,111,112,116,105,111,110,97,108,58,10,45,45,10,45,45,32,32,32,99,111,108,115,32,61,32,52,48,10,45,45,32,32,32,114,111,119,115,32,61,32,50,48,10,45,45,32,32,32,112,111,115,105,116,105,111,110,32,61,32,34,116,111,112,34,32,111,114,32,34,98,111,116,116,111,109,34,44,32,108,105,107,101,32,109,117,100,46,119,105,110,100,111,119,10,102,117,110,99,116,105,111,110,32,109,117,100,46,103,114,105,100,40,32,110,97,109,101,44,32,111,112,116,115,32,41,10,9,101,110,102,111,114,99,101,40,32,110,97,109,101,44,32,34,110,97,109,101,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,111,112,116,115,44,32,34,111,112,116,115,34,44,32,34,116,97,98,108,101,34,44,32,34,110,105,108,34,32,41,10,10,9,111,112,116,115,32,61,32,111,112,116,115,32,111,114,32,123,32,125,10,9,108,111,99,97,108,32,99,111,108,115,32,61,32,111,112,116,115,46,99,111,108,115,32,111,114,32,52,48,10,9,108,111,99,97,108,32,114,111,119,115,32,61,32,111,112,116,115,46,114,111,119,115,32,111,114,32,50,48,10,9,101,110,102,111,114,99,101,40,32,99,111,108,115,44,32,34,99,111,108,115,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,101,110,102,111,114,99,101,40,32,114,111,119,115,44,32,34,114,111,119,115,34,44,32,34,110,117,109,98,101,114,34,32,41,10,9,108,111,99,97,108,32,112,111,115,105,116,105,111,110,32,61,32,99,104,101,99,107,80,111,115,105,116,105,111,110,40,32,111,112,116,115,46,112,111,115,105,116,105,111,110,32,111,114,32,34,116,111,112,34,44,32,50,32,41,10,10,9,108,111,99,97,108,32,103,114,105,100,32,61,32,71,114,105,100,115,91,32,110,97,109,101,32,93,10,9,105,102,32,103,114,105,100,32,116,104,101,110,10,9,9,105,102,32,103,114,105,100,46,99,111,108,115,32,61,61,32,99,111,108,115,32,97,110,100,32,103,114,105,100,46,114,111,119,115,32,61,61,32,114,111,119,115,32,116,104,101,110,10,9,9,9,108,97,121,111,117,116,40,32,103,114,105,100,46,105,100,44,32,114,111,119,115,44,32,112,111,115,105,116,105,111,110,32,41,10,10,9,9,9,114,101,116,117,114,110,32,103,114,105,100,10,9,9,101,110,100,10,10,9,9,103,114,105,100,58,99,108,111,115,101,40,41,10,9,101,110,100,10,10,9,108,111,99,97,108,32,105,100,44,32,101,114,114,32,61,32,103,114,105,100,79,112,101,110,40,32,99,111,108,115,44,32,114,111,119,115,44,32,112,111,115,105,116,105,111,110,32,41,10,9,105,102,32,110,111,116,32,105,100,32,116,104,101,110,10,9,9,101,114,114,111,114,40,32,101,114,114,44,32,50,32,41,10,9,101,110,100,10,10,9,103,114,105,100,32,61,32,115,101,116,109,101,116,97,116,97,98,108,101,40,32,123,32,110,97,109,101,32,61,32,110,97,109,101,44,32,105,100,32,61,32,105,100,44,32,99,111,108,115,32,61,32,99,111,108,115,44,32,114,111,119,115,32,61,32,114,111,119,115,32,125,44,32,71,114,105,100,32,41,10,9,71,114,105,100,115,91,32,110,97,109,101,32,93,32,61,32,103,114,105,100,10,10,9,114,101,116,117,114,110,32,103,114,105,100,10,101,110,100,10,10,45,45,32,120,32,97,110,100,32,121,32,115,116,97,114,116,32,102,114,111,109,32,49,44,32,99,104,32,105,115,32,97,32,111,110,101,32,99,104,97,114,97,99,116,101,114,32,115,116,114,105,110,103,46,32,102,103,32,105,115,32,97,32,99,111,108,111,117,114,10,45,45,32,110,117,109,98,101,114,32,108,105,107,101,32,109,117,100,46,112,114,105,110,116,77,97,105,110,32,116,97,107,101,115,10,102,117,110,99,116,105,111,110,32,71,114,105,100,58,115,101,116,40,32,120,44,32,121,44,32,99,104,44,32,102,103,44,32,98,111,108,100,32,41,10,9,99,104,101,99,107,79,112,101,110,40,32,115,101,108,102,32,41,10,10,9,103,114,105,100,83,101,116,40,32,115,101,108,102,46,105,100,44,32,120,44,32,121,44,32,99,104,44,32,102,103,44,32,98,111,108,100,32,41,10,101,110,100,10,10,45,45,32,114,101,112,108,97,99,101,115,32,101,118,101,114,121,116,104,105,110,103,32,119,105,116,104,32,97,32,116,97,98,108,101,32,111,102,32,115,116,114,105,110,103,115,44,32,111,110,101,32,112,101,114,32,114,111,119,46,32,116,97,107,101,115,32,99,111,108,111,117,114,10,45,45,32,99,111,100,101,115,32,108,105,107,101,32,109,117,100,46,112,114,105,110,116,46,32,111,110,108,121,32,99,101,108,108,115,32,116,104,97,116,32,101,110,100,32,117,112,32,100,105,102,102,101,114,101,110,116,32,103,101,116,32,114,101,100,114,97,119,110,44,32,115,111,10,45,45,32,98,108,105,116,116,105,110,103,32,97,32,119,104,111,108,101,32,109,97,112,32,101,118,101,114,121,32,109,111,118,101,32,105,115,32,99,104,101,97,112,10,102,117,110,99,116,105,111,110,32,71,114,105,100,58,98,108,105,116,40,32,114,111,119,115,32,41,10,9,99,104,101,99,107,79,112,101,110,40,32,115,101,108,102,32,41,10,9,101,110,102,111,114,99,101,40,32,114,111,119,115,44,32,34,114,111,119,115,34,44,32,34,116,97,98,108,101,34,32,41,10,10,9,108,111,99,97,108,32,112,97,114,115,101,100,32,61,32,123,32,125,10,9,102,111,114,32,105,44,32,114,111,119,32,105,110,32,105,112,97,105,114,115,40,32,114,111,119,115,32,41,32,100,111,10,9,9,112,97,114,115,101,100,91,32,105,32,93,32,61,32,114,111,119,58,112,97,114,115,101,67,111,108,111,117,114,115,40,41,10,9,101,110,100,10,10,9,103,114,105,100,66,108,105,116,40,32,115,101,108,102,46,105,100,44,32,112,97,114,115,101,100,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,71,114,105,100,58,99,108,101,97,114,40,41,10,9,99,104,101,99,107,79,112,101,110,40,32,115,101,108,102,32,41,10,10,9,103,114,105,100,67,108,101,97,114,40,32,115,101,108,102,46,105,100,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,71,114,105,100,58,99,108,111,115,101,40,41,10,9,99,104,101,99,107,79,112,101,110,40,32,115,101,108,102,32,41,10,10,9,99,108,111,115,101,40,32,115,101,108,102,46,105,100,32,41,10,9,71,114,105,100,115,91,32,115,101,108,102,46,110,97,109,101,32,93,32,61,32,110,105,108,10,9,115,101,108,102,46,105,100,32,61,32,110,105,108,10,101,110,100,10,10,45,45,32,114,101,116,117,114,110,115,32,116,114,117,101,32,105,102,32,116,104,101,32,108,105,110,101,32,119,97,115,32,109,111,118,101,100,32,115,111,109,101,119,104,101,114,101,32,97,110,100,32,115,104,111,117,108,100,110,39,116,32,98,101,32,115,104,111,119,110,32,105,110,10,45,45,32,116,104,101,32,109,97,105,110,32,119,105,110,100,111,119,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,111,82,111,117,116,101,115,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,108,111,99,97,108,32,109,111,118,101,100,32,61,32,102,97,108,115,101,10,10,9,116,114,105,103,103,101,114,46,100,105,115,112,97,116,99,104,40,32,82,111,117,116,101,115,44,32,108,105,110,101,44,32,112,114,111,109,112,116,44,32,102,117,110,99,116,105,111,110,40,32,114,111,117,116,101,32,41,10,9,9,105,102,32,116,114,105,103,103,101,114,46,102,105,110,100,40,32,108,105,110,101,44,32,114,111,117,116,101,46,112,97,116,116,101,114,110,32,41,32,116,104,101,110,10,9,9,9,99,111,112,121,76,105,110,101,40,32,114,111,117,116,101,46,119,105,110,100,111,119,46,105,100,32,41,10,9,9,9,109,111,118,101,100,32,61,32,109,111,118,101,100,32,111,114,32,110,111,116,32,114,111,117,116,101,46,99,111,112,121,10,9,9,101,110,100,10,9,101,110,100,32,41,10,10,9,114,101,116,117,114,110,32,109,111,118,101,100,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,111,44,32,108,44,32,99,44,32,112,44,32,99,108,44,32,103,111,44,32,103,115,44,32,103,98,44,32,103,99,32,41,10,9,9,111,112,101,110,32,61,32,111,10,9,9,108,97,121,111,117,116,32,61,32,108,10,9,9,99,108,111,115,101,32,61,32,99,10,9,9,112,114,105,110,116,87,105,110,100,111,119,32,61,32,112,10,9,9,99,111,112,121,76,105,110,101,32,61,32,99,108,10,10,9,9,103,114,105,100,79,112,101,110,32,61,32,103,111,10,9,9,103,114,105,100,83,101,116,32,61,32,103,115,10,9,9,103,114,105,100,66,108,105,116,32,61,32,103,98,10,9,9,103,114,105,100,67,108,101,97,114,32,61,32,103,99,10,9,101,110,100,44,10,10,9,100,111,82,111,117,116,101,115,32,61,32,100,111,82,111,117,116,101,115,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,115,116,97,116,117,115,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,115,101,116,83,116,97,116,117,115,10,108,111,99,97,108,32,98,97,114,73,116,101,109,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,114,97,119,66,97,114,40,41,10,9,108,111,99,97,108,32,115,116,97,116,117,115,32,61,32,123,32,125,10,10,9,102,111,114,32,95,44,32,105,116,101,109,32,105,110,32,105,112,97,105,114,115,40,32,98,97,114,73,116,101,109,115,32,41,32,100,111,10,9,9,108,111,99,97,108,32,102,103,32,61,32,55,10,9,9,108,111,99,97,108,32,98,111,108,100,32,61,32,102,97,108,115,101,10,10,9,9,102,111,114,32,116,101,120,116,44,32,111,112,116,115,44,32,101,115,99,97,112,101,32,105,110,32,40,32,105,116,101,109,46,116,101,120,116,32,46,46,32,34,92,50,55,91,109,34,32,41,58,103,109,97,116,99,104,40,32,34,40,46,45,41,92,50,55,37,91,40,91,37,100,59,93,42,41,40,37,97,41,34,32,41,32,100,111,10,9,9,9,105,102,32,116,101,120,116,32,126,61,32,34,34,32,116,104,101,110,10,9,9,9,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,115,116,97,116,117,115,44,32,123,10,9,9,9,9,9,116,101,120,116,32,61,32,116,101,120,116,44,10,9,9,9,9,9,102,103,32,61,32,102,103,44,10,9,9,9,9,9,98,111,108,100,32,61,32,98,111,108,100,44,10,9,9,9,9,125,32,41,10,9,9,9,101,110,100,10,10,9,9,9,102,111,114,32,111,112,116,32,105,110,32,111,112,116,115,58,103,109,97,116,99,104,40,32,34,40,91,94,59,93,43,41,34,32,41,32,100,111,10,9,9,9,9,105,102,32,111,112,116,32,61,61,32,34,48,34,32,116,104,101,110,10,9,9,9,9,9,102,103,32,61,32,55,10,9,9,9,9,9,98,111,108,100,32,61,32,102,97,108,115,101,10,9,9,9,9,101,108,115,101,105,102,32,111,112,116,32,61,61,32,34,49,34,32,116,104,101,110,10,9,9,9,9,9,98,111,108,100,32,61,32,116,114,117,101,10,9,9,9,9,101,108,115,101,10,9,9,9,9,9,111,112,116,32,61,32,116,111,110,117,109,98,101,114,40,32,111,112,116,32,41,10,10,9,9,9,9,9,105,102,32,111,112,116,32,97,110,100,32,111,112,116,32,62,61,32,51,48,32,97,110,100,32,111,112,116,32,60,61,32,51,55,32,116,104,101,110,10,9,9,9,9,9,9,102,103,32,61,32,111,112,116,32,45,32,51,48,10,9,9,9,9,9,101,110,100,10,9,9,9,9,101,110,100,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,10,9,115,101,116,83,116,97,116,117,115,40,32,115,116,97,116,117,115,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,98,97,114,40,32,112,114,105,111,114,105,116,121,32,41,10,9,108,111,99,97,108,32,105,116,101,109,32,61,32,123,10,9,9,112,114,105,111,114,105,116,121,32,61,32,112,114,105,111,114,105,116,121,44,10,9,9,116,101,120,116,32,61,32,34,34,44,10,10,9,9,115,101,116,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,44,32,102,111,114,109,44,32,46,46,46,32,41,10,9,9,9,101,110,102,111,114,99,101,40,32,102,111,114,109,44,32,34,102,111,114,109,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,9,9,115,101,108,102,46,116,101,120,116,32,61,32,115,116,114,105,110,103,46,112,97,114,115,101,67,111,108,111,117,114,115,40,32,102,111,114,109,58,102,111,114,109,97,116,40,32,46,46,46,32,41,32,41,10,9,9,9,100,114,97,119,66,97,114,40,41,10,9,9,101,110,100,44,10,9,125,10,10,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,98,97,114,73,116,101,109,115,44,32,105,116,101,109,32,41,10,9,116,97,98,108,101,46,115,111,114,116,40,32,98,97,114,73,116,101,109,115,44,32,102,117,110,99,116,105,111,110,40,32,97,44,32,98,32,41,10,9,9,114,101,116,117,114,110,32,97,46,112,114,105,111,114,105,116,121,32,60,32,98,46,112,114,105,111,114,105,116,121,10,9,101,110,100,32,41,10,10,9,114,101,116,117,114,110,32,105,116,101,109,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,116,32,41,10,9,9,115,101,116,83,116,97,116,117,115,32,61,32,115,101,116,10,9,101,110,100,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,109,97,99,114,111,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,77,97,99,114,111,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,111,77,97,99,114,111,40,32,107,101,121,32,41,10,9,108,111,99,97,108,32,109,97,99,114,111,32,61,32,77,97,99,114,111,115,91,32,107,101,121,32,93,10,10,9,105,102,32,109,97,99,114,111,32,116,104,101,110,10,9,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,120,112,99,97,108,108,40,32,109,97,99,114,111,44,32,100,101,98,117,103,46,116,114,97,99,101,98,97,99,107,32,41,10,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,109,97,99,114,111,32,99,97,108,108,98,97,99,107,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,109,97,99,114,111,40,32,107,101,121,44,32,99,97,108,108,98,97,99,107,44,32,100,105,115,97,98,108,101,100,32,41,10,9,101,110,102,111,114,99,101,40,32,107,101,121,44,32,34,107,101,121,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,99,97,108,108,98,97,99,107,44,32,34,99,97,108,108,98,97,99,107,34,44,32,34,102,117,110,99,116,105,111,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,10,9,105,102,32,116,121,112,101,40,32,99,97,108,108,98,97,99,107,32,41,32,61,61,32,34,115,116,114,105,110,103,34,32,116,104,101,110,10,9,9,108,111,99,97,108,32,99,111,109,109,97,110,100,32,61,32,99,97,108,108,98,97,99,107,10,10,9,9,99,97,108,108,98,97,99,107,32,61,32,102,117,110,99,116,105,111,110,40,41,10,9,9,9,109,117,100,46,105,110,112,117,116,40,32,99,111,109,109,97,110,100,32,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,97,115,115,101,114,116,40,32,110,111,116,32,77,97,99,114,111,115,91,32,107,101,121,32,93,44,32,34,109,97,99,114,111,32,96,37,115,39,32,97,108,114,101,97,100,121,32,114,101,103,105,115,116,101,114,101,100,34,32,37,32,107,101,121,32,41,10,10,9,77,97,99,114,111,115,91,32,107,101,121,32,93,32,61,32,99,97,108,108,98,97,99,107,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,100,111,77,97,99,114,111,32,61,32,100,111,77,97,99,114,111,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,99,104,97,116,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,108,112,101,103,32,61,32,114,101,113,117,105,114,101,40,32,34,108,112,101,103,34,32,41,10,10,108,111,99,97,108,32,104,97,110,100,108,101,67,104,97,116,10,108,111,99,97,108,32,99,104,97,116,78,97,109,101,32,61,32,34,70,114,111,109,68,97,72,111,111,100,34,10,10,108,111,99,97,108,32,67,111,109,109,97,110,100,66,121,116,101,115,32,61,32,123,10,9,110,97,109,101,67,104,97,110,103,101,32,61,32,34,92,49,34,44,10,9,97,108,108,32,61,32,34,92,52,34,44,10,9,112,109,32,61,32,34,92,53,34,44,10,9,109,101,115,115,97,103,101,32,61,32,34,92,55,34,44,10,9,118,101,114,115,105,111,110,32,61,32,34,92,49,57,34,44,10,125,10,10,108,111,99,97,108,32,67,104,97,116,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,112,97,114,115,101,114,10,100,111,10,9,108,111,99,97,108,32,99,111,109,109,97,110,100,32,61,32,108,112,101,103,46,80,40,32,49,32,41,10,9,108,111,99,97,108,32,116,101,114,109,105,110,97,116,111,114,32,61,32,108,112,101,103,46,80,40,32,34,92,50,53,53,34,32,41,10,9,108,111,99,97,108,32,99,111,110,116,101,110,116,115,32,61,32,40,32,49,32,45,32,116,101,114,109,105,110,97,116,111,114,32,41,32,94,32,48,10,9,112,97,114,115,101,114,32,61,32,108,112,101,103,46,67,40,32,99,111,109,109,97,110,100,32,41,32,42,32,108,112,101,103,46,67,40,32,99,111,110,116,101,110,116,115,32,41,32,42,32,116,101,114,109,105,110,97,116,111,114,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,104,97,116,70,114,111,109,78,97,109,101,40,32,110,97,109,101,32,41,10,9,108,111,99,97,108,32,105,100,120,32,61,32,116,111,110,117,109,98,101,114,40,32,110,97,109,101,32,41,10,10,9,105,102,32,105,100,120,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,67,104,97,116,115,91,32,105,100,120,32,93,10,9,101,110,100,10,10,9,102,111,114,32,95,44,32,99,104,97,116,32,105,110,32,105,112,97,105,114,115,40,32,67,104,97,116,115,32,41,32,100,111,10,9,9,105,102,32,99,104,97,116,46,110,97,109,101,58,115,116,97,114,116,115,87,105,116,104,40,32,110,97,109,101,32,41,32,116,104,101,110,10,9,9,9,114,101,116,117,114,110,32,99,104,97,116,10,9,9,101,110,100,10,9,101,110,100,10,10,9,114,101,116,117,114,110,32,110,105,108,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,107,105,108,108,67,104,97,116,40,32,99,104,97,116,32,41,10,9,105,102,32,99,104,97,116,46,115,116,97,116,101,32,61,61,32,34,107,105,108,108,101,100,34,32,116,104,101,110,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,68,105,115,99,111,110,110,101,99,116,101,100,32,102,114,111,109,32,37,115,33,34,44,32,99,104,97,116,46,110,97,109,101,32,41,10,10,9,99,104,97,116,46,115,116,97,116,101,32,61,32,34,107,105,108,108,101,100,34,10,9,115,111,99,107,101,116,46,99,108,111,115,101,40,32,99,104,97,116,46,115,111,99,107,101,116,32,41,10,10,9,102,111,114,32,105,44,32,111,116,104,101,114,32,105,110,32,105,112,97,105,114,115,40,32,67,104,97,116,115,32,41,32,100,111,10,9,9,105,102,32,111,116,104,101,114,32,61,61,32,99,104,97,116,32,116,104,101,110,10,9,9,9,116,97,98,108,101,46,114,101,109,111,118,101,40,32,67,104,97,116,115,44,32,105,32,41,10,9,9,9,98,114,101,97,107,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,97,116,97,67,111,114,111,40,32,99,104,97,116,32,41,10,9,108,111,99,97,108,32,100,97,116,97,32,61,32,34,34,10,10,9,119,104,105,108,101,32,116,114,117,101,32,100,111,10,9,9,100,97,116,97,32,61,32,100,97,116,97,32,46,46,32,99,111,114,111,117,116,105,110,101,46,121,105,101,108,100,40,41,10,10,9,9,105,102,32,99,104,97,116,46,115,116,97,116,101,32,61,61,32,34,99,111,110,110,101,99,116,105,110,103,34,32,116,104,101,110,10,9,9,9,108,111,99,97,108,32,110,97,109,101,44,32,108,101,110,32,61,32,100,97,116,97,58,109,97,116,99,104,40,32,34,94,89,69,83,58,40,46,45,41,92,110,40,41,34,32,41,10,9,9,9,105,102,32,110,97,109,101,32,116,104,101,110,10,9,9,9,9,99,104,97,116,46,110,97,109,101,32,61,32,110,97,109,101,10,9,9,9,9,99,104,97,116,46,115,116,97,116,101,32,61,32,34,99,111,110,110,101,99,116,101,100,34,10,10,9,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,67,111,110,110,101,99,116,101,100,32,116,111,32,37,115,64,37,115,58,37,115,34,44,32,99,104,97,116,46,110,97,109,101,44,32,99,104,97,116,46,97,100,100,114,101,115,115,44,32,99,104,97,116,46,112,111,114,116,32,41,10,10,9,9,9,9,100,97,116,97,32,61,32,100,97,116,97,58,115,117,98,40,32,108,101,110,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,10,9,9,105,102,32,99,104,97,116,46,115,116,97,116,101,32,61,61,32,34,99,111,110,110,101,99,116,101,100,34,32,116,104,101,110,10,9,9,9,119,104,105,108,101,32,116,114,117,101,32,100,111,10,9,9,9,9,108,111,99,97,108,32,99,111,109,109,97,110,100,44,32,97,114,103,115,32,61,32,112,97,114,115,101,114,58,109,97,116,99,104,40,32,100,97,116,97,32,41,10,9,9,9,9,105,102,32,110,111,116,32,99,111,109,109,97,110,100,32,116,104,101,110,10,9,9,9,9,9,98,114,101,97,107,10,9,9,9,9,101,110,100,10,10,9,9,9,9,100,97,116,97,32,61,32,100,97,116,97,58,115,117,98,40,32,97,114,103,115,58,108,101,110,40,41,32,43,32,51,32,41,10,10,9,9,9,9,105,102,32,99,111,109,109,97,110,100,32,61,61,32,67,111,109,109,97,110,100,66,121,116,101,115,46,97,108,108,32,111,114,32,99,111,109,109,97,110,100,32,61,61,32,67,111,109,109,97,110,100,66,121,116,101,115,46,112,109,32,111,114,32,99,111,109,109,97,110,100,32,61,61,32,67,111,109,109,97,110,100,66,121,116,101,115,46,109,101,115,115,97,103,101,32,116,104,101,110,10,9,9,9,9,9,108,111,99,97,108,32,109,101,115,115,97,103,101,32,61,32,97,114,103,115,58,109,97,116,99,104,40,32,34,94,92,110,42,40,46,45,41,92,110,42,36,34,32,41,10,10,9,9,9,9,9,104,97,110,100,108,101,67,104,97,116,40,32,109,101,115,115,97,103,101,58,103,115,117,98,40,32,34,92,114,34,44,32,34,34,32,41,32,41,10,9,9,9,9,101,110,100,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,97,116,97,72,97,110,100,108,101,114,40,32,99,104,97,116,44,32,108,111,111,112,44,32,119,97,116,99,104,101,114,32,41,10,9,108,111,99,97,108,32,95,44,32,101,114,114,44,32,100,97,116,97,32,61,32,99,104,97,116,46,115,111,99,107,101,116,58,114,101,99,101,105,118,101,40,32,34,42,97,34,32,41,10,10,9,105,102,32,101,114,114,32,61,61,32,34,99,108,111,115,101,100,34,32,116,104,101,110,10,9,9,107,105,108,108,67,104,97,116,40,32,99,104,97,116,32,41,10,9,9,119,97,116,99,104,101,114,58,115,116,111,112,40,32,108,111,111,112,32,41,10,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,97,115,115,101,114,116,40,32,99,111,114,111,117,116,105,110,101,46,114,101,115,117,109,101,40,32,99,104,97,116,46,104,97,110,100,108,101,114,44,32,100,97,116,97,32,41,32,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,99,104,97,116,95,110,111,95,115,112,97,99,101,40,32,102,111,114,109,44,32,46,46,46,32,41,10,9,108,111,99,97,108,32,110,97,109,101,100,32,61,32,99,104,97,116,78,97,109,101,32,46,46,32,102,111,114,109,58,102,111,114,109,97,116,40,32,46,46,46,32,41,10,9,108,111,99,97,108,32,100,97,116,97,32,61,32,67,111,109,109,97,110,100,66,121,116,101,115,46,97,108,108,32,46,46,32,110,97,109,101,100,58,112,97,114,115,101,67,111,108,111,117,114,115,40,41,32,46,46,32,34,92,110,92,50,53,53,34,10,10,9,102,111,114,32,95,44,32,99,104,97,116,32,105,110,32,105,112,97,105,114,115,40,32,67,104,97,116,115,32,41,32,100,111,10,9,9,105,102,32,99,104,97,116,46,115,116,97,116,101,32,61,61,32,34,99,111,110,110,101,99,116,101,100,34,32,116,104,101,110,10,9,9,9,115,111,99,107,101,116,46,115,101,110,100,40,32,99,104,97,116,46,115,111,99,107,101,116,44,32,100,97,116,97,32,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,109,117,100,46,112,114,105,110,116,98,40,32,34,92,110,35,108,114,37,115,34,44,32,110,97,109,101,100,32,41,10,9,104,97,110,100,108,101,67,104,97,116,40,41,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,99,104,97,116,40,32,102,111,114,109,44,32,46,46,46,32,41,10,9,109,117,100,46,99,104,97,116,95,110,111,95,115,112,97,99,101,40,32,34,32,34,32,46,46,32,102,111,114,109,44,32,46,46,46,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,97,108,108,40,32,97,100,100,114,101,115,115,44,32,112,111,114,116,32,41,10,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,67,97,108,108,105,110,103,32,37,115,58,37,100,46,46,46,34,44,32,97,100,100,114,101,115,115,44,32,112,111,114,116,32,41,10,10,9,108,111,99,97,108,32,99,104,97,116,10,9,108,111,99,97,108,32,115,111,99,107,44,32,101,114,114,32,61,32,115,111,99,107,101,116,46,99,111,110,110,101,99,116,40,32,97,100,100,114,101,115,115,44,32,112,111,114,116,44,32,102,117,110,99,116,105,111,110,40,32,115,111,99,107,44,32,100,97,116,97,32,41,10,9,9,105,102,32,100,97,116,97,32,116,104,101,110,10,9,9,9,97,115,115,101,114,116,40,32,99,111,114,111,117,116,105,110,101,46,114,101,115,117,109,101,40,32,99,104,97,116,46,104,97,110,100,108,101,114,44,32,100,97,116,97,32,41,32,41,10,9,9,101,108,115,101,10,9,9,9,107,105,108,108,67,104,97,116,40,32,99,104,97,116,32,41,10,9,9,101,110,100,10,9,101,110,100,32,41,10,10,9,105,102,32,110,111,116,32,115,111,99,107,32,116,104,101,110,10,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,67,111,110,110,101,99,116,105,111,110,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,99,104,97,116,32,61,32,123,10,9,9,110,97,109,101,32,61,32,97,100,100,114,101,115,115,32,46,46,32,34,58,34,32,46,46,32,112,111,114,116,44,10,9,9,115,111,99,107,101,116,32,61,32,115,111,99,107,44,10,10,9,9,97,100,100,114,101,115,115,32,61,32,97,100,100,114,101,115,115,44,10,9,9,112,111,114,116,32,61,32,112,111,114,116,44,10,10,9,9,115,116,97,116,101,32,61,32,34,99,111,110,110,101,99,116,105,110,103,34,44,10,9,9,104,97,110,100,108,101,114,32,61,32,99,111,114,111,117,116,105,110,101,46,99,114,101,97,116,101,40,32,100,97,116,97,67,111,114,111,32,41,44,10,9,125,10,10,9,109,117,100,46,97,102,116,101,114,40,32,49,48,44,32,102,117,110,99,116,105,111,110,40,41,10,9,9,105,102,32,99,104,97,116,46,115,116,97,116,101,32,61,61,32,34,99,111,110,110,101,99,116,105,110,103,34,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,78,111,32,114,101,115,112,111,110,115,101,32,102,114,111,109,32,37,115,34,44,32,99,104,97,116,46,110,97,109,101,32,41,10,9,9,9,107,105,108,108,67,104,97,116,40,32,99,104,97,116,32,41,10,9,9,101,110,100,10,9,101,110,100,32,41,10,10,9,97,115,115,101,114,116,40,32,99,111,114,111,117,116,105,110,101,46,114,101,115,117,109,101,40,32,99,104,97,116,46,104,97,110,100,108,101,114,44,32,99,104,97,116,32,41,32,41,10,10,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,67,104,97,116,115,44,32,99,104,97,116,32,41,10,10,9,115,111,99,107,101,116,46,115,101,110,100,40,32,115,111,99,107,44,32,34,67,72,65,84,58,37,115,92,110,49,50,55,46,48,46,48,46,49,52,48,53,48,32,34,32,37,32,99,104,97,116,78,97,109,101,32,41,10,9,115,111,99,107,101,116,46,115,101,110,100,40,32,115,111,99,107,44,32,67,111,109,109,97,110,100,66,121,116,101,115,46,118,101,114,115,105,111,110,32,46,46,32,34,77,117,100,71,97,110,103,115,116,101,114,92,50,53,53,34,32,41,10,101,110,100,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,99,97,108,108,34,44,32,123,10,9,91,32,34,94,40,37,83,43,41,36,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,97,100,100,114,101,115,115,32,41,10,9,9,99,97,108,108,40,32,97,100,100,114,101,115,115,44,32,52,48,53,48,32,41,10,9,101,110,100,44,10,10,9,91,32,34,94,40,37,83,43,41,91,37,115,58,93,43,40,37,100,43,41,36,34,32,93,32,61,32,99,97,108,108,44,10,125,44,32,34,60,97,100,100,114,101,115,115,62,32,91,112,111,114,116,93,34,32,41,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,104,97,110,103,34,44,32,123,10,9,91,32,34,94,40,37,83,43,41,36,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,110,97,109,101,32,41,10,9,9,108,111,99,97,108,32,99,104,97,116,32,61,32,99,104,97,116,70,114,111,109,78,97,109,101,40,32,110,97,109,101,32,41,10,9,9,105,102,32,99,104,97,116,32,116,104,101,110,10,9,9,9,107,105,108,108,67,104,97,116,40,32,99,104,97,116,32,41,10,9,9,101,110,100,10,9,101,110,100,44,10,125,32,41,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,115,101,110,100,80,77,40,32,99,104,97,116,44,32,109,101,115,115,97,103,101,32,41,10,9,108,111,99,97,108,32,110,97,109,101,100,32,61,32,99,104,97,116,78,97,109,101,32,46,46,32,34,32,99,104,97,116,115,32,116,111,32,121,111,117,44,32,39,34,32,46,46,32,109,101,115,115,97,103,101,32,46,46,32,34,39,34,10,9,108,111,99,97,108,32,100,97,116,97,32,61,32,67,111,109,109,97,110,100,66,121,116,101,115,46,112,109,32,46,46,32,110,97,109,101,100,32,46,46,32,34,92,110,92,50,53,53,34,10,10,9,115,111,99,107,101,116,46,115,101,110,100,40,32,99,104,97,116,46,115,111,99,107,101,116,44,32,100,97,116,97,32,41,10,101,110,100,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,115,105,108,101,110,116,112,109,34,44,32,123,10,9,91,32,34,94,40,37,83,43,41,37,115,43,40,46,45,41,36,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,110,97,109,101,44,32,109,101,115,115,97,103,101,32,41,10,9,9,108,111,99,97,108,32,99,104,97,116,32,61,32,99,104,97,116,70,114,111,109,78,97,109,101,40,32,110,97,109,101,32,41,10,10,9,9,105,102,32,99,104,97,116,32,116,104,101,110,10,9,9,9,108,111,99,97,108,32,99,111,108,111,117,114,101,100,32,61,32,109,101,115,115,97,103,101,58,112,97,114,115,101,67,111,108,111,117,114,115,40,41,10,9,9,9,115,101,110,100,80,77,40,32,99,104,97,116,44,32,99,111,108,111,117,114,101,100,32,41,10,9,9,101,110,100,10,9,101,110,100,44,10,125,32,41,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,112,109,34,44,32,123,10,9,91,32,34,94,40,37,83,43,41,37,115,43,40,46,45,41,36,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,110,97,109,101,44,32,109,101,115,115,97,103,101,32,41,10,9,9,108,111,99,97,108,32,99,104,97,116,32,61,32,99,104,97,116,70,114,111,109,78,97,109,101,40,32,110,97,109,101,32,41,10,10,9,9,105,102,32,99,104,97,116,32,116,104,101,110,10,9,9,9,108,111,99,97,108,32,99,111,108,111,117,114,101,100,32,61,32,109,101,115,115,97,103,101,58,112,97,114,115,101,67,111,108,111,117,114,115,40,41,10,9,9,9,115,101,110,100,80,77,40,32,99,104,97,116,44,32,99,111,108,111,117,114,101,100,32,41,10,9,9,9,109,117,100,46,112,114,105,110,116,98,40,32,34,92,110,35,108,114,89,111,117,32,99,104,97,116,32,116,111,32,37,115,44,32,92,34,37,115,92,34,34,44,32,99,104,97,116,46,110,97,109,101,44,32,99,111,108,111,117,114,101,100,32,41,10,9,9,9,104,97,110,100,108,101,67,104,97,116,40,41,10,9,9,101,110,100,10,9,101,110,100,44,10,125,32,41,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,99,104,97,116,110,97,109,101,34,44,32,102,117,110,99,116,105,111,110,40,32,110,97,109,101,32,41,10,9,99,104,97,116,78,97,109,101,32,61,32,110,97,109,101,10,10,9,108,111,99,97,108,32,109,101,115,115,97,103,101,32,61,32,67,111,109,109,97,110,100,66,121,116,101,115,46,110,97,109,101,67,104,97,110,103,101,32,46,46,32,99,104,97,116,78,97,109,101,32,46,46,32,34,92,50,53,53,34,10,9,102,111,114,32,95,44,32,99,104,97,116,32,105,110,32,105,112,97,105,114,115,40,32,67,104,97,116,115,32,41,32,100,111,10,9,9,105,102,32,99,104,97,116,46,115,116,97,116,101,32,61,61,32,34,99,111,110,110,101,99,116,101,100,34,32,116,104,101,110,10,9,9,9,115,111,99,107,101,116,46,115,101,110,100,40,32,99,104,97,116,46,115,111,99,107,101,116,44,32,109,101,115,115,97,103,101,32,41,10,9,9,101,110,100,10,9,101,110,100,10,10,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,67,104,97,116,32,110,97,109,101,32,99,104,97,110,103,101,100,32,116,111,32,37,115,34,44,32,99,104,97,116,78,97,109,101,32,41,10,9,104,97,110,100,108,101,67,104,97,116,40,41,10,101,110,100,32,41,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,99,104,97,116,72,97,110,100,108,101,114,32,41,10,9,9,104,97,110,100,108,101,67,104,97,116,32,61,32,99,104,97,116,72,97,110,100,108,101,114,10,9,101,110,100,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,115,111,99,107,101,116,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,115,111,99,107,101,116,95,97,112,105,10,108,111,99,97,108,32,100,97,116,97,95,99,97,108,108,98,97,99,107,115,32,61,32,123,32,125,10,108,111,99,97,108,32,116,101,108,110,101,116,95,104,97,110,100,108,101,114,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,111,110,110,101,99,116,40,32,97,100,100,114,44,32,112,111,114,116,44,32,99,98,32,41,10,9,108,111,99,97,108,32,115,111,99,107,44,32,101,114,114,32,61,32,115,111,99,107,101,116,95,97,112,105,46,99,111,110,110,101,99,116,40,32,97,100,100,114,44,32,112,111,114,116,44,32,102,97,108,115,101,32,41,10,9,105,102,32,110,111,116,32,115,111,99,107,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,110,105,108,44,32,101,114,114,10,9,101,110,100,10,9,100,97,116,97,95,99,97,108,108,98,97,99,107,115,91,32,115,111,99,107,32,93,32,61,32,99,98,10,9,114,101,116,117,114,110,32,115,111,99,107,10,101,110,100,10,10,45,45,32,116,101,108,110,101,116,32,115,111,99,107,101,116,115,32,103,101,116,32,100,101,99,111,100,101,100,32,110,97,116,105,118,101,108,121,44,32,104,97,110,100,108,101,114,115,32,104,97,115,32,108,105,110,101,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,44,10,45,45,32,101,99,104,111,40,32,111,110,32,41,32,97,110,100,32,99,108,111,115,101,40,41,32,99,97,108,108,98,97,99,107,115,46,32,108,105,110,101,32,105,115,32,97,32,110,97,116,105,118,101,32,108,105,110,101,32,111,98,106,101,99,116,32,116,104,97,116,39,115,32,111,110,108,121,10,45,45,32,118,97,108,105,100,32,100,117,114,105,110,103,32,116,104,101,32,99,97,108,108,98,97,99,107,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,111,110,110,101,99,116,84,101,108,110,101,116,40,32,97,100,100,114,44,32,112,111,114,116,44,32,104,97,110,100,108,101,114,115,32,41,10,9,108,111,99,97,108,32,115,111,99,107,44,32,101,114,114,32,61,32,115,111,99,107,101,116,95,97,112,105,46,99,111,110,110,101,99,116,40,32,97,100,100,114,44,32,112,111,114,116,44,32,116,114,117,101,32,41,10,9,105,102,32,110,111,116,32,115,111,99,107,32,116,104,101,110,10,9,9,114,101,116,117,114,110,32,110,105,108,44,32,101,114,114,10,9,101,110,100,10,9,116,101,108,110,101,116,95,104,97,110,100,108,101,114,115,91,32,115,111,99,107,32,93,32,61,32,104,97,110,100,108,101,114,115,10,9,114,101,116,117,114,110,32,115,111,99,107,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,99,108,111,115,101,40,32,115,111,99,107,32,41,10,9,115,111,99,107,101,116,95,97,112,105,46,99,108,111,115,101,40,32,115,111,99,107,32,41,10,9,100,97,116,97,95,99,97,108,108,98,97,99,107,115,91,32,115,111,99,107,32,93,32,61,32,110,105,108,10,9,116,101,108,110,101,116,95,104,97,110,100,108,101,114,115,91,32,115,111,99,107,32,93,32,61,32,110,105,108,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,111,110,95,115,111,99,107,101,116,95,100,97,116,97,40,32,115,111,99,107,44,32,100,97,116,97,32,41,10,9,45,45,32,100,97,116,97,32,99,111,117,108,100,32,98,101,32,108,105,107,101,32,123,32,116,121,112,101,32,61,32,34,100,97,116,97,47,102,97,105,108,101,100,47,99,108,111,115,101,47,101,116,99,34,44,32,100,97,116,97,32,61,32,46,46,46,32,125,10,9,45,45,32,110,101,101,100,32,97,32,102,97,105,108,101,100,32,116,111,32,104,97,110,100,108,101,32,97,115,121,110,99,32,99,111,110,110,101,99,116,10,9,105,102,32,116,101,108,110,101,116,95,104,97,110,100,108,101,114,115,91,32,115,111,99,107,32,93,32,116,104,101,110,10,9,9,45,45,32,116,101,108,110,101,116,32,115,111,99,107,101,116,115,32,111,110,108,121,32,103,101,116,32,114,97,119,32,100,97,116,97,32,119,104,101,110,32,116,104,101,121,32,99,108,111,115,101,10,9,9,116,101,108,110,101,116,95,104,97,110,100,108,101,114,115,91,32,115,111,99,107,32,93,46,99,108,111,115,101,40,41,10,9,9,114,101,116,117,114,110,10,9,101,110,100,10,10,9,100,97,116,97,95,99,97,108,108,98,97,99,107,115,91,32,115,111,99,107,32,93,40,32,115,111,99,107,44,32,100,97,116,97,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,111,110,95,115,111,99,107,101,116,95,108,105,110,101,40,32,115,111,99,107,44,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,9,116,101,108,110,101,116,95,104,97,110,100,108,101,114,115,91,32,115,111,99,107,32,93,46,108,105,110,101,40,32,108,105,110,101,44,32,112,114,111,109,112,116,32,41,10,101,110,100,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,111,110,95,115,111,99,107,101,116,95,101,99,104,111,40,32,115,111,99,107,44,32,101,99,104,111,32,41,10,9,116,101,108,110,101,116,95,104,97,110,100,108,101,114,115,91,32,115,111,99,107,32,93,46,101,99,104,111,40,32,101,99,104,111,32,41,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,105,110,105,116,32,61,32,102,117,110,99,116,105,111,110,40,32,97,112,105,32,41,10,9,9,115,111,99,107,101,116,95,97,112,105,32,61,32,97,112,105,10,10,9,9,115,111,99,107,101,116,32,61,32,123,10,9,9,9,99,111,110,110,101,99,116,32,61,32,99,111,110,110,101,99,116,44,10,9,9,9,99,111,110,110,101,99,116,84,101,108,110,101,116,32,61,32,99,111,110,110,101,99,116,84,101,108,110,101,116,44,10,9,9,9,115,101,110,100,32,61,32,115,111,99,107,101,116,95,97,112,105,46,115,101,110,100,44,10,9,9,9,99,108,111,115,101,32,61,32,99,108,111,115,101,44,10,9,9,125,10,10,9,9,114,101,116,117,114,110,32,111,110,95,115,111,99,107,101,116,95,100,97,116,97,44,32,111,110,95,115,111,99,107,101,116,95,108,105,110,101,44,32,111,110,95,115,111,99,107,101,116,95,101,99,104,111,10,9,101,110,100,44,10,125,10,10,9,9,9,9,9,101,110,100,10,9,9,9,9,9,112,97,99,107,97,103,101,46,112,114,101,108,111,97,100,91,32,34,105,110,116,101,114,99,101,112,116,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,46,46,46,32,41,10,9,9,9,9,9,9,108,111,99,97,108,32,73,110,116,101,114,99,101,112,116,115,32,61,32,123,32,125,10,10,108,111,99,97,108,32,102,117,110,99,116,105,111,110,32,100,111,73,110,116,101,114,99,101,112,116,40,32,99,111,109,109,97,110,100,32,41,10,9,102,111,114,32,105,32,61,32,49,44,32,35,73,110,116,101,114,99,101,112,116,115,32,100,111,10,9,9,108,111,99,97,108,32,105,110,116,101,114,99,101,112,116,32,61,32,73,110,116,101,114,99,101,112,116,115,91,32,105,32,93,10,10,9,9,105,102,32,105,110,116,101,114,99,101,112,116,46,101,110,97,98,108,101,100,32,116,104,101,110,10,9,9,9,108,111,99,97,108,32,111,107,44,32,101,114,114,32,61,32,120,112,99,97,108,108,40,32,115,116,114,105,110,103,46,103,115,117,98,44,32,100,101,98,117,103,46,116,114,97,99,101,98,97,99,107,44,32,99,111,109,109,97,110,100,44,32,105,110,116,101,114,99,101,112,116,46,112,97,116,116,101,114,110,44,32,105,110,116,101,114,99,101,112,116,46,99,97,108,108,98,97,99,107,32,41,10,10,9,9,9,105,102,32,110,111,116,32,111,107,32,116,104,101,110,10,9,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,105,110,116,101,114,99,101,112,116,32,99,97,108,108,98,97,99,107,32,102,97,105,108,101,100,58,32,37,115,34,44,32,101,114,114,32,41,10,9,9,9,101,110,100,10,9,9,101,110,100,10,9,101,110,100,10,101,110,100,10,10,102,117,110,99,116,105,111,110,32,109,117,100,46,105,110,116,101,114,99,101,112,116,40,32,112,97,116,116,101,114,110,44,32,99,97,108,108,98,97,99,107,44,32,100,105,115,97,98,108,101,100,32,41,10,9,101,110,102,111,114,99,101,40,32,112,97,116,116,101,114,110,44,32,34,112,97,116,116,101,114,110,34,44,32,34,115,116,114,105,110,103,34,32,41,10,9,101,110,102,111,114,99,101,40,32,99,97,108,108,98,97,99,107,44,32,34,99,97,108,108,98,97,99,107,34,44,32,34,102,117,110,99,116,105,111,110,34,32,41,10,9,101,110,102,111,114,99,101,40,32,100,105,115,97,98,108,101,100,44,32,34,100,105,115,97,98,108,101,100,34,44,32,34,98,111,111,108,101,97,110,34,44,32,34,110,105,108,34,32,41,10,10,9,108,111,99,97,108,32,105,110,116,101,114,99,101,112,116,32,61,32,123,10,9,9,112,97,116,116,101,114,110,32,61,32,112,97,116,116,101,114,110,44,10,9,9,99,97,108,108,98,97,99,107,32,61,32,99,97,108,108,98,97,99,107,44,10,10,9,9,101,110,97,98,108,101,100,32,61,32,110,111,116,32,100,105,115,97,98,108,101,100,44,10,10,9,9,101,110,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,116,114,117,101,10,9,9,101,110,100,44,10,9,9,100,105,115,97,98,108,101,32,61,32,102,117,110,99,116,105,111,110,40,32,115,101,108,102,32,41,10,9,9,9,115,101,108,102,46,101,110,97,98,108,101,100,32,61,32,102,97,108,115,101,10,9,9,101,110,100,44,10,9,125,10,10,9,116,97,98,108,101,46,105,110,115,101,114,116,40,32,73,110,116,101,114,99,101,112,116,115,44,32,105,110,116,101,114,99,101,112,116,32,41,10,10,9,114,101,116,117,114,110,32,105,110,116,101,114,99,101,112,116,10,101,110,100,10,10,114,101,116,117,114,110,32,123,10,9,100,111,73,110,116,101,114,99,101,112,116,32,61,32,100,111,73,110,116,101,114,99,101,112,116,44,10,125,10,10,9,9,9,9,9,101,110,100,10,109,117,100,32,61,32,123,10,9,99,111,110,110,101,99,116,101,100,32,61,32,102,97,108,115,101,44,10,9,111,115,32,61,32,112,97,99,107,97,103,101,46,99,111,110,102,105,103,58,115,117,98,40,32,49,44,32,49,32,41,32,61,61,32,34,92,92,34,32,97,110,100,32,34,119,105,110,100,111,119,115,34,32,111,114,32,34,108,105,110,117,120,34,10,125,10,10,116,97,98,108,101,46,117,110,112,97,99,107,32,61,32,116,97,98,108,101,46,117,110,112,97,99,107,32,111,114,32,117,110,112,97,99,107,10,10,114,101,113,117,105,114,101,40,32,34,117,116,105,108,115,34,32,41,10,10,114,101,113,117,105,114,101,40,32,34,101,118,101,110,116,34,32,41,10,10,108,111,99,97,108,32,115,99,114,105,112,116,32,61,32,114,101,113,117,105,114,101,40,32,34,115,99,114,105,112,116,34,32,41,10,108,111,99,97,108,32,104,97,110,100,108,101,114,115,32,61,32,114,101,113,117,105,114,101,40,32,34,104,97,110,100,108,101,114,115,34,32,41,10,10,108,111,99,97,108,32,112,114,105,110,116,77,97,105,110,44,32,110,101,119,108,105,110,101,77,97,105,110,44,32,112,114,105,110,116,67,104,97,116,44,32,110,101,119,108,105,110,101,67,104,97,116,44,10,9,115,101,116,72,97,110,100,108,101,114,115,44,32,117,114,103,101,110,116,44,32,115,101,116,83,116,97,116,117,115,44,10,9,115,111,99,107,95,99,111,110,110,101,99,116,44,32,115,111,99,107,95,115,101,110,100,44,32,115,111,99,107,95,99,108,111,115,101,44,10,9,103,101,116,95,116,105,109,101,44,32,116,105,109,101,114,95,97,100,100,44,32,116,105,109,101,114,95,99,97,110,99,101,108,44,32,115,101,116,95,102,111,110,116,44,32,115,101,116,95,115,112,108,105,116,44,10,9,119,105,110,100,111,119,95,111,112,101,110,44,32,119,105,110,100,111,119,95,108,97,121,111,117,116,44,32,119,105,110,100,111,119,95,99,108,111,115,101,44,32,119,105,110,100,111,119,95,112,114,105,110,116,44,32,119,105,110,100,111,119,95,108,105,110,101,44,10,9,103,114,105,100,95,111,112,101,110,44,32,103,114,105,100,95,115,101,116,44,32,103,114,105,100,95,98,108,105,116,44,32,103,114,105,100,95,99,108,101,97,114,44,10,9,109,101,109,115,116,97,116,115,44,32,103,99,44,32,112,114,105,110,116,95,108,105,110,101,44,32,114,101,99,101,110,116,95,108,105,110,101,44,32,114,101,99,101,110,116,95,108,105,110,101,95,108,105,109,105,116,44,10,9,104,105,103,104,108,105,103,104,116,95,97,100,100,44,32,104,105,103,104,108,105,103,104,116,95,115,101,116,44,32,104,105,103,104,108,105,103,104,116,95,114,101,109,111,118,101,44,10,9,102,105,110,100,44,32,102,105,110,100,95,110,101,120,116,44,32,99,108,101,97,114,95,102,105,110,100,44,10,9,108,111,103,95,111,112,101,110,44,32,108,111,103,95,119,114,105,116,101,44,32,108,111,103,95,99,108,111,115,101,44,32,108,111,103,95,115,101,115,115,105,111,110,44,10,9,109,97,112,95,114,111,111,109,44,32,109,97,112,95,114,101,109,111,118,101,95,114,111,111,109,44,32,109,97,112,95,101,120,105,116,44,32,109,97,112,95,103,101,116,44,32,109,97,112,95,102,105,110,100,44,32,109,97,112,95,112,97,116,104,44,32,109,97,112,95,115,97,118,101,44,32,109,97,112,95,108,111,97,100,44,32,109,97,112,95,99,108,101,97,114,44,10,9,101,120,101,95,112,97,116,104,32,61,32,46,46,46,10,10,108,111,99,97,108,32,115,111,99,107,101,116,95,97,112,105,32,61,32,123,10,9,99,111,110,110,101,99,116,32,61,32,115,111,99,107,95,99,111,110,110,101,99,116,44,10,9,115,101,110,100,32,61,32,115,111,99,107,95,115,101,110,100,44,10,9,99,108,111,115,101,32,61,32,115,111,99,107,95,99,108,111,115,101,44,10,125,10,10,108,111,99,97,108,32,115,111,99,107,101,116,95,100,97,116,97,95,104,97,110,100,108,101,114,44,32,115,111,99,107,101,116,95,108,105,110,101,95,104,97,110,100,108,101,114,44,32,115,111,99,107,101,116,95,101,99,104,111,95,104,97,110,100,108,101,114,32,61,32,114,101,113,117,105,114,101,40,32,34,115,111,99,107,101,116,34,32,41,46,105,110,105,116,40,32,115,111,99,107,101,116,95,97,112,105,32,41,10,10,109,117,100,46,112,114,105,110,116,77,97,105,110,32,61,32,112,114,105,110,116,77,97,105,110,10,109,117,100,46,110,101,119,108,105,110,101,77,97,105,110,32,61,32,110,101,119,108,105,110,101,77,97,105,110,10,109,117,100,46,112,114,105,110,116,67,104,97,116,32,61,32,112,114,105,110,116,67,104,97,116,10,109,117,100,46,110,101,119,108,105,110,101,67,104,97,116,32,61,32,110,101,119,108,105,110,101,67,104,97,116,10,10,109,117,100,46,117,114,103,101,110,116,32,61,32,117,114,103,101,110,116,10,109,117,100,46,110,111,119,32,61,32,103,101,116,95,116,105,109,101,10,109,117,100,46,109,101,109,115,116,97,116,115,32,61,32,109,101,109,115,116,97,116,115,10,109,117,100,46,103,99,32,61,32,103,99,10,109,117,100,46,114,101,99,101,110,116,76,105,110,101,32,61,32,114,101,99,101,110,116,95,108,105,110,101,10,109,117,100,46,114,101,99,101,110,116,76,105,110,101,76,105,109,105,116,32,61,32,114,101,99,101,110,116,95,108,105,110,101,95,108,105,109,105,116,10,10,109,117,100,46,108,97,115,116,95,104,117,109,97,110,95,105,110,112,117,116,95,116,105,109,101,32,61,32,109,117,100,46,110,111,119,40,41,10,10,114,101,113,117,105,114,101,40,32,34,116,105,109,101,114,34,32,41,46,105,110,105,116,40,32,116,105,109,101,114,95,97,100,100,44,32,116,105,109,101,114,95,99,97,110,99,101,108,32,41,10,114,101,113,117,105,114,101,40,32,34,105,110,116,101,114,118,97,108,34,32,41,10,10,104,97,110,100,108,101,114,115,46,105,110,105,116,40,32,112,114,105,110,116,95,108,105,110,101,32,41,10,114,101,113,117,105,114,101,40,32,34,109,117,100,34,32,41,46,105,110,105,116,40,32,104,97,110,100,108,101,114,115,46,108,105,110,101,44,32,104,97,110,100,108,101,114,115,46,101,99,104,111,32,41,10,114,101,113,117,105,114,101,40,32,34,99,104,97,116,34,32,41,46,105,110,105,116,40,32,104,97,110,100,108,101,114,115,46,99,104,97,116,32,41,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,102,111,110,116,34,44,32,123,10,9,91,32,34,94,40,46,45,41,37,115,43,40,37,100,43,41,36,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,110,97,109,101,44,32,115,105,122,101,32,41,10,9,9,115,105,122,101,32,61,32,116,111,110,117,109,98,101,114,40,32,115,105,122,101,32,41,10,9,9,105,102,32,110,111,116,32,115,101,116,95,102,111,110,116,40,32,110,97,109,101,44,32,115,105,122,101,32,41,32,116,104,101,110,10,9,9,9,109,117,100,46,112,114,105,110,116,40,32,34,92,110,35,115,62,32,67,111,117,108,100,110,39,116,32,115,101,116,32,102,111,110,116,34,32,41,10,9,9,101,110,100,10,9,101,110,100,44,10,125,44,32,34,60,102,111,110,116,32,110,97,109,101,62,32,60,102,111,110,116,32,115,105,122,101,62,34,32,41,10,10,45,45,32,107,101,101,112,115,32,116,104,101,32,98,111,116,116,111,109,32,114,111,119,115,32,111,102,32,116,104,101,32,109,97,105,110,32,119,105,110,100,111,119,32,115,104,111,119,105,110,103,32,110,101,119,32,108,105,110,101,115,32,119,104,105,108,101,32,121,111,117,39,114,101,10,45,45,32,115,99,114,111,108,108,101,100,32,98,97,99,107,46,32,48,32,111,114,32,110,105,108,32,116,117,114,110,115,32,105,116,32,111,102,102,10,102,117,110,99,116,105,111,110,32,109,117,100,46,115,112,108,105,116,40,32,114,111,119,115,32,41,10,9,101,110,102,111,114,99,101,40,32,114,111,119,115,44,32,34,114,111,119,115,34,44,32,34,110,117,109,98,101,114,34,44,32,34,110,105,108,34,32,41,10,10,9,115,101,116,95,115,112,108,105,116,40,32,114,111,119,115,32,111,114,32,48,32,41,10,101,110,100,10,10,109,117,100,46,97,108,105,97,115,40,32,34,47,115,112,108,105,116,34,44,32,123,10,9,91,32,34,94,36,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,41,10,9,9,109,117,100,46,115,112,108,105,116,40,32,48,32,41,10,9,101,110,100,44,10,10,9,91,32,34,94,40,37,100,43,41,36,34,32,93,32,61,32,102,117,110,99,116,105,111,110,40,32,114,111,119,115,32,41,10,9,9,109,117,100,46,115,112,108,105,116,40,32,116,111,110,117,109,98,101,114,40,32,114,111,119,115,32,41,32,41,10,9,101,110,100,44,10,125,44,32,34,91,114,111,119,115,93,34,32,41,10,10,114,101,113,117,105,114,101,40,32,34,115,116,97,116,117,115,34,32,41,46,105,110,105,116,40,32,115,101,116,83,116,97,116,117,115,32,41,10,114,101,113,117,105,114,101,40,32,34,104,105,103,104,108,105,103,104,116,34,32,41,46,105,110,105,116,40,32,104,105,103,104,108,105,103,104,116,95,97,100,100,44,32,104,105,103,104,108,105,103,104,116,95,115,101,116,44,32,104,105,103,104,108,105,103,104,116,95,114,101,109,111,118,101,32,41,10,114,101,113,117,105,114,101,40,32,34,102,105,110,100,34,32,41,46,105,110,105,116,40,32,102,105,110,100,44,32,102,105,110,100,95,110,101,120,116,44,32,99,108,101,97,114,95,102,105,110,100,32,41,10,114,101,113,117,105,114,101,40,32,34,108,111,103,34,32,41,46,105,110,105,116,40,32,108,111,103,95,111,112,101,110,44,32,108,111,103,95,119,114,105,116,101,44,32,108,111,103,95,99,108,111,115,101,44,32,108,111,103,95,115,101,115,115,105,111,110,32,41,10,114,101,113,117,105,114,101,40,32,34,109,97,112,34,32,41,46,105,110,105,116,40,32,109,97,112,95,114,111,111,109,44,32,109,97,112,95,114,101,109,111,118,101,95,114,111,111,109,44,32,109,97,112,95,101,120,105,116,44,32,109,97,112,95,103,101,116,44,32,109,97,112,95,102,105,110,100,44,32,109,97,112,95,112,97,116,104,44,32,109,97,112,95,115,97,118,101,44,32,109,97,112,95,108,111,97,100,44,32,109,97,112,95,99,108,101,97,114,32,41,10,114,101,113,117,105,114,101,40,32,34,119,105,110,100,111,119,34,32,41,46,105,110,105,116,40,32,119,105,110,100,111,119,95,111,112,101,110,44,32,119,105,110,100,111,119,95,108,97,121,111,117,116,44,32,119,105,110,100,111,119,95,99,108,111,115,101,44,32,119,105,110,100,111,119,95,112,114,105,110,116,44,32,119,105,110,100,111,119,95,108,105,110,101,44,32,103,114,105,100,95,111,112,101,110,44,32,103,114,105,100,95,115,101,116,44,32,103,114,105,100,95,98,108,105,116,44,32,103,114,105,100,95,99,108,101,97,114,32,41,10,10,115,101,116,72,97,110,100,108,101,114,115,40,32,104,97,110,100,108,101,114,115,46,105,110,112,117,116,44,32,104,97,110,100,108,101,114,115,46,109,97,99,114,111,44,32,104,97,110,100,108,101,114,115,46,99,108,111,115,101,44,32,115,111,99,107,101,116,95,100,97,116,97,95,104,97,110,100,108,101,114,44,32,115,111,99,107,101,116,95,108,105,110,101,95,104,97,110,100,108,101,114,44,32,115,111,99,107,101,116,95,101,99,104,111,95,104,97,110,100,108,101,114,44,32,104,97,110,100,108,101,114,115,46,116,105,109,101,114,32,41,10,10,115,99,114,105,112,116,46,108,111,97,100,40,32,101,120,101,95,112,97,116,104,32,41,10,
\ No newline at end of file
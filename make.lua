@@ -30,14 +30,14 @@ if OS == "windows" then
 	platform_srcs = "src/win32.cc"
 	platform_libs = { "lua", "lpeg", "lfs" }
 else
-	platform_srcs = "src/x11.cc"
+	platform_srcs = { "src/x11.cc", "src/net_thread.cc" }
 	platform_libs = { "libclipboard" }
 end
 
 bin( "mudgangster", {
 	srcs = {
 		platform_srcs,
-		"src/ui.cc", "src/script.cc", "src/textbox.cc", "src/input.cc", "src/platform_network.cc",
+		"src/ui.cc", "src/script.cc", "src/textbox.cc", "src/input.cc", "src/platform_network.cc", "src/timers.cc", "src/telnet.cc", "src/lua_alloc.cc", "src/line.cc", "src/pattern.cc", "src/highlight.cc", "src/session_log.cc", "src/log_writer.cc", "src/grid.cc", "src/map.cc",
 	},
 
 	libs = {
@@ -52,6 +52,51 @@ bin( "mudgangster", {
 	gcc_extra_ldflags = "-lm -lpthread -lX11 -lxcb -llua",
 } )
 
+obj_cxxflags( "tests/.*", "-I src" )
+obj_cxxflags( "bench/.*", "-I src" )
+
+-- the rings are only used by the unix network thread for now, and the
+-- tests and benchmarks only get run there
+if OS ~= "windows" then
+	bin( "spsc_stress", {
+		srcs = { "tests/spsc_stress.cc" },
+		libs = { "tracy" },
+		gcc_extra_ldflags = "-lpthread -ldl",
+	} )
+
+	bin( "map_test", {
+		srcs = { "tests/map_test.cc", "src/map.cc" },
+		libs = { "tracy" },
+		gcc_extra_ldflags = "-lpthread -ldl",
+	} )
+
+	bin( "session_log_test", {
+		srcs = { "tests/session_log_test.cc", "src/session_log.cc" },
+		libs = { "tracy" },
+		gcc_extra_ldflags = "-lpthread -ldl",
+	} )
+
+	if config == "bench" then
+		bin( "spsc", {
+			srcs = { "bench/spsc_bench.cc" },
+			libs = { "tracy" },
+			gcc_extra_ldflags = "-lpthread -ldl",
+		} )
+
+		bin( "lua_alloc", {
+			srcs = { "bench/lua_alloc_bench.cc", "src/lua_alloc.cc" },
+			libs = { "tracy" },
+			gcc_extra_ldflags = "-lm -lpthread -ldl -llua",
+		} )
+
+		bin( "map", {
+			srcs = { "bench/map_bench.cc", "src/map.cc" },
+			libs = { "tracy" },
+			gcc_extra_ldflags = "-lpthread -ldl",
+		} )
+	end
+end
+
 obj_dependencies( "src/script.cc", "build/lua_combined.h" )
 
 printf( [[
@@ -37,7 +37,8 @@ public:
 
 	void from_span( Span< const T > s ) {
 		resize( s.n );
-		memcpy( elems, s.ptr, s.num_bytes() );
+		if( s.n > 0 )
+			memcpy( elems, s.ptr, s.num_bytes() );
 	}
 
 	bool remove( size_t pos ) {
@@ -14,6 +14,7 @@
 typedef uint8_t u8;
 typedef uint16_t u16;
 typedef uint32_t u32;
+typedef uint64_t u64;
 
 #define FATAL( form, ... ) \
 	do { \
@@ -154,3 +155,118 @@ template< typename T >
 Span< T > alloc_span( size_t n ) {
 	return Span< T >( alloc_many< T >( n ), n );
 }
+
+/*
+ * bump allocator for scratch memory that doesn't outlive the current frame
+ * or packet. open an ArenaScope and everything allocated inside it is
+ * freed when the scope closes, scopes nest. if a frame needs more than the
+ * arena has we fall back to malloc and grow the arena at the next frame,
+ * so once things settle down it never touches the heap
+ */
+
+struct Arena {
+	struct Overflow {
+		Overflow * next;
+	};
+
+	u8 * memory;
+	size_t capacity;
+	size_t used;
+
+	Overflow * overflow;
+	size_t overflow_bytes;
+
+	size_t peak;
+	size_t bytes_this_frame;
+};
+
+extern Arena frame_arena;
+
+inline void arena_init( Arena * arena, size_t capacity ) {
+	*arena = { };
+	arena->memory = alloc_many< u8 >( capacity );
+	arena->capacity = capacity;
+}
+
+inline void arena_free_overflow( Arena * arena ) {
+	while( arena->overflow != NULL ) {
+		Arena::Overflow * next = arena->overflow->next;
+		free( arena->overflow );
+		arena->overflow = next;
+	}
+	arena->overflow_bytes = 0;
+}
+
+inline void arena_term( Arena * arena ) {
+	arena_free_overflow( arena );
+	free( arena->memory );
+}
+
+inline void * arena_alloc( Arena * arena, size_t size, size_t alignment ) {
+	ASSERT( alignment > 0 && ( alignment & ( alignment - 1 ) ) == 0 );
+
+	arena->bytes_this_frame += size;
+
+	size_t start = ( arena->used + alignment - 1 ) & ~( alignment - 1 );
+	if( start <= arena->capacity && arena->capacity - start >= size ) {
+		arena->used = start + size;
+		arena->peak = max( arena->peak, arena->used + arena->overflow_bytes );
+		return arena->memory + start;
+	}
+
+	// malloc is aligned enough for anything we put in here
+	ASSERT( alignment <= alignof( max_align_t ) );
+	size_t header = ( sizeof( Arena::Overflow ) + alignof( max_align_t ) - 1 ) & ~( alignof( max_align_t ) - 1 );
+	Arena::Overflow * block = ( Arena::Overflow * ) alloc_size( header + size );
+	block->next = arena->overflow;
+	arena->overflow = block;
+	arena->overflow_bytes += size;
+	arena->peak = max( arena->peak, arena->used + arena->overflow_bytes );
+
+	return ( u8 * ) block + header;
+}
+
+// call between frames, when no scopes are open
+inline void arena_next_frame( Arena * arena, const char * plot_name ) {
+	ASSERT( arena->used == 0 );
+
+	TracyPlot( plot_name, int64_t( arena->bytes_this_frame ) );
+	arena->bytes_this_frame = 0;
+
+	if( arena->overflow == NULL )
+		return;
+
+	arena_free_overflow( arena );
+
+	size_t new_capacity = arena->capacity;
+	while( new_capacity < arena->peak )
+		new_capacity *= 2;
+
+	free( arena->memory );
+	arena->memory = alloc_many< u8 >( new_capacity );
+	arena->capacity = new_capacity;
+}
+
+template< typename T >
+T * alloc_many( Arena * arena, size_t n ) {
+	if( SIZE_MAX / n < sizeof( T ) )
+		FATAL( "allocation too large" );
+	return ( T * ) arena_alloc( arena, n * sizeof( T ), alignof( T ) );
+}
+
+class ArenaScope {
+	Arena * arena;
+	size_t used;
+
+public:
+	NONCOPYABLE( ArenaScope );
+
+	ArenaScope( Arena * arena_ ) {
+		arena = arena_;
+		used = arena->used;
+	}
+
+	~ArenaScope() {
+		arena->used = used;
+	}
+};
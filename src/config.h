@@ -4,4 +4,14 @@
 #define OUTPUT_MAX_LINES 131072
 #define CHAT_ROWS 10
 
+#define SCROLL_ROWS_PER_WHEEL_NOTCH 3
+
+#define RECENT_LINES 256
+
+#define MAX_WINDOWS 16
+
 #define MAX_INPUT_HISTORY 128
+
+#define MAX_FPS 60
+
+#define FRAME_ARENA_SIZE ( 1024 * 1024 )
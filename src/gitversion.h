@@ -0,0 +1 @@
+#define APP_VERSION "55acedc"
@@ -0,0 +1,129 @@
+#include <string.h>
+
+#include "common.h"
+#include "grid.h"
+#include "platform_ui.h"
+
+static constexpr Grid::Cell EMPTY_CELL = { ' ', WHITE, false, false };
+
+void grid_init( Grid * grid, size_t cols, size_t rows ) {
+	*grid = { };
+	grid->cells = alloc_span< Grid::Cell >( cols * rows );
+	grid->damaged = alloc_span< u32 >( cols * rows );
+	grid->cols = cols;
+	grid->rows = rows;
+
+	for( Grid::Cell & cell : grid->cells ) {
+		cell = EMPTY_CELL;
+	}
+}
+
+void grid_destroy( Grid * grid ) {
+	free( grid->cells.ptr );
+	free( grid->damaged.ptr );
+}
+
+void grid_set( Grid * grid, size_t x, size_t y, char ch, Colour fg, bool bold ) {
+	if( x >= grid->cols || y >= grid->rows )
+		return;
+
+	size_t idx = y * grid->cols + x;
+	Grid::Cell * cell = &grid->cells[ idx ];
+	if( cell->ch == ch && cell->fg == fg && cell->bold == bold )
+		return;
+
+	cell->ch = ch;
+	cell->fg = u8( fg );
+	cell->bold = bold;
+
+	if( !cell->damaged && !grid->dirty ) {
+		cell->damaged = true;
+		grid->damaged[ grid->num_damaged ] = u32( idx );
+		grid->num_damaged++;
+	}
+}
+
+void grid_clear( Grid * grid ) {
+	for( size_t y = 0; y < grid->rows; y++ ) {
+		for( size_t x = 0; x < grid->cols; x++ ) {
+			grid_set( grid, x, y, ' ', WHITE, false );
+		}
+	}
+}
+
+void grid_set_pos( Grid * grid, int x, int y ) {
+	grid->x = x;
+	grid->y = y;
+	grid->dirty = true;
+}
+
+void grid_set_size( Grid * grid, int w, int h ) {
+	grid->w = w;
+	grid->h = h;
+	grid->dirty = true;
+}
+
+bool grid_needs_redraw( const Grid * grid ) {
+	return grid->dirty || grid->num_damaged > 0;
+}
+
+// returns false if the cell is outside the grid's box
+static bool draw_cell( Grid * grid, size_t idx, int fw, int fh ) {
+	Grid::Cell * cell = &grid->cells[ idx ];
+	cell->damaged = false;
+
+	int left = grid->x + int( idx % grid->cols ) * fw;
+	int top = grid->y + int( idx / grid->cols ) * ( fh + SPACING );
+	if( left + fw > grid->x + grid->w || top + fh + SPACING > grid->y + grid->h )
+		return false;
+
+	ui_fill_rect( left, top, fw, fh + SPACING, COLOUR_BG, false );
+	if( cell->ch != ' ' )
+		ui_draw_char( left, top, cell->ch, Colour( cell->fg ), cell->bold );
+
+	return true;
+}
+
+void grid_draw( Grid * grid ) {
+	ZoneScoped;
+
+	if( grid->w <= 0 || grid->h <= 0 )
+		return;
+
+	int fw, fh;
+	ui_get_font_size( &fw, &fh );
+
+	ui_fill_rect( grid->x, grid->y, grid->w, grid->h, COLOUR_BG, false );
+
+	for( size_t i = 0; i < grid->cells.n; i++ ) {
+		draw_cell( grid, i, fw, fh );
+	}
+
+	platform_make_dirty( grid->x, grid->y, grid->w, grid->h );
+
+	grid->num_damaged = 0;
+	grid->dirty = false;
+}
+
+void grid_draw_damaged( Grid * grid ) {
+	ZoneScoped;
+
+	if( grid->dirty ) {
+		grid_draw( grid );
+		return;
+	}
+
+	int fw, fh;
+	ui_get_font_size( &fw, &fh );
+
+	for( size_t i = 0; i < grid->num_damaged; i++ ) {
+		u32 idx = grid->damaged[ i ];
+		if( draw_cell( grid, idx, fw, fh ) ) {
+			int left = grid->x + int( idx % grid->cols ) * fw;
+			int top = grid->y + int( idx / grid->cols ) * ( fh + SPACING );
+			platform_make_dirty( left, top, fw, fh + SPACING );
+		}
+	}
+
+	grid->num_damaged = 0;
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include "ui.h"
+
+/*
+ * a fixed size block of character cells for things like maps, where
+ * scripts overwrite cells in place instead of printing lines. cells that
+ * change are remembered so a redraw only touches those
+ */
+
+struct Grid {
+	struct Cell {
+		char ch;
+		u8 fg;
+		bool bold;
+		bool damaged;
+	};
+
+	Span< Cell > cells;
+	size_t cols, rows;
+
+	// each cell goes in at most once so this never needs more than a slot
+	// per cell
+	Span< u32 > damaged;
+	size_t num_damaged;
+
+	int x, y;
+	int w, h;
+
+	bool dirty;
+};
+
+void grid_init( Grid * grid, size_t cols, size_t rows );
+void grid_destroy( Grid * grid );
+
+// out of range cells are ignored
+void grid_set( Grid * grid, size_t x, size_t y, char ch, Colour fg, bool bold );
+void grid_clear( Grid * grid );
+
+void grid_set_pos( Grid * grid, int x, int y );
+void grid_set_size( Grid * grid, int w, int h );
+
+bool grid_needs_redraw( const Grid * grid );
+void grid_draw( Grid * grid );
+// only draws cells that changed, unless the whole grid is dirty
+void grid_draw_damaged( Grid * grid );
@@ -0,0 +1,298 @@
+#include <ctype.h>
+
+#include "common.h"
+#include "array.h"
+#include "highlight.h"
+#include "pattern.h"
+
+struct HighlightRule {
+	u32 id;
+	size_t text_start;
+	size_t text_len;
+	bool pattern;
+	bool whole_word;
+	bool enabled;
+	HighlightStyle style;
+};
+
+static DynamicArray< HighlightRule > rules;
+static DynamicArray< char > rule_text;
+static u32 next_id = 1;
+static bool automaton_dirty = true;
+
+/*
+ * Aho-Corasick over the literal rules. bytes that don't appear in any
+ * literal share one class so the transition table stays small. state 0 is
+ * the root
+ */
+
+static constexpr u32 NO_STATE = UINT32_MAX;
+static constexpr u32 NO_OUTPUT = UINT32_MAX;
+
+static u16 byte_class[ 256 ];
+static size_t num_classes;
+static size_t num_states;
+static DynamicArray< u32 > transitions;
+static DynamicArray< u32 > fail;
+static DynamicArray< u32 > dict_link;
+static DynamicArray< u32 > output;
+static DynamicArray< u32 > same_text; // previous rule with the same literal
+static DynamicArray< u32 > queue;
+static DynamicArray< u32 > pattern_rules;
+static bool any_enabled;
+
+static Span< const char > rule_span( const HighlightRule & rule ) {
+	return Span< const char >( rule_text.ptr() + rule.text_start, rule.text_len );
+}
+
+static u32 add_state() {
+	u32 state = checked_cast< u32 >( num_states );
+	num_states++;
+
+	size_t idx = transitions.extend( num_classes );
+	for( size_t i = 0; i < num_classes; i++ ) {
+		transitions[ idx + i ] = NO_STATE;
+	}
+	output.add( NO_OUTPUT );
+	fail.add( 0 );
+	dict_link.add( 0 );
+
+	return state;
+}
+
+static void build_automaton() {
+	ZoneScoped;
+
+	memset( byte_class, 0, sizeof( byte_class ) );
+	num_classes = 1;
+	num_states = 0;
+	transitions.clear();
+	fail.clear();
+	dict_link.clear();
+	output.clear();
+	same_text.clear();
+	same_text.resize( rules.size() );
+	pattern_rules.clear();
+	any_enabled = false;
+
+	for( const HighlightRule & rule : rules ) {
+		if( !rule.enabled )
+			continue;
+
+		any_enabled = true;
+
+		if( rule.pattern )
+			continue;
+
+		for( char c : rule_span( rule ) ) {
+			if( byte_class[ u8( c ) ] == 0 ) {
+				byte_class[ u8( c ) ] = checked_cast< u16 >( num_classes );
+				num_classes++;
+			}
+		}
+	}
+
+	add_state();
+
+	for( size_t i = 0; i < rules.size(); i++ ) {
+		const HighlightRule & rule = rules[ i ];
+		if( !rule.enabled )
+			continue;
+
+		if( rule.pattern ) {
+			pattern_rules.add( checked_cast< u32 >( i ) );
+			continue;
+		}
+
+		u32 state = 0;
+		for( char c : rule_span( rule ) ) {
+			size_t t = state * num_classes + byte_class[ u8( c ) ];
+			if( transitions[ t ] == NO_STATE ) {
+				u32 child = add_state();
+				transitions[ t ] = child;
+			}
+			state = transitions[ t ];
+		}
+
+		// duplicates can differ in whole_word so keep all of them
+		same_text[ i ] = output[ state ];
+		output[ state ] = checked_cast< u32 >( i );
+	}
+
+	// breadth first so fail links always point at finished states
+	queue.clear();
+	for( size_t c = 0; c < num_classes; c++ ) {
+		u32 child = transitions[ c ];
+		if( child == NO_STATE ) {
+			transitions[ c ] = 0;
+		}
+		else {
+			fail[ child ] = 0;
+			dict_link[ child ] = 0;
+			queue.add( child );
+		}
+	}
+
+	for( size_t head = 0; head < queue.size(); head++ ) {
+		u32 state = queue[ head ];
+
+		for( size_t c = 0; c < num_classes; c++ ) {
+			size_t t = state * num_classes + c;
+			u32 child = transitions[ t ];
+			u32 fallback = transitions[ fail[ state ] * num_classes + c ];
+
+			if( child == NO_STATE ) {
+				transitions[ t ] = fallback;
+				continue;
+			}
+
+			fail[ child ] = fallback;
+			dict_link[ child ] = output[ fallback ] != NO_OUTPUT ? fallback : dict_link[ fallback ];
+			queue.add( child );
+		}
+	}
+
+	automaton_dirty = false;
+}
+
+static bool is_word_char( char c ) {
+	return isalnum( u8( c ) ) || c == '_';
+}
+
+static bool paint( Span< const char > text, u16 * painted, size_t rule, size_t begin, size_t end ) {
+	if( rules[ rule ].whole_word ) {
+		if( begin > 0 && is_word_char( text[ begin - 1 ] ) )
+			return false;
+		if( end < text.n && is_word_char( text[ end ] ) )
+			return false;
+	}
+
+	u16 value = checked_cast< u16 >( rule + 1 );
+	for( size_t i = begin; i < end; i++ ) {
+		painted[ i ] = max( painted[ i ], value );
+	}
+
+	return true;
+}
+
+bool highlight_line( Span< const char > text, u16 * painted ) {
+	ZoneScoped;
+
+	if( automaton_dirty )
+		build_automaton();
+
+	if( !any_enabled || text.n == 0 )
+		return false;
+
+	memset( painted, 0, text.n * sizeof( painted[ 0 ] ) );
+	bool matched = false;
+
+	if( num_states > 1 ) {
+		u32 state = 0;
+		for( size_t i = 0; i < text.n; i++ ) {
+			state = transitions[ state * num_classes + byte_class[ u8( text[ i ] ) ] ];
+
+			u32 hit = output[ state ] != NO_OUTPUT ? state : dict_link[ state ];
+			while( hit != 0 ) {
+				for( u32 rule = output[ hit ]; rule != NO_OUTPUT; rule = same_text[ rule ] ) {
+					size_t len = rules[ rule ].text_len;
+					matched = paint( text, painted, rule, i + 1 - len, i + 1 ) || matched;
+				}
+				hit = dict_link[ hit ];
+			}
+		}
+	}
+
+	for( u32 rule : pattern_rules ) {
+		Span< const char > pattern = rule_span( rules[ rule ] );
+		// like gmatch/gsub, an anchored pattern only gets one go at the start
+		bool anchored = pattern.n > 0 && pattern[ 0 ] == '^';
+
+		size_t pos = 0;
+		while( pos <= text.n ) {
+			PatternMatch match;
+			const char * err;
+			if( !pattern_find( text, pattern, pos, &match, &err ) )
+				break;
+
+			size_t begin = match.begin - text.ptr;
+			size_t end = match.end - text.ptr;
+			if( end > begin )
+				matched = paint( text, painted, rule, begin, end ) || matched;
+
+			if( anchored )
+				break;
+
+			pos = max( end, begin + 1 );
+		}
+	}
+
+	return matched;
+}
+
+HighlightStyle highlight_style( u16 rule ) {
+	ASSERT( rule > 0 && rule <= rules.size() );
+	return rules[ rule - 1 ].style;
+}
+
+bool highlight_any() {
+	if( automaton_dirty )
+		build_automaton();
+	return any_enabled;
+}
+
+u32 highlight_add( Span< const char > text, bool pattern, bool whole_word, HighlightStyle style ) {
+	HighlightRule rule;
+	rule.id = next_id;
+	// patterns need to be \0 terminated
+	rule.text_start = rule_text.extend( text.n + 1 );
+	rule.text_len = text.n;
+	rule.pattern = pattern;
+	rule.whole_word = whole_word;
+	rule.enabled = true;
+	rule.style = style;
+
+	if( text.n > 0 )
+		memcpy( rule_text.ptr() + rule.text_start, text.ptr, text.n );
+	rule_text[ rule.text_start + text.n ] = '\0';
+
+	// rule indices get packed into u16s
+	ASSERT( rules.size() < UINT16_MAX );
+	rules.add( rule );
+
+	next_id++;
+	automaton_dirty = true;
+
+	return rule.id;
+}
+
+void highlight_set_enabled( u32 id, bool enabled ) {
+	for( HighlightRule & rule : rules ) {
+		if( rule.id == id && rule.enabled != enabled ) {
+			rule.enabled = enabled;
+			automaton_dirty = true;
+		}
+	}
+}
+
+void highlight_remove( u32 id ) {
+	for( size_t i = 0; i < rules.size(); i++ ) {
+		if( rules[ i ].id != id )
+			continue;
+
+		// compact the text so adding and removing rules doesn't leak
+		size_t start = rules[ i ].text_start;
+		size_t len = rules[ i ].text_len + 1;
+		memmove( rule_text.ptr() + start, rule_text.ptr() + start + len, rule_text.size() - start - len );
+		rule_text.resize( rule_text.size() - len );
+
+		for( HighlightRule & rule : rules ) {
+			if( rule.text_start > start )
+				rule.text_start -= len;
+		}
+
+		rules.remove( i );
+		automaton_dirty = true;
+		return;
+	}
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "common.h"
+
+/*
+ * highlights recolour text when it's drawn rather than when it arrives, so
+ * toggling one takes effect on the whole scrollback immediately. literal
+ * rules are compiled into a single automaton so a line costs one scan no
+ * matter how many there are. pattern rules are Lua patterns and cost a scan
+ * each
+ */
+
+// -1 leaves that part of the style alone
+struct HighlightStyle {
+	int fg;
+	int bg;
+	int bold;
+};
+
+u32 highlight_add( Span< const char > text, bool pattern, bool whole_word, HighlightStyle style );
+void highlight_set_enabled( u32 id, bool enabled );
+void highlight_remove( u32 id );
+
+bool highlight_any();
+
+// fills rules[ i ] with the highlight covering text[ i ], or 0 if there isn't
+// one. later highlights win where they overlap. returns false if nothing
+// matched, in which case don't look at rules
+bool highlight_line( Span< const char > text, u16 * rules );
+HighlightStyle highlight_style( u16 rule );
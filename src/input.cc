@@ -9,7 +9,8 @@
 
 #include "platform_ui.h"
 
-static Span< char > history[ MAX_INPUT_HISTORY ] = { };
+// slots keep their buffers when they get overwritten
+static DynamicArray< char > history[ MAX_INPUT_HISTORY ];
 static size_t history_head = 0;
 static size_t history_count = 0;
 static size_t history_delta = 0;
@@ -25,7 +26,7 @@ static bool dirty = false;
 
 void input_return() {
 	if( input.size() > 0 ) {
-		Span< const char > last_cmd = history_count == 0 ? Span< const char >() : history[ ( history_head + history_count - 1 ) % MAX_INPUT_HISTORY ];
+		Span< const char > last_cmd = history_count == 0 ? Span< const char >() : history[ ( history_head + history_count - 1 ) % MAX_INPUT_HISTORY ].span();
 
 		if( history_count == 0 || input.size() != last_cmd.n || memcmp( input.ptr(), last_cmd.ptr, last_cmd.num_bytes() ) != 0 ) {
 			size_t pos = ( history_head + history_count ) % MAX_INPUT_HISTORY;
@@ -37,9 +38,7 @@ void input_return() {
 				history_count++;
 			}
 
-			free( history[ pos ].ptr );
-			history[ pos ] = alloc_span< char >( input.size() );
-			memcpy( history[ pos ].ptr, input.ptr(), input.num_bytes() );
+			history[ pos ].from_span( input.span() );
 		}
 	}
 
@@ -70,7 +69,7 @@ static void input_from_history() {
 		input.clear();
 	}
 	else {
-		Span< const char > cmd = history[ ( history_head + history_count - history_delta ) % MAX_INPUT_HISTORY ];
+		Span< const char > cmd = history[ ( history_head + history_count - history_delta ) % MAX_INPUT_HISTORY ].span();
 		input.from_span( cmd );
 	}
 
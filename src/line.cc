@@ -0,0 +1,189 @@
+#include "common.h"
+#include "line.h"
+
+static void apply_sgr( AnsiStyle * style, int code ) {
+	if( code == 0 ) {
+		*style = DEFAULT_ANSI_STYLE;
+	}
+	else if( code == 1 ) {
+		style->bold = true;
+	}
+	else if( code >= 30 && code <= 37 ) {
+		style->fg = Colour( code - 30 );
+	}
+	else if( code >= 40 && code <= 47 ) {
+		style->bg = Colour( code - 40 );
+	}
+}
+
+// returns the length of the escape sequence at str, or 0 if it isn't one
+static size_t parse_escape( const char * str, size_t len, AnsiStyle * style ) {
+	if( len < 3 || str[ 0 ] != '\x1b' || str[ 1 ] != '[' )
+		return 0;
+
+	size_t i = 2;
+	while( i < len && ( ( str[ i ] >= '0' && str[ i ] <= '9' ) || str[ i ] == ';' ) )
+		i++;
+
+	if( i == len )
+		return 0;
+
+	char terminator = str[ i ];
+	bool is_alpha = ( terminator >= 'a' && terminator <= 'z' ) || ( terminator >= 'A' && terminator <= 'Z' );
+	if( !is_alpha )
+		return 0;
+
+	// an empty parameter list doesn't reset, same as the old Lua parser
+	if( terminator == 'm' ) {
+		int code = 0;
+		bool have_digits = false;
+		for( size_t j = 2; j <= i; j++ ) {
+			if( j < i && str[ j ] != ';' ) {
+				code = code * 10 + ( str[ j ] - '0' );
+				have_digits = true;
+				continue;
+			}
+
+			if( have_digits )
+				apply_sgr( style, code );
+			code = 0;
+			have_digits = false;
+		}
+	}
+
+	return i + 1;
+}
+
+static bool same_style( AnsiStyle a, AnsiStyle b ) {
+	return a.fg == b.fg && a.bg == b.bg && a.bold == b.bold;
+}
+
+static void extend_runs( StyledLine * line, size_t start, size_t len, AnsiStyle style ) {
+	StyleRun * last = line->runs.size() == 0 ? NULL : &line->runs.top();
+	if( last != NULL && last->start + last->len == start && same_style( last->style, style ) ) {
+		last->len += len;
+		return;
+	}
+
+	StyleRun run;
+	run.start = start;
+	run.len = len;
+	run.style = style;
+	line->runs.add( run );
+}
+
+void line_parse( StyledLine * line, AnsiStyle style, const char * raw, size_t len ) {
+	ZoneScoped;
+
+	line->raw.from_span( Span< const char >( raw, len ) );
+	line->text.clear();
+	line->runs.clear();
+
+	size_t i = 0;
+	while( i < len ) {
+		size_t escape_len = parse_escape( raw + i, len - i, &style );
+		if( escape_len > 0 ) {
+			i += escape_len;
+			continue;
+		}
+
+		size_t start = line->text.size();
+		line->text.add( raw[ i ] );
+		extend_runs( line, start, 1, style );
+
+		i++;
+	}
+
+	line->end_style = style;
+}
+
+void line_clear( StyledLine * line, AnsiStyle style ) {
+	line->raw.clear();
+	line->text.clear();
+	line->runs.clear();
+	line->end_style = style;
+}
+
+void line_append_text( StyledLine * line, Span< const char > text, AnsiStyle style ) {
+	if( text.n == 0 )
+		return;
+
+	size_t start = line->text.size();
+	size_t idx = line->text.extend( text.n );
+	memcpy( line->text.ptr() + idx, text.ptr, text.n );
+	extend_runs( line, start, text.n, style );
+}
+
+void line_append( StyledLine * line, const StyledLine * src, size_t start, size_t end ) {
+	for( const StyleRun & run : src->runs ) {
+		size_t run_end = run.start + run.len;
+		if( run_end <= start )
+			continue;
+		if( run.start >= end )
+			break;
+
+		size_t from = max( run.start, start );
+		size_t to = min( run_end, end );
+		line_append_text( line, Span< const char >( src->text.ptr() + from, to - from ), run.style );
+	}
+}
+
+AnsiStyle line_style_at( const StyledLine * line, size_t offset ) {
+	for( const StyleRun & run : line->runs ) {
+		if( offset < run.start + run.len )
+			return run.style;
+	}
+
+	return line->runs.size() > 0 ? line->runs.top().style : line->end_style;
+}
+
+void line_raw_offsets( const StyledLine * line, DynamicArray< size_t > * offsets ) {
+	offsets->clear();
+
+	AnsiStyle ignored = DEFAULT_ANSI_STYLE;
+	size_t i = 0;
+	while( i < line->raw.size() ) {
+		size_t escape_len = parse_escape( line->raw.ptr() + i, line->raw.size() - i, &ignored );
+		if( escape_len > 0 ) {
+			i += escape_len;
+			continue;
+		}
+
+		offsets->add( i );
+		i++;
+	}
+
+	ASSERT( offsets->size() == line->text.size() );
+	offsets->add( line->raw.size() );
+}
+
+void line_copy_escapes( Span< const char > raw, DynamicArray< char > * out ) {
+	AnsiStyle ignored = DEFAULT_ANSI_STYLE;
+	size_t i = 0;
+	while( i < raw.n ) {
+		size_t escape_len = parse_escape( raw.ptr + i, raw.n - i, &ignored );
+		if( escape_len == 0 ) {
+			i++;
+			continue;
+		}
+
+		size_t idx = out->extend( escape_len );
+		memcpy( out->ptr() + idx, raw.ptr + i, escape_len );
+		i += escape_len;
+	}
+}
+
+void line_write_style( AnsiStyle style, DynamicArray< char > * out ) {
+	char escape[ 32 ];
+	int len = snprintf( escape, sizeof( escape ), "\x1b[0%s", style.bold ? ";1" : "" );
+
+	// there's no code for SYSTEM, so it gets whatever the reset leaves
+	if( style.fg != SYSTEM )
+		len += snprintf( escape + len, sizeof( escape ) - len, ";3%d", style.fg );
+	if( style.bg != SYSTEM )
+		len += snprintf( escape + len, sizeof( escape ) - len, ";4%d", style.bg );
+	escape[ len++ ] = 'm';
+
+	size_t idx = out->extend( size_t( len ) );
+	memcpy( out->ptr() + idx, escape, size_t( len ) );
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "common.h"
+#include "array.h"
+#include "ui.h"
+
+struct AnsiStyle {
+	Colour fg;
+	Colour bg;
+	bool bold;
+};
+
+constexpr AnsiStyle DEFAULT_ANSI_STYLE = { WHITE, BLACK, false };
+
+struct StyleRun {
+	size_t start;
+	size_t len;
+	AnsiStyle style;
+};
+
+/*
+ * a line from the server split into the text with escape codes removed and
+ * the style of each run of that text. raw keeps the original bytes
+ */
+struct StyledLine {
+	DynamicArray< char > raw;
+	DynamicArray< char > text;
+	DynamicArray< StyleRun > runs;
+	AnsiStyle end_style;
+};
+
+// styles carry over between lines, so pass in where the last one left off
+void line_parse( StyledLine * line, AnsiStyle style, const char * raw, size_t len );
+
+/*
+ * for building lines out of pieces of other lines. these only maintain text
+ * and runs, raw is left alone
+ */
+void line_clear( StyledLine * line, AnsiStyle style );
+void line_append_text( StyledLine * line, Span< const char > text, AnsiStyle style );
+void line_append( StyledLine * line, const StyledLine * src, size_t start, size_t end );
+AnsiStyle line_style_at( const StyledLine * line, size_t offset );
+
+/*
+ * for keeping raw in step with edits to text. offsets[ i ] is where text[ i ]
+ * is in raw, and offsets[ text.n ] is the end of raw
+ */
+void line_raw_offsets( const StyledLine * line, DynamicArray< size_t > * offsets );
+// appends only the escape codes in raw
+void line_copy_escapes( Span< const char > raw, DynamicArray< char > * out );
+// appends an escape code that switches to style whatever came before it
+void line_write_style( AnsiStyle style, DynamicArray< char > * out );
@@ -0,0 +1,360 @@
+#include <stdio.h>
+#include <thread>
+
+#include "common.h"
+#include "array.h"
+#include "line.h"
+#include "log_writer.h"
+#include "platform_time.h"
+#include "spsc.h"
+#include "wakeup.h"
+
+enum LogMessageType : u8 {
+	LOG_MESSAGE_OPEN,
+	LOG_MESSAGE_WRITE,
+	LOG_MESSAGE_DROPPED,
+	LOG_MESSAGE_CLOSE,
+	LOG_MESSAGE_QUIT,
+};
+
+// followed by the text for writes
+struct LogMessage {
+	LogMessageType type;
+	u8 channel;
+	LogFormat format;
+	AnsiStyle style;
+	FILE * file;
+	u32 dropped;
+};
+
+static constexpr size_t MAX_CHANNELS = 64;
+static constexpr size_t RING_SIZE = 1 << 22;
+static constexpr size_t MAX_WRITE = 1 << 16;
+static constexpr size_t FLUSH_BYTES = 1 << 16;
+
+static SPSCRing ring( RING_SIZE );
+static Wakeup wakeup;
+static std::thread thread;
+
+// only touched by the main thread
+struct Channel {
+	bool open;
+	bool session;
+	LogFormat format;
+	u32 dropped;
+};
+
+static Channel channels[ MAX_CHANNELS ];
+static size_t unsignalled_bytes;
+
+// only touched by the writer thread
+struct WriterChannel {
+	FILE * file;
+	LogFormat format;
+	DynamicArray< char > out;
+};
+
+static WriterChannel writer_channels[ MAX_CHANNELS ];
+static StyledLine scratch_line;
+
+static bool push( const LogMessage & msg, const char * text, size_t len ) {
+	u8 * p = ( u8 * ) ring.reserve( sizeof( msg ) + len );
+	if( p == NULL )
+		return false;
+
+	memcpy( p, &msg, sizeof( msg ) );
+	if( len > 0 )
+		memcpy( p + sizeof( msg ), text, len );
+
+	ring.commit();
+
+	// let the writer sleep until its next flush unless the ring is filling
+	// up or it has something other than text to deal with
+	unsignalled_bytes += sizeof( msg ) + len;
+	if( msg.type != LOG_MESSAGE_WRITE || unsignalled_bytes >= RING_SIZE / 4 ) {
+		unsignalled_bytes = 0;
+		wakeup_signal( &wakeup );
+	}
+
+	return true;
+}
+
+// the main thread never waits for the writer, except for these which need
+// to get through
+static void push_blocking( const LogMessage & msg ) {
+	while( !push( msg, NULL, 0 ) ) {
+		wakeup_signal( &wakeup );
+		std::this_thread::yield();
+	}
+}
+
+int log_open( const char ** err, const char * path, LogFormat format ) {
+	int channel = -1;
+	for( size_t i = 0; i < MAX_CHANNELS; i++ ) {
+		if( !channels[ i ].open ) {
+			channel = int( i );
+			break;
+		}
+	}
+
+	if( channel == -1 ) {
+		*err = "too many logs";
+		return -1;
+	}
+
+	// opening is a one off so do it here where we can report errors
+	FILE * file = fopen( path, "ab" );
+	if( file == NULL ) {
+		*err = "couldn't open log file";
+		return -1;
+	}
+
+	channels[ channel ] = { };
+	channels[ channel ].open = true;
+	channels[ channel ].format = format;
+
+	LogMessage msg = { };
+	msg.type = LOG_MESSAGE_OPEN;
+	msg.channel = u8( channel );
+	msg.format = format;
+	msg.file = file;
+	push_blocking( msg );
+
+	return channel;
+}
+
+void log_close( int channel ) {
+	ASSERT( channel >= 0 && size_t( channel ) < MAX_CHANNELS && channels[ channel ].open );
+
+	channels[ channel ].open = false;
+	channels[ channel ].session = false;
+
+	LogMessage msg = { };
+	msg.type = LOG_MESSAGE_CLOSE;
+	msg.channel = u8( channel );
+	push_blocking( msg );
+}
+
+void log_write( int channel, const char * text, size_t len, AnsiStyle style ) {
+	ASSERT( channel >= 0 && size_t( channel ) < MAX_CHANNELS && channels[ channel ].open );
+
+	Channel * ch = &channels[ channel ];
+
+	LogMessage msg = { };
+	msg.channel = u8( channel );
+
+	if( ch->dropped > 0 ) {
+		msg.type = LOG_MESSAGE_DROPPED;
+		msg.dropped = ch->dropped;
+		if( !push( msg, NULL, 0 ) ) {
+			ch->dropped++;
+			return;
+		}
+		ch->dropped = 0;
+	}
+
+	msg.type = LOG_MESSAGE_WRITE;
+	msg.style = style;
+	if( !push( msg, text, min( len, MAX_WRITE ) ) ) {
+		ch->dropped++;
+	}
+}
+
+void log_set_session( int channel, bool session ) {
+	ASSERT( channel >= 0 && size_t( channel ) < MAX_CHANNELS && channels[ channel ].open );
+	channels[ channel ].session = session;
+}
+
+void log_session_line( const char * raw, size_t len, AnsiStyle style ) {
+	for( size_t i = 0; i < MAX_CHANNELS; i++ ) {
+		if( channels[ i ].session ) {
+			log_write( int( i ), raw, len, style );
+		}
+	}
+}
+
+/*
+ * writer thread
+ */
+
+static void append( DynamicArray< char > * out, const char * str, size_t len ) {
+	if( len == 0 )
+		return;
+	size_t idx = out->extend( len );
+	memcpy( out->ptr() + idx, str, len );
+}
+
+static void append( DynamicArray< char > * out, const char * str ) {
+	append( out, str, strlen( str ) );
+}
+
+static const char HTML_HEADER[] =
+	"<!DOCTYPE html>\n"
+	"<html><head><meta charset=\"utf-8\"><style>\n"
+	"body { background: #1a1a1a; color: #b6c2c4; }\n"
+	".f0 { color: #1a1a1a; } .f1 { color: #ca4433; } .f2 { color: #178a3a; } .f3 { color: #dc7c2a; }\n"
+	".f4 { color: #415e87; } .f5 { color: #5e468c; } .f6 { color: #35789b; } .f7 { color: #b6c2c4; }\n"
+	".f8 { color: #ffffff; }\n"
+	".l.f0 { color: #666666; } .l.f1 { color: #ff2954; } .l.f2 { color: #5dd030; } .l.f3 { color: #fafc4f; }\n"
+	".l.f4 { color: #3581e1; } .l.f5 { color: #875fff; } .l.f6 { color: #29fbff; } .l.f7 { color: #cedbde; }\n"
+	".b1 { background: #ca4433; } .b2 { background: #178a3a; } .b3 { background: #dc7c2a; }\n"
+	".b4 { background: #415e87; } .b5 { background: #5e468c; } .b6 { background: #35789b; } .b7 { background: #b6c2c4; }\n"
+	"</style></head><body><pre>\n";
+
+static void append_html_escaped( DynamicArray< char > * out, const char * str, size_t len ) {
+	size_t start = 0;
+	for( size_t i = 0; i < len; i++ ) {
+		const char * entity = NULL;
+		switch( str[ i ] ) {
+			case '&': entity = "&amp;"; break;
+			case '<': entity = "&lt;"; break;
+			case '>': entity = "&gt;"; break;
+		}
+
+		if( entity != NULL ) {
+			append( out, str + start, i - start );
+			append( out, entity );
+			start = i + 1;
+		}
+	}
+
+	append( out, str + start, len - start );
+}
+
+static void append_html( DynamicArray< char > * out, const StyledLine * line ) {
+	for( const StyleRun & run : line->runs ) {
+		const char * text = line->text.ptr() + run.start;
+		AnsiStyle style = run.style;
+
+		bool plain = style.fg == DEFAULT_ANSI_STYLE.fg && style.bg == DEFAULT_ANSI_STYLE.bg && !style.bold;
+		if( plain ) {
+			append_html_escaped( out, text, run.len );
+			continue;
+		}
+
+		char open[ 64 ];
+		snprintf( open, sizeof( open ), "<span class=\"f%d b%d%s\">", int( style.fg ), int( style.bg ), style.bold ? " l" : "" );
+		append( out, open );
+		append_html_escaped( out, text, run.len );
+		append( out, "</span>" );
+	}
+}
+
+static void flush( WriterChannel * ch ) {
+	ZoneScoped;
+
+	if( ch->out.size() == 0 )
+		return;
+
+	// nowhere to report errors, keep going in case it was temporary
+	fwrite( ch->out.ptr(), 1, ch->out.size(), ch->file );
+	fflush( ch->file );
+	ch->out.clear();
+}
+
+static bool handle_message( Span< const u8 > msg ) {
+	LogMessage header;
+	memcpy( &header, msg.ptr, sizeof( header ) );
+	const char * text = ( const char * ) msg.ptr + sizeof( header );
+	size_t len = msg.n - sizeof( header );
+
+	WriterChannel * ch = &writer_channels[ header.channel ];
+
+	switch( header.type ) {
+		case LOG_MESSAGE_OPEN: {
+			ch->file = header.file;
+			ch->format = header.format;
+			ch->out.clear();
+
+			// new HTML files need a header, appending to old ones is fine
+			// because browsers don't care about the missing closing tags
+			if( ch->format == LOG_HTML && fseek( ch->file, 0, SEEK_END ) == 0 && ftell( ch->file ) == 0 ) {
+				append( &ch->out, HTML_HEADER, sizeof( HTML_HEADER ) - 1 );
+			}
+		} break;
+
+		case LOG_MESSAGE_WRITE:
+			if( ch->format == LOG_RAW ) {
+				append( &ch->out, text, len );
+			}
+			else {
+				line_parse( &scratch_line, header.style, text, len );
+				if( ch->format == LOG_CLEAN )
+					append( &ch->out, scratch_line.text.ptr(), scratch_line.text.size() );
+				else
+					append_html( &ch->out, &scratch_line );
+			}
+			append( &ch->out, "\n" );
+			break;
+
+		case LOG_MESSAGE_DROPPED: {
+			char note[ 64 ];
+			snprintf( note, sizeof( note ), "[%u lines dropped]\n", header.dropped );
+			append( &ch->out, note );
+		} break;
+
+		case LOG_MESSAGE_CLOSE:
+			flush( ch );
+			fclose( ch->file );
+			ch->file = NULL;
+			break;
+
+		case LOG_MESSAGE_QUIT:
+			return false;
+	}
+
+	if( ch->file != NULL && ch->out.size() >= FLUSH_BYTES )
+		flush( ch );
+
+	return true;
+}
+
+static void writer_thread_main() {
+	tracy::SetThreadName( "Log writer" );
+
+	double next_flush = get_time() + LOG_FLUSH_INTERVAL_MS / 1000.0;
+	bool running = true;
+
+	while( running ) {
+		wakeup_wait( &wakeup, LOG_FLUSH_INTERVAL_MS );
+		wakeup_drain( &wakeup );
+
+		Span< const u8 > msg;
+		while( running && ring.pop( &msg ) ) {
+			running = handle_message( msg );
+		}
+		ring.release();
+
+		double now = get_time();
+		bool flush_all = !running || now >= next_flush;
+		if( flush_all )
+			next_flush = now + LOG_FLUSH_INTERVAL_MS / 1000.0;
+
+		for( WriterChannel & ch : writer_channels ) {
+			if( ch.file != NULL && ( flush_all || ch.out.size() >= FLUSH_BYTES ) ) {
+				flush( &ch );
+			}
+		}
+	}
+
+	for( WriterChannel & ch : writer_channels ) {
+		if( ch.file != NULL ) {
+			fclose( ch.file );
+			ch.file = NULL;
+		}
+	}
+}
+
+void log_writer_init() {
+	wakeup_init( &wakeup );
+	thread = std::thread( writer_thread_main );
+}
+
+void log_writer_term() {
+	LogMessage msg = { };
+	msg.type = LOG_MESSAGE_QUIT;
+	push_blocking( msg );
+
+	thread.join();
+	wakeup_term( &wakeup );
+}
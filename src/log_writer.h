@@ -0,0 +1,35 @@
+#pragma once
+
+#include "common.h"
+#include "line.h"
+
+/*
+ * log files are written by their own thread so a slow disk can't hold up
+ * lines. the main thread only copies raw bytes into a ring, and the writer
+ * thread strips escape codes or converts them to HTML, batches the output
+ * per file and writes it when enough has built up or LOG_FLUSH_INTERVAL_MS
+ * has passed. if the ring fills up we drop lines instead of waiting, and
+ * note how many went missing in the log
+ */
+
+enum LogFormat : u8 {
+	LOG_RAW,
+	LOG_CLEAN,
+	LOG_HTML,
+};
+
+constexpr int LOG_FLUSH_INTERVAL_MS = 500;
+
+// opens path for appending. returns a channel id, or -1 and sets *err
+int log_open( const char ** err, const char * path, LogFormat format );
+void log_close( int channel );
+
+// text can contain escape codes, a newline gets added
+void log_write( int channel, const char * text, size_t len, AnsiStyle style );
+
+// session channels get every line we receive from the server
+void log_set_session( int channel, bool session );
+void log_session_line( const char * raw, size_t len, AnsiStyle style );
+
+void log_writer_init();
+void log_writer_term();
@@ -1,12 +1,19 @@
-local Actions = { }
-local PreActions = { }
-local AnsiActions = { }
-local AnsiPreActions = { }
+local timer = require( "timer" )
+local trigger = require( "trigger" )
 
-local ChatActions = { }
-local ChatPreActions = { }
-local ChatAnsiActions = { }
-local ChatAnsiPreActions = { }
+local ChatActions = trigger.newChatSet( false )
+local ChatPreActions = trigger.newChatSet( false )
+local ChatAnsiActions = trigger.newChatSet( true )
+local ChatAnsiPreActions = trigger.newChatSet( true )
+
+local Actions = trigger.newSet( false, ChatActions )
+local PreActions = trigger.newSet( false, ChatPreActions )
+local AnsiActions = trigger.newSet( true, ChatAnsiActions )
+local AnsiPreActions = trigger.newSet( true, ChatAnsiPreActions )
+
+local MultiActions = trigger.newSet( false )
+
+local Waiters = { }
 
 local doActions
 local doPreActions
@@ -19,8 +26,26 @@ local doChatAnsiActions
 local doChatAnsiPreActions
 
 local function genericActions( actions )
+	local raw = actions.raw
+
+	-- check for a match natively first so lines nothing matches never
+	-- become Lua strings
+	local function run( action, line )
+		local ok, found = pcall( trigger.find, line, action.pattern, raw )
+
+		if not ok then
+			mud.print( "\n#s> action callback failed: %s", found )
+		elseif found then
+			local ok, err = xpcall( string.gsub, debug.traceback, trigger.text( line, raw ), action.pattern, action.callback )
+
+			if not ok then
+				mud.print( "\n#s> action callback failed: %s", err )
+			end
+		end
+	end
+
 	return
-		function( pattern, callback, disabled )
+		function( pattern, callback, opts )
 			enforce( pattern, "pattern", "string" )
 			enforce( callback, "callback", "function", "string" )
 
@@ -32,38 +57,227 @@ local function genericActions( actions )
 				end
 			end
 
-			local action = {
+			local action = trigger.add( actions, {
 				pattern = pattern,
 				callback = callback,
+			}, opts )
 
-				enabled = not disabled,
+			return action
+		end,
 
-				enable = function( self )
-					self.enabled = true
-				end,
-				disable = function( self )
-					self.enabled = false
-				end,
-			}
+		function( line, prompt )
+			trigger.dispatch( actions, line, prompt, run )
+		end
+end
 
-			table.insert( actions, action )
+-- multi-line actions are a list of patterns that have to match lines in
+-- order, all within the last `within` lines. each action keeps the matches
+-- it's partway through, so every line is only checked against the next
+-- pattern of each of them and never joined back together. the lines
+-- themselves stay in a native ring, see mud.recentLine. the callback gets
+-- each pattern's captures in order, or the text it matched if it has none,
+-- like mud.action. action.lines is set to the number of lines the match
+-- spanned before calling back
 
-			return action
-		end,
+-- adds what line:match returned to captures, making the table if it needs
+-- to. returns nil if the pattern didn't match
+local function appendCaptures( captures, first, ... )
+	if first == nil then
+		return nil
+	end
+
+	captures = captures or { }
+	captures[ #captures + 1 ] = first
+	for i = 1, select( "#", ... ) do
+		captures[ #captures + 1 ] = ( select( i, ... ) )
+	end
 
-		function( line )
-			for i = 1, #actions do
-				local action = actions[ i ]
+	return captures
+end
 
-				if action.enabled then
-					local ok, err = xpcall( string.gsub, debug.traceback, line, action.pattern, action.callback )
+local function stepMulti( action, line )
+	local number = line:number()
+	local patterns = action.patterns
+	local partials = action.partials
+	local kept = 0
+	local complete
 
-					if not ok then
-						mud.print( "\n#s> action callback failed: %s", err )
-					end
-				end
+	-- only makes a table for the captures if the first pattern matched
+	local captures = appendCaptures( nil, line:match( patterns[ 1 ] ) )
+
+	for i = 1, #partials do
+		local partial = partials[ i ]
+		partials[ i ] = nil
+
+		local remaining = #patterns - partial.step + 1
+		local window = action.within - ( number - partial.start )
+
+		if remaining <= window then
+			if appendCaptures( partial.captures, line:match( patterns[ partial.step ] ) ) then
+				partial.step = partial.step + 1
+			end
+
+			if partial.step > #patterns then
+				complete = complete or { }
+				table.insert( complete, partial )
+			elseif #patterns - partial.step + 1 < window then
+				kept = kept + 1
+				partials[ kept ] = partial
+			end
+		end
+	end
+
+	-- a match that starts here moves on to its second pattern next line
+	if captures then
+		local partial = { start = number, step = 2, captures = captures }
+
+		if #patterns == 1 then
+			complete = complete or { }
+			table.insert( complete, partial )
+		else
+			kept = kept + 1
+			partials[ kept ] = partial
+		end
+	end
+
+	if complete then
+		for _, partial in ipairs( complete ) do
+			action.lines = number - partial.start + 1
+
+			local ok, err = xpcall( action.callback, debug.traceback, table.unpack( partial.captures ) )
+			if not ok then
+				mud.print( "\n#s> action callback failed: %s", err )
 			end
 		end
+	end
+end
+
+function mud.multiAction( patterns, callback, opts )
+	enforce( patterns, "patterns", "table" )
+	enforce( callback, "callback", "function", "string" )
+
+	if #patterns == 0 then
+		error( "multi-line actions need at least one pattern", 2 )
+	end
+
+	for _, pattern in ipairs( patterns ) do
+		local ok, err = pcall( string.find, "", pattern )
+		if not ok then
+			error( err, 2 )
+		end
+	end
+
+	local within = #patterns
+	if type( opts ) == "table" then
+		within = opts.within or within
+
+		if type( within ) ~= "number" or within < #patterns or within > mud.recentLineLimit then
+			error( "within should be a number between %d and %d" % { #patterns, mud.recentLineLimit }, 2 )
+		end
+
+		if opts.literal then
+			error( "multi-line actions can't have a literal", 2 )
+		end
+	end
+
+	if type( callback ) == "string" then
+		local command = callback
+
+		callback = function()
+			mud.input( command, true )
+		end
+	end
+
+	local action = trigger.add( MultiActions, {
+		patterns = patterns,
+		callback = callback,
+		within = within,
+		partials = { },
+		lines = 0,
+	}, opts )
+
+	return action
+end
+
+local function runMulti( action, line )
+	local ok, err = pcall( stepMulti, action, line )
+	if not ok then
+		mud.print( "\n#s> action callback failed: %s", err )
+		action.partials = { }
+	end
+end
+
+local function doMultiActions( line, prompt )
+	trigger.dispatch( MultiActions, line, prompt, runMulti )
+end
+
+local function doWaits( line )
+	local n = #Waiters
+	if n == 0 then
+		return
+	end
+
+	-- waiters registered by resumed coroutines should wait for the next line
+	local ready
+	local kept = 0
+
+	for i = 1, n do
+		local waiter = Waiters[ i ]
+		Waiters[ i ] = nil
+
+		if line:find( waiter.pattern ) then
+			waiter.captures = { line:match( waiter.pattern ) }
+			ready = ready or { }
+			table.insert( ready, waiter )
+		else
+			kept = kept + 1
+			Waiters[ kept ] = waiter
+		end
+	end
+
+	if ready then
+		for _, waiter in ipairs( ready ) do
+			if waiter.timer then
+				timer.cancel( waiter.timer )
+			end
+
+			timer.resume( waiter.co, table.unpack( waiter.captures ) )
+		end
+	end
+end
+
+function mud.waitFor( pattern, timeout )
+	enforce( pattern, "pattern", "string" )
+	enforce( timeout, "timeout", "number", "nil" )
+
+	local co = timer.currentCoroutine( "mud.waitFor" )
+
+	local ok, err = pcall( string.find, "", pattern )
+	if not ok then
+		error( err, 2 )
+	end
+
+	local waiter = {
+		pattern = pattern,
+		co = co,
+	}
+
+	if timeout then
+		waiter.timer = timer.add( mud.now() + timeout, function()
+			for i, other in ipairs( Waiters ) do
+				if other == waiter then
+					table.remove( Waiters, i )
+					break
+				end
+			end
+
+			timer.resume( co, nil )
+		end )
+	end
+
+	table.insert( Waiters, waiter )
+
+	return coroutine.yield()
 end
 
 mud.action,        doActions        = genericActions( Actions )
@@ -82,6 +296,9 @@ return {
 	doAnsiActions = doAnsiActions,
 	doAnsiPreActions = doAnsiPreActions,
 
+	doMultiActions = doMultiActions,
+	doWaits = doWaits,
+
 	doChatActions = doChatActions,
 	doChatPreActions = doChatPreActions,
 	doChatAnsiActions = doChatAnsiActions,
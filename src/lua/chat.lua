@@ -149,10 +149,15 @@ local function call( address, port )
 
 		state = "connecting",
 		handler = coroutine.create( dataCoro ),
-
-		called_at = os.time(),
 	}
 
+	mud.after( 10, function()
+		if chat.state == "connecting" then
+			mud.print( "\n#s> No response from %s", chat.name )
+			killChat( chat )
+		end
+	end )
+
 	assert( coroutine.resume( chat.handler, chat ) )
 
 	table.insert( Chats, chat )
@@ -223,16 +228,6 @@ mud.alias( "/chatname", function( name )
 	handleChat()
 end )
 
-mud.interval( function()
-	local now = os.time()
-	for i = #Chats, 1, -1 do
-		if Chats[ i ].state == "connecting" and now - Chats[ i ].called_at >= 10 then
-			mud.print( "\n#s> No response from %s", Chats[ i ].name )
-			killChat( Chats[ i ] )
-		end
-	end
-end, 5 )
-
 return {
 	init = function( chatHandler )
 		handleChat = chatHandler
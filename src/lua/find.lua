@@ -0,0 +1,45 @@
+local find, findNext, clearFind
+
+-- searches the main window's scrollback, case insensitively. mud.find jumps
+-- to the newest match and mud.findNext moves on from there, towards older
+-- lines unless newer is set
+function mud.find( text )
+	enforce( text, "text", "string" )
+
+	return find( text )
+end
+
+function mud.findNext( newer )
+	return findNext( not newer )
+end
+
+function mud.clearFind()
+	clearFind()
+end
+
+-- don't put the query in the message or we'd match it next time
+mud.alias( "/find", function( text )
+	if text ~= "" then
+		if not mud.find( text ) then
+			mud.print( "\n#s> No matches" )
+		end
+	elseif not mud.findNext() then
+		mud.print( "\n#s> No older matches" )
+	end
+end )
+
+mud.alias( "/findnewer", function()
+	if not mud.findNext( true ) then
+		mud.print( "\n#s> No newer matches" )
+	end
+end )
+
+mud.alias( "/findclear", mud.clearFind )
+
+return {
+	init = function( f, n, c )
+		find = f
+		findNext = n
+		clearFind = c
+	end,
+}
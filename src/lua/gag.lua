@@ -1,46 +1,35 @@
-local Gags = { }
-local AnsiGags = { }
+local trigger = require( "trigger" )
 
-local ChatGags = { }
-local AnsiChatGags = { }
+local ChatGags = trigger.newChatSet( false )
+local ChatAnsiGags = trigger.newChatSet( true )
+
+local Gags = trigger.newSet( false, ChatGags )
+local AnsiGags = trigger.newSet( true, ChatAnsiGags )
 
 local doGags
 local doAnsiGags
 
 local doChatGags
-local doAnsiChatGags
+local doChatAnsiGags
 
 local function genericGags( gags )
-	return
-		function( pattern, disabled )
-			local gag = {
-				pattern = pattern,
+	local raw = gags.raw
 
-				enabled = not disabled,
+	local function matches( gag, line )
+		return trigger.find( line, gag.pattern, raw ) ~= nil
+	end
 
-				enable = function( self )
-					self.enabled = true
-				end,
-				disable = function( self )
-					self.enabled = false
-				end,
-			}
+	return
+		function( pattern, opts )
+			enforce( pattern, "pattern", "string" )
 
-			table.insert( gags, gag )
+			local gag = trigger.add( gags, { pattern = pattern }, opts )
 
 			return gag
 		end,
 
-		function( line )
-			for i = 1, #gags do
-				local gag = gags[ i ]
-
-				if gag.enabled and line:find( gag.pattern ) then
-					return true
-				end
-			end
-
-			return false
+		function( line, prompt )
+			return trigger.dispatch( gags, line, prompt, matches )
 		end
 end
 
@@ -4,12 +4,14 @@ local intercept = require( "intercept" )
 local gag = require( "gag" )
 local macro = require( "macro" )
 local sub = require( "sub" )
-local interval = require( "interval" )
+local timer = require( "timer" )
+local window = require( "window" )
 
 local lpeg = require( "lpeg" )
 
-local GA = "\255\249"
+local printLine
 
+-- colours for chat messages, lines from the mud keep theirs natively
 local bold = false
 local fg = 7
 local bg = 0
@@ -20,21 +22,8 @@ local lastWasGA = false
 local receiving = false
 local showInput = true
 
-local dataBuffer = ""
 local pendingInputs = { }
 
-local function echoOn()
-	showInput = true
-
-	return ""
-end
-
-local function echoOff()
-	showInput = false
-
-	return ""
-end
-
 local function setFG( colour )
 	return function()
 		fg = colour
@@ -96,131 +85,113 @@ local function printPendingInputs()
 end
 
 local function handleChat( message )
-	lastWasChat = true
-	lastWasGA = false
-
 	if not message then
+		lastWasChat = true
+		lastWasGA = false
+
 		return
 	end
 
-	local oldFG = fg
-	local oldBG = bg
-	local oldBold = bold
-
-	fg = 1
-	bg = 0
-	bold = true
-
 	local noAnsi = message:gsub( "\27%[[%d;]*%a", "" )
 
+	local gagged = gag.doChatGags( noAnsi ) or gag.doChatAnsiGags( message )
+
 	action.doChatPreActions( noAnsi )
 	action.doChatAnsiPreActions( message )
 
-	mud.newlineMain()
-	mud.newlineChat()
+	if not gagged then
+		lastWasChat = true
+		lastWasGA = false
 
-	for line, newLine in message:gmatch( "([^\n]*)(\n?)" ) do
-		for text, opts, escape in ( line .. "\27[m" ):gmatch( "(.-)\27%[([%d;]*)(%a)" ) do
-			if text ~= "" then
-				mud.printMain( text, fg, bg, bold )
-				mud.printChat( text, fg, bg, bold )
-			end
+		local oldFG = fg
+		local oldBG = bg
+		local oldBold = bold
+
+		fg = 1
+		bg = 0
+		bold = true
+
+		mud.newlineMain()
+		mud.newlineChat()
+
+		for line, newLine in message:gmatch( "([^\n]*)(\n?)" ) do
+			for text, opts, escape in ( line .. "\27[m" ):gmatch( "(.-)\27%[([%d;]*)(%a)" ) do
+				if text ~= "" then
+					mud.printMain( text, fg, bg, bold )
+					mud.printChat( text, fg, bg, bold )
+				end
 
-			for opt in opts:gmatch( "([^;]+)" ) do
-				if Escapes[ escape ][ opt ] then
-					Escapes[ escape ][ opt ]()
+				for opt in opts:gmatch( "([^;]+)" ) do
+					if Escapes[ escape ][ opt ] then
+						Escapes[ escape ][ opt ]()
+					end
 				end
 			end
-		end
 
-		if newLine == "\n" then
-			mud.newlineMain()
-			mud.newlineChat()
+			if newLine == "\n" then
+				mud.newlineMain()
+				mud.newlineChat()
+			end
 		end
+
+		fg = oldFG
+		bg = oldBG
+		bold = oldBold
 	end
 
 	action.doChatActions( noAnsi )
 	action.doChatAnsiActions( message )
-
-	fg = oldFG
-	bg = oldBG
-	bold = oldBold
 end
 
-local function handleData( data )
+-- line is a native line object, see line:text()/line:raw()/line:find()
+local function handleLine( line, prompt )
 	receiving = true
 
-	dataBuffer = dataBuffer .. data
-
-	-- TODO: this sucks!
-	-- can insert newlines in random places if we receive a GA followed by partial data
-	if data:match( GA ) then
-		dataBuffer = dataBuffer:gsub( "\r", "" )
-
-		dataBuffer = dataBuffer:gsub( "\255\252\1", echoOn )
-		dataBuffer = dataBuffer:gsub( "\255\251\1", echoOff )
-
-		dataBuffer = dataBuffer:gsub( "\255\253\24", "" )
-		dataBuffer = dataBuffer:gsub( "\255\253\31", "" )
-		dataBuffer = dataBuffer:gsub( "\255\253\34", "" )
-
-		dataBuffer = dataBuffer .. "\n"
-
-		for line in dataBuffer:gmatch( "([^\n]*)\n" ) do
-			if lastWasGA then
-				if line ~= "" then
-					mud.newlineMain()
-				end
-
-				lastWasGA = false
-			end
-
-			if lastWasChat then
-				mud.newlineMain()
-
-				lastWasChat = false
-			end
+	if lastWasGA then
+		if #line > 0 then
+			mud.newlineMain()
+		end
 
-			local clean, subs = line:gsub( GA, "" )
-			local hasGA = subs ~= 0
+		lastWasGA = false
+	end
 
-			local noAnsi = clean:gsub( "\27%[%d*%a", "" )
+	if lastWasChat then
+		mud.newlineMain()
 
-			local gagged = gag.doGags( noAnsi ) or gag.doAnsiGags( clean )
+		lastWasChat = false
+	end
 
-			action.doPreActions( noAnsi )
-			action.doAnsiPreActions( clean )
+	local gagged = gag.doGags( line, prompt ) or gag.doAnsiGags( line, prompt )
 
-			local subbed = sub.doSubs( clean )
+	action.doPreActions( line, prompt )
+	action.doAnsiPreActions( line, prompt )
 
-			for text, opts, escape in ( subbed .. "\27[m" ):gmatch( "(.-)\27%[([%d;]*)(%a)" ) do
-				if text ~= "" and not gagged then
-					mud.printMain( text, fg, bg, bold )
-				end
+	sub.doSubs( line, prompt )
 
-				for opt in opts:gmatch( "([^;]+)" ) do
-					if Escapes[ escape ] and Escapes[ escape ][ opt ] then
-						Escapes[ escape ][ opt ]()
-					end
-				end
-			end
-
-			if hasGA then
-				lastWasGA = true
-				printPendingInputs()
-			else
-				if not gagged then
-					mud.newlineMain()
-				end
-			end
+	if window.doRoutes( line, prompt ) then
+		gagged = true
+	end
 
-			action.doActions( noAnsi )
-			action.doAnsiActions( clean )
-		end
+	printLine( line, gagged )
 
-		dataBuffer = ""
+	if prompt then
+		lastWasGA = true
 		receiving = false
+		printPendingInputs()
+	else
+		if not gagged then
+			mud.newlineMain()
+		end
 	end
+
+	action.doActions( line, prompt )
+	action.doAnsiActions( line, prompt )
+	action.doMultiActions( line, prompt )
+	action.doWaits( line )
+end
+
+local function handleEcho( echo )
+	showInput = echo
 end
 
 local function handleCommand( input, hide )
@@ -288,11 +259,15 @@ local function handleClose()
 end
 
 return {
-	data = handleData,
+	init = function( print_line )
+		printLine = print_line
+	end,
+
+	line = handleLine,
+	echo = handleEcho,
 	chat = handleChat,
 	input = handleInput,
 	macro = handleMacro,
-	interval = interval.doIntervals,
-	socket = handleSocketData,
+	timer = timer.fire,
 	close = handleClose,
 }
@@ -0,0 +1,99 @@
+local add, set, remove
+
+local Colours = {
+	k = 0,
+	r = 1,
+	g = 2,
+	y = 3,
+	b = 4,
+	m = 5,
+	c = 6,
+	w = 7,
+	s = 8,
+}
+
+local function colour( name, level )
+	if name == nil then
+		return nil
+	end
+
+	local c = Colours[ name ]
+	if not c then
+		error( "bad highlight colour `%s'" % tostring( name ), level + 1 )
+	end
+
+	return c
+end
+
+-- style is a colour like "r", a bold colour like "lr", or a table with any
+-- of fg/bg/bold. opts can have pattern = true to treat text as a Lua
+-- pattern, word = true to only match whole words, and disabled = true
+function mud.highlight( text, style, opts )
+	enforce( text, "text", "string" )
+	enforce( style, "style", "string", "table" )
+	enforce( opts, "opts", "table", "nil" )
+
+	opts = opts or { }
+
+	if text == "" then
+		error( "can't highlight an empty string", 2 )
+	end
+
+	if opts.pattern then
+		local ok, err = pcall( string.find, "", text )
+		if not ok then
+			error( err, 2 )
+		end
+	end
+
+	local fg, bg, bold
+	if type( style ) == "string" then
+		local l, name = style:match( "^(l?)(%l)$" )
+		fg = colour( name or style, 2 )
+		bold = l == "l" or nil
+	else
+		fg = colour( style.fg, 2 )
+		bg = colour( style.bg, 2 )
+		bold = style.bold
+	end
+
+	local highlight = {
+		text = text,
+		enabled = true,
+
+		enable = function( self )
+			if self.id and not self.enabled then
+				self.enabled = true
+				set( self.id, true )
+			end
+		end,
+		disable = function( self )
+			if self.id and self.enabled then
+				self.enabled = false
+				set( self.id, false )
+			end
+		end,
+		remove = function( self )
+			if self.id then
+				remove( self.id )
+				self.id = nil
+			end
+		end,
+	}
+
+	highlight.id = add( text, opts.pattern, opts.word, fg, bg, bold )
+
+	if opts.disabled then
+		highlight:disable()
+	end
+
+	return highlight
+end
+
+return {
+	init = function( highlightAdd, highlightSet, highlightRemove )
+		add = highlightAdd
+		set = highlightSet
+		remove = highlightRemove
+	end,
+}
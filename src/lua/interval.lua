@@ -1,17 +1,13 @@
-local Intervals = { }
+local timer = require( "timer" )
 
-local function doIntervals()
-	local now = mud.now()
-
-	for i = 1, #Intervals do
-		local event = Intervals[ i ]
+local function schedule( event )
+	if event.timer then
+		timer.cancel( event.timer )
+		event.timer = nil
+	end
 
-		if event.enabled then
-			local ok, err = xpcall( event.checkTick, debug.traceback, event, now )
-			if not ok then
-				mud.print( "\n#s> interval callback failed: %s", err )
-			end
-		end
+	if event.enabled then
+		event.timer = timer.add( event.nextTick, event.fire )
 	end
 end
 
@@ -27,16 +23,23 @@ function mud.interval( callback, interval, disabled )
 		enabled = not disabled,
 
 		enable = function( self )
-			self.enabled = true
+			if not self.enabled then
+				self.enabled = true
+				schedule( self )
+			end
 		end,
 		disable = function( self )
-			self.enabled = false
+			if self.enabled then
+				self.enabled = false
+				schedule( self )
+			end
 		end,
 
 		tick = function( self, now )
-			callback( now )
-
+			-- before the callback so it can tend us
 			self.nextTick = now + self.interval
+
+			callback( now )
 		end,
 
 		checkTick = function( self, now )
@@ -47,6 +50,8 @@ function mud.interval( callback, interval, disabled )
 			if now >= self.nextTick then
 				self:tick( now )
 			end
+
+			schedule( self )
 		end,
 
 		tend = function( self, tolerance, desired )
@@ -58,8 +63,10 @@ function mud.interval( callback, interval, disabled )
 
 			if toTick <= tolerance then
 				self.nextTick = math.avg( self.nextTick, desired )
+				schedule( self )
 			elseif sinceTick <= tolerance then
 				self.nextTick = math.avg( self.nextTick, desired + self.interval )
+				schedule( self )
 			else
 				self.nextTick = desired
 
@@ -68,11 +75,20 @@ function mud.interval( callback, interval, disabled )
 		end,
 	}
 
-	table.insert( Intervals, event )
+	event.fire = function( now )
+		event.timer = nil
+
+		local ok, err = xpcall( event.tick, debug.traceback, event, now )
+		if not ok then
+			mud.print( "\n#s> interval callback failed: %s", err )
+		end
+
+		-- the callback might have tended or disabled us, so always go by
+		-- nextTick and enabled rather than whatever it scheduled
+		schedule( event )
+	end
+
+	schedule( event )
 
 	return event
 end
-
-return {
-	doIntervals = doIntervals,
-}
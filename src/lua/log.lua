@@ -0,0 +1,130 @@
+local lfs = require( "lfs" )
+
+local open, write, close, setSession
+
+-- ids match LogFormat in log_writer.h
+local Formats = {
+	raw = { id = 0, extension = ".log" },
+	clean = { id = 1, extension = ".txt" },
+	html = { id = 2, extension = ".html" },
+}
+
+local PathSeparator = package.config:sub( 1, 1 )
+
+local LogsDir
+if mud.os == "windows" then
+	LogsDir = os.getenv( "APPDATA" ) .. "\\Mud Gangster\\logs"
+else
+	LogsDir = os.getenv( "HOME" ) .. "/.mudgangster/logs"
+end
+
+local Channels = { }
+local Sessions = { }
+
+local function openLog( name, format, level )
+	if not lfs.attributes( LogsDir ) then
+		lfs.mkdir( LogsDir )
+	end
+
+	local path = LogsDir .. PathSeparator .. name .. Formats[ format ].extension
+	local id, err = open( path, Formats[ format ].id )
+	if not id then
+		error( "couldn't open log `%s': %s" % { path, err }, level + 1 )
+	end
+
+	return id
+end
+
+local function checkChannel( channel )
+	if not channel:match( "^[%w_%-%.]+$" ) then
+		error( "log channel names can only have letters, numbers, _, - and .", 3 )
+	end
+end
+
+local function checkFormat( format )
+	if not Formats[ format ] then
+		error( "bad log format `%s'" % tostring( format ), 3 )
+	end
+end
+
+-- appends a line to logs/<channel>.txt, or whichever format mud.logFormat
+-- picked. the writing happens on another thread so this never blocks.
+-- text can have escape codes, which are stripped or turned into HTML
+function mud.log( channel, text )
+	enforce( channel, "channel", "string" )
+	enforce( text, "text", "string" )
+
+	local log = Channels[ channel ]
+
+	if not log then
+		checkChannel( channel )
+
+		log = {
+			format = "clean",
+			id = openLog( channel, "clean", 2 ),
+		}
+
+		Channels[ channel ] = log
+	end
+
+	write( log.id, text )
+end
+
+-- format is "raw" (escape codes kept), "clean" (stripped) or "html"
+function mud.logFormat( channel, format )
+	enforce( channel, "channel", "string" )
+	enforce( format, "format", "string" )
+
+	checkChannel( channel )
+	checkFormat( format )
+
+	local log = Channels[ channel ]
+
+	if log then
+		if log.format == format then
+			return
+		end
+
+		close( log.id )
+		Channels[ channel ] = nil
+	end
+
+	Channels[ channel ] = {
+		format = format,
+		id = openLog( channel, format, 2 ),
+	}
+end
+
+-- logs everything the server sends, before any gags or subs, to
+-- logs/session-<date>.<ext>. call once per format you want
+function mud.sessionLog( format, enabled )
+	enforce( format, "format", "string", "nil" )
+	enforce( enabled, "enabled", "boolean", "nil" )
+
+	format = format or "clean"
+	checkFormat( format )
+
+	if enabled == false then
+		if Sessions[ format ] then
+			close( Sessions[ format ] )
+			Sessions[ format ] = nil
+		end
+
+		return
+	end
+
+	if not Sessions[ format ] then
+		local id = openLog( "session-" .. os.date( "%Y%m%d-%H%M%S" ), format, 2 )
+		setSession( id, true )
+		Sessions[ format ] = id
+	end
+end
+
+return {
+	init = function( o, w, c, s )
+		open = o
+		write = w
+		close = c
+		setSession = s
+	end,
+}
@@ -15,7 +15,14 @@ local handlers = require( "handlers" )
 local printMain, newlineMain, printChat, newlineChat,
 	setHandlers, urgent, setStatus,
 	sock_connect, sock_send, sock_close,
-	get_time, set_font,
+	get_time, timer_add, timer_cancel, set_font, set_split,
+	window_open, window_layout, window_close, window_print, window_line,
+	grid_open, grid_set, grid_blit, grid_clear,
+	memstats, gc, print_line, recent_line, recent_line_limit,
+	highlight_add, highlight_set, highlight_remove,
+	find, find_next, clear_find,
+	log_open, log_write, log_close, log_session,
+	map_room, map_remove_room, map_exit, map_get, map_find, map_path, map_save, map_load, map_clear,
 	exe_path = ...
 
 local socket_api = {
@@ -24,7 +31,7 @@ local socket_api = {
 	close = sock_close,
 }
 
-local socket_data_handler = require( "socket" ).init( socket_api )
+local socket_data_handler, socket_line_handler, socket_echo_handler = require( "socket" ).init( socket_api )
 
 mud.printMain = printMain
 mud.newlineMain = newlineMain
@@ -33,10 +40,18 @@ mud.newlineChat = newlineChat
 
 mud.urgent = urgent
 mud.now = get_time
+mud.memstats = memstats
+mud.gc = gc
+mud.recentLine = recent_line
+mud.recentLineLimit = recent_line_limit
 
 mud.last_human_input_time = mud.now()
 
-require( "mud" ).init( handlers.data )
+require( "timer" ).init( timer_add, timer_cancel )
+require( "interval" )
+
+handlers.init( print_line )
+require( "mud" ).init( handlers.line, handlers.echo )
 require( "chat" ).init( handlers.chat )
 
 mud.alias( "/font", {
@@ -48,8 +63,31 @@ mud.alias( "/font", {
 	end,
 }, "<font name> <font size>" )
 
+-- keeps the bottom rows of the main window showing new lines while you're
+-- scrolled back. 0 or nil turns it off
+function mud.split( rows )
+	enforce( rows, "rows", "number", "nil" )
+
+	set_split( rows or 0 )
+end
+
+mud.alias( "/split", {
+	[ "^$" ] = function()
+		mud.split( 0 )
+	end,
+
+	[ "^(%d+)$" ] = function( rows )
+		mud.split( tonumber( rows ) )
+	end,
+}, "[rows]" )
+
 require( "status" ).init( setStatus )
+require( "highlight" ).init( highlight_add, highlight_set, highlight_remove )
+require( "find" ).init( find, find_next, clear_find )
+require( "log" ).init( log_open, log_write, log_close, log_session )
+require( "map" ).init( map_room, map_remove_room, map_exit, map_get, map_find, map_path, map_save, map_load, map_clear )
+require( "window" ).init( window_open, window_layout, window_close, window_print, window_line, grid_open, grid_set, grid_blit, grid_clear )
 
-setHandlers( handlers.input, handlers.macro, handlers.close, socket_data_handler, handlers.interval )
+setHandlers( handlers.input, handlers.macro, handlers.close, socket_data_handler, socket_line_handler, socket_echo_handler, handlers.timer )
 
 script.load( exe_path )
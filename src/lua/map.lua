@@ -0,0 +1,224 @@
+local lfs = require( "lfs" )
+
+local setRoom, removeRoom, setExit, getRoom, findRooms, findPath, save, load, clear
+
+local PathSeparator = package.config:sub( 1, 1 )
+
+local MapsDir
+if mud.os == "windows" then
+	MapsDir = os.getenv( "APPDATA" ) .. "\\Mud Gangster\\maps"
+else
+	MapsDir = os.getenv( "HOME" ) .. "/.mudgangster/maps"
+end
+
+local Here
+
+local function checkMapName( name )
+	enforce( name, "name", "string" )
+
+	if not name:match( "^[%w_%-%.]+$" ) then
+		error( "map names can only have letters, numbers, _, - and .", 3 )
+	end
+
+	return MapsDir .. PathSeparator .. name .. ".map"
+end
+
+-- creates or updates a room. ids are whatever numbers suit the MUD, like
+-- vnums. anything left out of opts keeps its old value:
+--
+--   name = ""
+--   flags = 0, a bitmask that mud.path can be told to avoid
+--   cost = 0, added to every exit into the room, e.g. for swimming
+--   x, y, z, optional, z defaults to 0. paths are found much faster when
+--   every room has them
+function mud.room( id, opts )
+	enforce( id, "id", "number" )
+	enforce( opts, "opts", "table", "nil" )
+
+	opts = opts or { }
+	local room = getRoom( id ) or { name = "", flags = 0, cost = 0 }
+
+	local name = opts.name or room.name
+	local flags = opts.flags or room.flags
+	local cost = opts.cost or room.cost
+	enforce( name, "name", "string" )
+	enforce( flags, "flags", "number" )
+	enforce( cost, "cost", "number" )
+
+	local x, y, z = room.x, room.y, room.z
+	if opts.x or opts.y or opts.z then
+		x = opts.x
+		y = opts.y
+		z = opts.z or 0
+		enforce( x, "x", "number" )
+		enforce( y, "y", "number" )
+		enforce( z, "z", "number" )
+	end
+
+	setRoom( id, name, flags, cost, x, y, z )
+end
+
+-- also removes every exit leading into the room
+function mud.removeRoom( id )
+	enforce( id, "id", "number" )
+
+	removeRoom( id )
+end
+
+-- returns { name, flags, cost, x, y, z, exits = { [ command ] = { to, cost } } }
+-- or nil if there's no such room
+function mud.roomInfo( id )
+	enforce( id, "id", "number" )
+
+	return getRoom( id )
+end
+
+-- adds an exit that takes you from one room to another when you send
+-- command, replacing any exit from that room with the same command. the
+-- command can have ;s in it, like "open door;n". cost defaults to 1 and
+-- setting to to nil removes the exit
+function mud.exit( from, command, to, cost )
+	enforce( from, "from", "number" )
+	enforce( command, "command", "string" )
+	enforce( to, "to", "number", "nil" )
+	enforce( cost, "cost", "number", "nil" )
+
+	setExit( from, command, to, cost or 1 )
+end
+
+-- finds rooms with text in their name, case insensitively
+function mud.findRooms( text, limit )
+	enforce( text, "text", "string" )
+	enforce( limit, "limit", "number", "nil" )
+
+	return findRooms( text, limit or 20 )
+end
+
+-- returns the cheapest list of commands that walks from one room to the
+-- other and what it costs, or nil if there's no way. rooms with any of the
+-- avoid flags are only walked into if they're the destination
+function mud.path( from, to, avoid )
+	enforce( from, "from", "number" )
+	enforce( to, "to", "number" )
+	enforce( avoid, "avoid", "number", "nil" )
+
+	return findPath( from, to, avoid or 0 )
+end
+
+-- tells the mapper which room you're in. call it from your triggers as you
+-- move around. returns the current room
+function mud.here( id )
+	enforce( id, "id", "number", "nil" )
+
+	if id then
+		Here = id
+	end
+
+	return Here
+end
+
+-- speedwalks from mud.here to the room. returns false if we don't know
+-- how to get there
+function mud.go( to, avoid )
+	enforce( to, "to", "number" )
+	enforce( avoid, "avoid", "number", "nil" )
+
+	if not Here then
+		error( "don't know where you are, call mud.here first", 2 )
+	end
+
+	local commands = findPath( Here, to, avoid or 0 )
+	if not commands then
+		return false
+	end
+
+	if #commands > 0 then
+		mud.input( table.concat( commands, ";" ) )
+	end
+
+	return true
+end
+
+-- saves to maps/<name>.map
+function mud.saveMap( name )
+	local path = checkMapName( name )
+
+	if not lfs.attributes( MapsDir ) then
+		lfs.mkdir( MapsDir )
+	end
+
+	local ok, err = save( path )
+	if not ok then
+		error( "couldn't save map `%s': %s" % { path, err }, 2 )
+	end
+end
+
+-- replaces the map with maps/<name>.map, or leaves it alone and returns
+-- nil and an error if that doesn't work. returns how many rooms there are
+function mud.loadMap( name )
+	return load( checkMapName( name ) )
+end
+
+function mud.clearMap()
+	clear()
+	Here = nil
+end
+
+local function goTo( id )
+	if not Here then
+		mud.print( "\n#s> Don't know where you are" )
+	elseif not mud.go( id ) then
+		mud.print( "\n#s> Don't know how to get to %d", id )
+	end
+end
+
+mud.alias( "/go", function( name )
+	if name == "" then
+		mud.print( "\nsyntax: /go <room id or name>" )
+		return
+	end
+
+	if name:match( "^%d+$" ) then
+		goTo( tonumber( name ) )
+		return
+	end
+
+	local ids = mud.findRooms( name )
+
+	-- prefer rooms called exactly that over rooms that contain it
+	local exact = { }
+	for _, id in ipairs( ids ) do
+		if getRoom( id ).name:lower() == name:lower() then
+			table.insert( exact, id )
+		end
+	end
+
+	if #exact > 0 then
+		ids = exact
+	end
+
+	if #ids == 0 then
+		mud.print( "\n#s> No rooms called %s", name )
+	elseif #ids == 1 then
+		goTo( ids[ 1 ] )
+	else
+		mud.print( "\n#s> Which one?" )
+		for _, id in ipairs( ids ) do
+			mud.print( "\n#s>   %d: %s", id, getRoom( id ).name )
+		end
+	end
+end )
+
+return {
+	init = function( r, rr, e, g, f, p, s, l, c )
+		setRoom = r
+		removeRoom = rr
+		setExit = e
+		getRoom = g
+		findRooms = f
+		findPath = p
+		save = s
+		load = l
+		clear = c
+	end,
+}
@@ -1,4 +1,5 @@
-local DataHandler
+local LineHandler
+local EchoHandler
 local mud_socket
 
 local LastAddress
@@ -36,13 +37,11 @@ function mud.connect( address, port )
 
 	mud.print( "\n#s> Connecting to %s:%d...", address, port )
 
-	local sock, err = socket.connect( address, port, function( sock, data )
-		if data then
-			DataHandler( data )
-		else
-			mud.disconnect()
-		end
-	end )
+	local sock, err = socket.connectTelnet( address, port, {
+		line = LineHandler,
+		echo = EchoHandler,
+		close = mud.disconnect,
+	} )
 
 	if not sock then
 		mud.print( "\n#s> Connection failed: %s", err )
@@ -77,7 +76,8 @@ mud.alias( "/dc", function()
 end )
 
 return {
-	init = function( dataHandler )
-		DataHandler = dataHandler
+	init = function( lineHandler, echoHandler )
+		LineHandler = lineHandler
+		EchoHandler = echoHandler
 	end,
 }
@@ -1,8 +1,9 @@
 local socket_api
 local data_callbacks = { }
+local telnet_handlers = { }
 
 local function connect( addr, port, cb )
-	local sock, err = socket_api.connect( addr, port )
+	local sock, err = socket_api.connect( addr, port, false )
 	if not sock then
 		return nil, err
 	end
@@ -10,27 +11,55 @@ local function connect( addr, port, cb )
 	return sock
 end
 
+-- telnet sockets get decoded natively, handlers has line( line, prompt ),
+-- echo( on ) and close() callbacks. line is a native line object that's only
+-- valid during the callback
+local function connectTelnet( addr, port, handlers )
+	local sock, err = socket_api.connect( addr, port, true )
+	if not sock then
+		return nil, err
+	end
+	telnet_handlers[ sock ] = handlers
+	return sock
+end
+
 local function close( sock )
 	socket_api.close( sock )
 	data_callbacks[ sock ] = nil
+	telnet_handlers[ sock ] = nil
 end
 
 local function on_socket_data( sock, data )
 	-- data could be like { type = "data/failed/close/etc", data = ... }
 	-- need a failed to handle async connect
+	if telnet_handlers[ sock ] then
+		-- telnet sockets only get raw data when they close
+		telnet_handlers[ sock ].close()
+		return
+	end
+
 	data_callbacks[ sock ]( sock, data )
 end
 
+local function on_socket_line( sock, line, prompt )
+	telnet_handlers[ sock ].line( line, prompt )
+end
+
+local function on_socket_echo( sock, echo )
+	telnet_handlers[ sock ].echo( echo )
+end
+
 return {
 	init = function( api )
 		socket_api = api
 
 		socket = {
 			connect = connect,
+			connectTelnet = connectTelnet,
 			send = socket_api.send,
 			close = close,
 		}
 
-		return on_socket_data
+		return on_socket_data, on_socket_line, on_socket_echo
 	end,
 }
@@ -1,45 +1,34 @@
-local Subs = { }
+local trigger = require( "trigger" )
 
-local function doSubs( line )
-	for i = 1, #Subs do
-		local sub = Subs[ i ]
+local Subs = trigger.newSet( false )
 
-		if sub.enabled then
-			local ok, newLine, subs = pcall( string.gsub, line, sub.pattern, sub.replacement )
+-- subs rewrite the line natively and stack, so every live sub gets a go.
+-- patterns that mention escape codes see the line with its escape codes
+-- like they used to
+local function trySub( sub, line )
+	local apply = sub.raw and line.gsubRaw or line.gsub
+	local ok, err = pcall( apply, line, sub.pattern, sub.replacement )
 
-			if not ok then
-				mud.print( "\n#s> sub failed: %s\n%s\n%s", newLine, sub.pattern, sub.replacement )
-				return line
-			end
-
-			if subs ~= 0 then
-				return newLine
-			end
-		end
+	if not ok then
+		mud.print( "\n#s> sub failed: %s\n%s\n%s", err, sub.pattern, tostring( sub.replacement ) )
 	end
 
-	return line
+	return false
+end
+
+local function doSubs( line, prompt )
+	trigger.dispatch( Subs, line, prompt, trySub )
 end
 
-function mud.sub( pattern, replacement, disabled )
+function mud.sub( pattern, replacement, opts )
 	enforce( pattern, "pattern", "string" )
-	enforce( replacement, "replacement", "string", "function" )
+	enforce( replacement, "replacement", "string", "function", "table" )
 
-	local sub = {
+	local sub = trigger.add( Subs, {
 		pattern = pattern,
 		replacement = replacement,
-
-		enabled = not disabled,
-
-		enable = function( self )
-			self.enabled = true
-		end,
-		disable = function( self )
-			self.enabled = false
-		end,
-	}
-
-	table.insert( Subs, sub )
+		raw = pattern:find( "\27", 1, true ) ~= nil,
+	}, opts )
 
 	return sub
 end
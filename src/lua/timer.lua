@@ -0,0 +1,104 @@
+local addTimer
+local cancelTimer
+
+local Timers = { }
+
+local function resume( co, ... )
+	local ok, err = coroutine.resume( co, ... )
+	if not ok then
+		mud.print( "\n#s> coroutine failed: %s", debug.traceback( co, err ) )
+	end
+end
+
+local function currentCoroutine( name )
+	local co, main = coroutine.running()
+	if not co or main then
+		error( "%s must be called from a coroutine, see mud.spawn" % name, 3 )
+	end
+
+	return co
+end
+
+local function add( deadline, target )
+	local id = addTimer( deadline )
+	Timers[ id ] = target
+
+	return id
+end
+
+local function cancel( id )
+	cancelTimer( id )
+	Timers[ id ] = nil
+end
+
+local function fire( id, now )
+	local target = Timers[ id ]
+	if not target then
+		return
+	end
+
+	Timers[ id ] = nil
+
+	if type( target ) == "thread" then
+		resume( target, now )
+	else
+		local ok, err = xpcall( target, debug.traceback, now )
+		if not ok then
+			mud.print( "\n#s> timer callback failed: %s", err )
+		end
+	end
+end
+
+local function cancelAfter( self )
+	if self.id then
+		cancel( self.id )
+		self.id = nil
+	end
+end
+
+function mud.after( seconds, callback )
+	enforce( seconds, "seconds", "number" )
+	enforce( callback, "callback", "function" )
+
+	local after = {
+		cancel = cancelAfter,
+	}
+
+	after.id = add( mud.now() + seconds, function( now )
+		after.id = nil
+		callback( now )
+	end )
+
+	return after
+end
+
+function mud.sleep( seconds )
+	enforce( seconds, "seconds", "number" )
+
+	add( mud.now() + seconds, currentCoroutine( "mud.sleep" ) )
+
+	return coroutine.yield()
+end
+
+function mud.spawn( callback, ... )
+	enforce( callback, "callback", "function" )
+
+	local co = coroutine.create( callback )
+	resume( co, ... )
+
+	return co
+end
+
+return {
+	init = function( add, cancel )
+		addTimer = add
+		cancelTimer = cancel
+	end,
+
+	add = add,
+	cancel = cancel,
+	fire = fire,
+
+	resume = resume,
+	currentCoroutine = currentCoroutine,
+}
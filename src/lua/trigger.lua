@@ -0,0 +1,301 @@
+-- each set keeps a list of its live triggers for each kind of line, so a
+-- prompt only gets checked against enabled triggers that want prompts.
+-- every trigger has a sequence number and the lists are kept in that order,
+-- so scoping doesn't change the order callbacks run in
+--
+-- groups keep a list of their members. enabling or disabling a trigger or
+-- a group splices it into or out of the lists, so the per-line cost only
+-- depends on how many triggers are enabled
+
+local Scopes = {
+	any = true,
+	prompt = true,
+	line = true,
+	chat = true,
+}
+
+local Groups = { }
+
+local nextSeq = 1
+
+local function live( trigger )
+	return not trigger.removed and trigger.enabled and ( not trigger.group or trigger.group.enabled )
+end
+
+local function applies( trigger, kind )
+	return trigger.scope == "any" or trigger.scope == kind
+end
+
+local function bySeq( a, b )
+	return a.seq < b.seq
+end
+
+-- makes new lists rather than editing the old ones, dispatch might be
+-- walking them
+local function splice( set, changed )
+	local added = { }
+	local removed = { }
+
+	for _, trigger in ipairs( changed ) do
+		local now = live( trigger )
+		if now ~= trigger.listed then
+			trigger.listed = now
+			if now then
+				table.insert( added, trigger )
+			else
+				removed[ trigger ] = true
+			end
+		end
+	end
+
+	if #added == 0 and next( removed ) == nil then
+		return
+	end
+
+	table.sort( added, bySeq )
+
+	local lists = { }
+	for kind, old in pairs( set.live ) do
+		local merged = { }
+		local j = 1
+
+		for i = 1, #old do
+			local trigger = old[ i ]
+			if not removed[ trigger ] then
+				while j <= #added and added[ j ].seq < trigger.seq do
+					if applies( added[ j ], kind ) then
+						table.insert( merged, added[ j ] )
+					end
+					j = j + 1
+				end
+				table.insert( merged, trigger )
+			end
+		end
+
+		for k = j, #added do
+			if applies( added[ k ], kind ) then
+				table.insert( merged, added[ k ] )
+			end
+		end
+
+		lists[ kind ] = merged
+	end
+
+	set.live = lists
+end
+
+local function setEnabled( self, enabled )
+	if self.enabled == enabled then
+		return
+	end
+
+	self.enabled = enabled
+
+	if not self.members then
+		splice( self.triggerSet, { self } )
+		return
+	end
+
+	local bySet = { }
+	for _, trigger in ipairs( self.members ) do
+		local set = trigger.triggerSet
+		bySet[ set ] = bySet[ set ] or { }
+		table.insert( bySet[ set ], trigger )
+	end
+
+	for set, changed in pairs( bySet ) do
+		splice( set, changed )
+	end
+end
+
+local function enable( self )
+	setEnabled( self, true )
+end
+
+local function disable( self )
+	setEnabled( self, false )
+end
+
+function mud.group( name )
+	enforce( name, "name", "string" )
+
+	local group = Groups[ name ]
+
+	if not group then
+		group = {
+			name = name,
+			enabled = true,
+			members = { },
+
+			enable = enable,
+			disable = disable,
+			set = setEnabled,
+		}
+
+		Groups[ name ] = group
+	end
+
+	return group
+end
+
+-- chat triggers are all scoped to any. scope = "chat" on a mud set puts
+-- the trigger in its chat sibling
+local function newSet( raw, chatSet )
+	return {
+		raw = raw,
+		chatSet = chatSet,
+
+		live = {
+			prompt = { },
+			line = { },
+		},
+	}
+end
+
+local function newChatSet( raw )
+	local set = newSet( raw )
+	set.chat = true
+	return set
+end
+
+-- mud lines are native line objects and chat lines are strings
+local function find( line, pattern, raw, plain )
+	if type( line ) == "string" then
+		return line:find( pattern, 1, plain )
+	end
+
+	if raw then
+		return line:findRaw( pattern, 1, plain )
+	end
+
+	return line:find( pattern, 1, plain )
+end
+
+local function text( line, raw )
+	if type( line ) == "string" then
+		return line
+	end
+
+	return raw and line:raw() or line:text()
+end
+
+-- the last argument to mud.action and friends used to be a disabled flag,
+-- it can now also be a table of options:
+--
+--   disabled = true
+--   scope = "any" (default), "prompt", "line" (anything but prompts) or "chat"
+--   literal = plain text the line has to contain before we try the pattern
+--   group = name of a group from mud.group, we skip the trigger while the
+--           group is disabled
+local function add( set, trigger, opts )
+	-- report errors at whoever called mud.action
+	local level = 3
+
+	if type( opts ) ~= "table" then
+		opts = { disabled = opts }
+	end
+
+	local scope = opts.scope or "any"
+	if not Scopes[ scope ] then
+		error( "bad trigger scope `%s'" % tostring( scope ), level )
+	end
+
+	if opts.literal ~= nil and type( opts.literal ) ~= "string" then
+		error( "trigger literal should be a string", level )
+	end
+
+	if opts.group ~= nil and type( opts.group ) ~= "string" then
+		error( "trigger group should be a string", level )
+	end
+
+	if set.chat then
+		if scope ~= "any" and scope ~= "chat" then
+			error( "chat triggers can't be scoped to `%s'" % scope, level )
+		end
+
+		scope = "any"
+	elseif scope == "chat" then
+		if not set.chatSet then
+			error( "this kind of trigger can't be scoped to chat", level )
+		end
+
+		set = set.chatSet
+		scope = "any"
+	end
+
+	trigger.seq = nextSeq
+	trigger.triggerSet = set
+	trigger.scope = scope
+	trigger.literal = opts.literal
+	trigger.group = opts.group and mud.group( opts.group )
+	trigger.enabled = not opts.disabled
+	trigger.listed = false
+
+	trigger.enable = enable
+	trigger.disable = disable
+
+	nextSeq = nextSeq + 1
+
+	if trigger.group then
+		table.insert( trigger.group.members, trigger )
+	end
+
+	splice( set, { trigger } )
+
+	return trigger
+end
+
+-- takes the trigger out of its set for good
+local function remove( trigger )
+	if trigger.removed then
+		return
+	end
+
+	trigger.removed = true
+
+	if trigger.group then
+		local members = trigger.group.members
+		for i, member in ipairs( members ) do
+			if member == trigger then
+				table.remove( members, i )
+				break
+			end
+		end
+	end
+
+	splice( trigger.triggerSet, { trigger } )
+end
+
+-- calls callback( trigger, line ) for each live trigger that applies to
+-- the line, stopping early if it returns true. triggers added by callbacks
+-- wait for the next line
+local function dispatch( set, line, prompt, callback )
+	local kind = prompt and "prompt" or "line"
+	local triggers = set.live[ kind ]
+	local raw = set.raw
+
+	for i = 1, #triggers do
+		local trigger = triggers[ i ]
+
+		-- only re-check when something was toggled by an earlier callback
+		if set.live[ kind ] == triggers or live( trigger ) then
+			if not trigger.literal or find( line, trigger.literal, raw, true ) then
+				if callback( trigger, line ) then
+					return true
+				end
+			end
+		end
+	end
+
+	return false
+end
+
+return {
+	newSet = newSet,
+	newChatSet = newChatSet,
+	add = add,
+	remove = remove,
+	dispatch = dispatch,
+	find = find,
+	text = text,
+}
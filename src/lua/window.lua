@@ -0,0 +1,229 @@
+local trigger = require( "trigger" )
+
+local open, layout, close, printWindow, copyLine
+local gridOpen, gridSet, gridBlit, gridClear
+
+-- ids match WindowPosition in ui.h
+local Positions = {
+	top = 0,
+	bottom = 1,
+}
+
+local Windows = { }
+local Grids = { }
+
+local Routes = trigger.newSet( false )
+
+local Window = { }
+Window.__index = Window
+
+local Grid = { }
+Grid.__index = Grid
+
+local function checkOpen( window )
+	if not window.id then
+		error( "window `%s' has been closed" % window.name, 3 )
+	end
+end
+
+local function checkPosition( position, level )
+	enforce( position, "position", "string" )
+
+	if not Positions[ position ] then
+		error( "bad window position `%s'" % position, level + 1 )
+	end
+
+	return Positions[ position ]
+end
+
+local function checkOpts( opts )
+	local rows = opts.rows or 5
+	local position = opts.position or "top"
+	local scrollback = opts.scrollback or 1000
+
+	enforce( rows, "rows", "number" )
+	enforce( scrollback, "scrollback", "number" )
+
+	return rows, checkPosition( position, 3 ), scrollback
+end
+
+-- opens a window above or below the main window, or changes the layout of
+-- the one that's already open with that name. opts are all optional:
+--
+--   rows = 5
+--   position = "top" (under the chat window) or "bottom" (above the status bar)
+--   scrollback = 1000 lines, only used when the window first opens
+function mud.window( name, opts )
+	enforce( name, "name", "string" )
+	enforce( opts, "opts", "table", "nil" )
+
+	local rows, position, scrollback = checkOpts( opts or { } )
+
+	local window = Windows[ name ]
+	if window then
+		layout( window.id, rows, position )
+
+		return window
+	end
+
+	local id, err = open( rows, position, scrollback )
+	if not id then
+		error( err, 2 )
+	end
+
+	window = setmetatable( { name = name, id = id, routes = { } }, Window )
+	Windows[ name ] = window
+
+	return window
+end
+
+-- takes colour codes like mud.print
+function Window:print( form, ... )
+	checkOpen( self )
+
+	printWindow( self.id, form:format( ... ):parseColours() )
+end
+
+-- copies the line that's being handled here, colours and all
+function Window:copyLine()
+	checkOpen( self )
+
+	copyLine( self.id )
+end
+
+-- lines matching pattern go here instead of the main window, or as well as
+-- it if opts.copy is set. other opts are the same as mud.action's
+function Window:route( pattern, opts )
+	enforce( pattern, "pattern", "string" )
+	enforce( opts, "opts", "table", "boolean", "nil" )
+
+	local copy = type( opts ) == "table" and opts.copy
+
+	local route = trigger.add( Routes, { pattern = pattern, window = self, copy = copy }, opts )
+	table.insert( self.routes, route )
+
+	return route
+end
+
+-- also removes the window's routes
+function Window:close()
+	checkOpen( self )
+
+	for _, route in ipairs( self.routes ) do
+		trigger.remove( route )
+	end
+
+	close( self.id )
+	Windows[ self.name ] = nil
+	self.id = nil
+	self.routes = { }
+end
+
+-- opens a fixed block of character cells, for maps and the like, which
+-- only redraws the cells that change. calling it again with the same name
+-- moves it, or reopens it empty if the size changed. opts are optional:
+--
+--   cols = 40
+--   rows = 20
+--   position = "top" or "bottom", like mud.window
+function mud.grid( name, opts )
+	enforce( name, "name", "string" )
+	enforce( opts, "opts", "table", "nil" )
+
+	opts = opts or { }
+	local cols = opts.cols or 40
+	local rows = opts.rows or 20
+	enforce( cols, "cols", "number" )
+	enforce( rows, "rows", "number" )
+	local position = checkPosition( opts.position or "top", 2 )
+
+	local grid = Grids[ name ]
+	if grid then
+		if grid.cols == cols and grid.rows == rows then
+			layout( grid.id, rows, position )
+
+			return grid
+		end
+
+		grid:close()
+	end
+
+	local id, err = gridOpen( cols, rows, position )
+	if not id then
+		error( err, 2 )
+	end
+
+	grid = setmetatable( { name = name, id = id, cols = cols, rows = rows }, Grid )
+	Grids[ name ] = grid
+
+	return grid
+end
+
+-- x and y start from 1, ch is a one character string. fg is a colour
+-- number like mud.printMain takes
+function Grid:set( x, y, ch, fg, bold )
+	checkOpen( self )
+
+	gridSet( self.id, x, y, ch, fg, bold )
+end
+
+-- replaces everything with a table of strings, one per row. takes colour
+-- codes like mud.print. only cells that end up different get redrawn, so
+-- blitting a whole map every move is cheap
+function Grid:blit( rows )
+	checkOpen( self )
+	enforce( rows, "rows", "table" )
+
+	local parsed = { }
+	for i, row in ipairs( rows ) do
+		parsed[ i ] = row:parseColours()
+	end
+
+	gridBlit( self.id, parsed )
+end
+
+function Grid:clear()
+	checkOpen( self )
+
+	gridClear( self.id )
+end
+
+function Grid:close()
+	checkOpen( self )
+
+	close( self.id )
+	Grids[ self.name ] = nil
+	self.id = nil
+end
+
+-- returns true if the line was moved somewhere and shouldn't be shown in
+-- the main window
+local function doRoutes( line, prompt )
+	local moved = false
+
+	trigger.dispatch( Routes, line, prompt, function( route )
+		if trigger.find( line, route.pattern ) then
+			copyLine( route.window.id )
+			moved = moved or not route.copy
+		end
+	end )
+
+	return moved
+end
+
+return {
+	init = function( o, l, c, p, cl, go, gs, gb, gc )
+		open = o
+		layout = l
+		close = c
+		printWindow = p
+		copyLine = cl
+
+		gridOpen = go
+		gridSet = gs
+		gridBlit = gb
+		gridClear = gc
+	end,
+
+	doRoutes = doRoutes,
+}
@@ -0,0 +1,171 @@
+#include "common.h"
+#include "array.h"
+#include "lua_alloc.h"
+
+struct FreeBlock {
+	FreeBlock * next;
+};
+
+struct Pool {
+	FreeBlock * free_list;
+	u8 * cursor;
+	u8 * end;
+};
+
+static constexpr size_t SIZE_CLASSES[] = { 16, 32, 48, 64, 80, 96, 112, 128, 160, 192, 224, 256, 320, 384, 448, 512 };
+static constexpr size_t MAX_POOLED_SIZE = 512;
+static constexpr size_t CLASS_GRANULARITY = 16;
+static constexpr size_t SLAB_SIZE = 64 * 1024;
+static constexpr size_t LARGE = ARRAY_COUNT( SIZE_CLASSES );
+
+static Pool pools[ ARRAY_COUNT( SIZE_CLASSES ) ];
+static LuaAllocStats stats[ ARRAY_COUNT( SIZE_CLASSES ) + 1 ];
+static u8 class_lookup[ MAX_POOLED_SIZE / CLASS_GRANULARITY + 1 ];
+static DynamicArray< void * > slabs;
+static size_t live_bytes;
+static size_t peak_bytes;
+
+static size_t size_class( size_t size ) {
+	if( size > MAX_POOLED_SIZE )
+		return LARGE;
+	return class_lookup[ ( size + CLASS_GRANULARITY - 1 ) / CLASS_GRANULARITY ];
+}
+
+static size_t accounted_size( size_t cls, size_t size ) {
+	return cls == LARGE ? size : SIZE_CLASSES[ cls ];
+}
+
+static void track_alloc( size_t cls, size_t size ) {
+	size_t bytes = accounted_size( cls, size );
+	stats[ cls ].live_bytes += bytes;
+	stats[ cls ].peak_bytes = max( stats[ cls ].peak_bytes, stats[ cls ].live_bytes );
+	stats[ cls ].allocs++;
+	live_bytes += bytes;
+	peak_bytes = max( peak_bytes, live_bytes );
+}
+
+static void track_free( size_t cls, size_t size ) {
+	size_t bytes = accounted_size( cls, size );
+	stats[ cls ].live_bytes -= bytes;
+	live_bytes -= bytes;
+}
+
+static void * pool_alloc( size_t cls ) {
+	Pool * pool = &pools[ cls ];
+
+	if( pool->free_list != NULL ) {
+		FreeBlock * block = pool->free_list;
+		pool->free_list = block->next;
+		return block;
+	}
+
+	size_t block_size = SIZE_CLASSES[ cls ];
+	if( size_t( pool->end - pool->cursor ) < block_size ) {
+		u8 * slab = alloc_many< u8 >( SLAB_SIZE );
+		slabs.add( slab );
+		pool->cursor = slab;
+		pool->end = slab + SLAB_SIZE - SLAB_SIZE % block_size;
+	}
+
+	void * block = pool->cursor;
+	pool->cursor += block_size;
+	return block;
+}
+
+static void pool_free( size_t cls, void * ptr ) {
+	FreeBlock * block = ( FreeBlock * ) ptr;
+	block->next = pools[ cls ].free_list;
+	pools[ cls ].free_list = block;
+}
+
+void * lua_pool_alloc( void * ud, void * ptr, size_t osize, size_t nsize ) {
+	// when ptr is NULL osize is the type of object being allocated
+	size_t old_cls = ptr == NULL ? LARGE : size_class( osize );
+
+	if( nsize == 0 ) {
+		if( ptr != NULL ) {
+			track_free( old_cls, osize );
+			if( old_cls == LARGE )
+				free( ptr );
+			else
+				pool_free( old_cls, ptr );
+		}
+		return NULL;
+	}
+
+	size_t new_cls = size_class( nsize );
+
+	if( ptr == NULL ) {
+		track_alloc( new_cls, nsize );
+		return new_cls == LARGE ? alloc_size( nsize ) : pool_alloc( new_cls );
+	}
+
+	if( old_cls == LARGE && new_cls == LARGE ) {
+		track_free( old_cls, osize );
+		track_alloc( new_cls, nsize );
+		void * res = realloc( ptr, nsize );
+		if( res == NULL )
+			FATAL( "realloc" );
+		return res;
+	}
+
+	if( old_cls == new_cls ) {
+		return ptr;
+	}
+
+	void * res = new_cls == LARGE ? alloc_size( nsize ) : pool_alloc( new_cls );
+	memcpy( res, ptr, min( osize, nsize ) );
+	track_alloc( new_cls, nsize );
+
+	track_free( old_cls, osize );
+	if( old_cls == LARGE )
+		free( ptr );
+	else
+		pool_free( old_cls, ptr );
+
+	return res;
+}
+
+Span< const LuaAllocStats > lua_alloc_stats() {
+	return Span< const LuaAllocStats >( stats, ARRAY_COUNT( stats ) );
+}
+
+size_t lua_alloc_live_bytes() {
+	return live_bytes;
+}
+
+size_t lua_alloc_peak_bytes() {
+	return peak_bytes;
+}
+
+void lua_alloc_plot() {
+	TracyPlot( "Lua live bytes", int64_t( live_bytes ) );
+	TracyPlot( "Lua pooled bytes", int64_t( live_bytes - stats[ LARGE ].live_bytes ) );
+	TracyPlot( "Lua slab bytes", int64_t( slabs.size() * SLAB_SIZE ) );
+}
+
+void lua_alloc_init() {
+	size_t cls = 0;
+	for( size_t i = 0; i < ARRAY_COUNT( class_lookup ); i++ ) {
+		while( SIZE_CLASSES[ cls ] < i * CLASS_GRANULARITY )
+			cls++;
+		class_lookup[ i ] = checked_cast< u8 >( cls );
+	}
+
+	for( size_t i = 0; i < ARRAY_COUNT( SIZE_CLASSES ); i++ ) {
+		pools[ i ] = { };
+		stats[ i ] = { };
+		stats[ i ].block_size = SIZE_CLASSES[ i ];
+	}
+	stats[ LARGE ] = { };
+
+	live_bytes = 0;
+	peak_bytes = 0;
+}
+
+void lua_alloc_term() {
+	for( void * slab : slabs ) {
+		free( slab );
+	}
+	slabs.clear();
+}
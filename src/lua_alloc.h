@@ -0,0 +1,26 @@
+#pragma once
+
+#include "common.h"
+
+/*
+ * lua_Alloc that serves small blocks from per size class free lists carved
+ * out of big slabs, so the string/table churn from triggers doesn't hit
+ * malloc. anything bigger than the largest class goes to realloc
+ */
+
+struct LuaAllocStats {
+	size_t block_size; // 0 for the malloc fallback
+	size_t live_bytes;
+	size_t peak_bytes;
+	u64 allocs;
+};
+
+void * lua_pool_alloc( void * ud, void * ptr, size_t osize, size_t nsize );
+
+Span< const LuaAllocStats > lua_alloc_stats();
+size_t lua_alloc_live_bytes();
+size_t lua_alloc_peak_bytes();
+void lua_alloc_plot();
+
+void lua_alloc_init();
+void lua_alloc_term();
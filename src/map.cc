@@ -0,0 +1,1014 @@
+#include <ctype.h>
+#include <stdio.h>
+
+#include "common.h"
+#include "array.h"
+#include "map.h"
+#include "platform.h"
+
+#if PLATFORM_WINDOWS
+#include <windows.h>
+#endif
+
+#if COMPILER_MSVC
+#include <intrin.h>
+#endif
+
+static constexpr u32 NONE = UINT32_MAX;
+
+// keeps path costs plus heuristics below 2^32 so they fit in heap keys
+static constexpr u64 MAX_DIST = UINT32_MAX / 2;
+
+/*
+ * each room's exits sit next to each other in one big array, with some
+ * slack so adding an exit doesn't have to move everything after it. when a
+ * room runs out of slack its exits move to the end and leave a hole, and
+ * we compact when there are enough holes. searches walk nodes and exits,
+ * which are kept small, and the rest lives in rooms and exit_commands
+ */
+
+struct Node {
+	u32 first_exit;
+	u32 num_exits;
+	u32 cost;
+	u32 flags;
+};
+
+struct Room {
+	u32 id;
+	bool used;
+	bool has_coords;
+	u32 name_start;
+	u32 name_len;
+	u32 exit_capacity;
+	u32 num_entrances;
+};
+
+struct Exit {
+	u32 to;
+	u32 cost;
+};
+
+struct ExitCommand {
+	u32 start;
+	u32 len;
+};
+
+struct Coords {
+	int x, y, z;
+};
+
+static DynamicArray< Node > nodes;
+static DynamicArray< Room > rooms;
+static DynamicArray< Coords > coords;
+static DynamicArray< Exit > exits;
+static DynamicArray< ExitCommand > exit_commands;
+static size_t num_used_rooms;
+static size_t garbage_exits;
+
+// room names and exit commands. replaced strings get left behind until
+// there's enough garbage to be worth compacting
+static DynamicArray< char > text;
+static size_t garbage_text;
+
+static DynamicArray< Exit > compacted_exits;
+static DynamicArray< ExitCommand > compacted_exit_commands;
+static DynamicArray< char > compacted_text;
+
+// open addressing, room id -> index into rooms. rooms never leave the
+// table, removing one only marks it unused
+static DynamicArray< u32 > table;
+
+/*
+ * A* needs a heuristic that never overestimates, and MUD maps don't make
+ * that easy: coordinates are whatever the mapper drew, some exits are
+ * diagonal and some jump across the map. so we measure the longest step
+ * any exit takes, and if exits move at most k squares then a room n
+ * squares away is at least n / k exits away. exits cost at least 1, so
+ * that's a lower bound on the cost too. it's only used when every room
+ * has coordinates and no exit is free, otherwise we fall back to Dijkstra
+ *
+ * new exits only ever make the steps longer so we keep up with those as
+ * they come in. removing exits or moving rooms with exits into them means
+ * measuring everything again on the next search
+ */
+static size_t num_free_exits;
+static size_t num_rooms_without_coords;
+static bool steps_dirty;
+static u32 max_axis_step = 1;
+static u32 max_manhattan_step = 1;
+
+static Span< const char > text_span( u32 start, u32 len ) {
+	return Span< const char >( text.ptr() + start, len );
+}
+
+static Span< const char > command_span( u32 e ) {
+	return text_span( exit_commands[ e ].start, exit_commands[ e ].len );
+}
+
+static bool equal( Span< const char > a, Span< const char > b ) {
+	return a.n == b.n && ( a.n == 0 || memcmp( a.ptr, b.ptr, a.n ) == 0 );
+}
+
+static u32 add_text( Span< const char > str ) {
+	size_t start = text.extend( str.n );
+	if( str.n > 0 )
+		memcpy( text.ptr() + start, str.ptr, str.n );
+	return checked_cast< u32 >( start );
+}
+
+static u32 hash_id( u32 id ) {
+	u32 h = id;
+	h ^= h >> 16;
+	h *= 0x7feb352d;
+	h ^= h >> 15;
+	h *= 0x846ca68b;
+	h ^= h >> 16;
+	return h;
+}
+
+static u32 find_room( u32 id ) {
+	if( table.size() == 0 )
+		return NONE;
+
+	size_t mask = table.size() - 1;
+	for( size_t i = hash_id( id ) & mask; ; i = ( i + 1 ) & mask ) {
+		u32 idx = table[ i ];
+		if( idx == NONE || rooms[ idx ].id == id )
+			return idx;
+	}
+}
+
+static u32 find_used_room( u32 id ) {
+	u32 idx = find_room( id );
+	return idx != NONE && rooms[ idx ].used ? idx : NONE;
+}
+
+static void table_insert( u32 idx ) {
+	size_t mask = table.size() - 1;
+	size_t i = hash_id( rooms[ idx ].id ) & mask;
+	while( table[ i ] != NONE ) {
+		i = ( i + 1 ) & mask;
+	}
+	table[ i ] = idx;
+}
+
+// keeps the table at most half full
+static void reserve_table( size_t num_rooms ) {
+	if( num_rooms * 2 <= table.size() )
+		return;
+
+	size_t capacity = max( size_t( 1024 ), table.size() );
+	while( capacity < num_rooms * 2 )
+		capacity *= 2;
+
+	table.resize( capacity );
+	for( u32 & idx : table ) {
+		idx = NONE;
+	}
+	for( size_t i = 0; i < rooms.size(); i++ ) {
+		table_insert( u32( i ) );
+	}
+}
+
+static void compact_text() {
+	ZoneScoped;
+
+	compacted_text.clear();
+
+	auto keep = [&]( u32 * start, u32 len ) {
+		size_t new_start = compacted_text.extend( len );
+		if( len > 0 )
+			memcpy( compacted_text.ptr() + new_start, text.ptr() + *start, len );
+		*start = u32( new_start );
+	};
+
+	for( size_t i = 0; i < rooms.size(); i++ ) {
+		if( !rooms[ i ].used )
+			continue;
+
+		keep( &rooms[ i ].name_start, rooms[ i ].name_len );
+		for( u32 j = 0; j < nodes[ i ].num_exits; j++ ) {
+			ExitCommand * command = &exit_commands[ nodes[ i ].first_exit + j ];
+			keep( &command->start, command->len );
+		}
+	}
+
+	text.from_span( compacted_text.span() );
+	garbage_text = 0;
+}
+
+// also puts every room's exits back in room order, which is kinder to the
+// cache after lots of rooms have moved theirs
+static void compact_exits() {
+	ZoneScoped;
+
+	compacted_exits.clear();
+	compacted_exit_commands.clear();
+
+	for( size_t i = 0; i < rooms.size(); i++ ) {
+		Node * node = &nodes[ i ];
+		size_t start = compacted_exits.extend( node->num_exits );
+		compacted_exit_commands.extend( node->num_exits );
+
+		if( node->num_exits > 0 ) {
+			memcpy( compacted_exits.ptr() + start, exits.ptr() + node->first_exit, node->num_exits * sizeof( Exit ) );
+			memcpy( compacted_exit_commands.ptr() + start, exit_commands.ptr() + node->first_exit, node->num_exits * sizeof( ExitCommand ) );
+		}
+
+		node->first_exit = u32( start );
+		rooms[ i ].exit_capacity = node->num_exits;
+	}
+
+	exits.from_span( compacted_exits.span() );
+	exit_commands.from_span( compacted_exit_commands.span() );
+	garbage_exits = 0;
+}
+
+static void collect_garbage() {
+	if( garbage_text > 65536 && garbage_text > text.size() / 2 )
+		compact_text();
+	if( garbage_exits > 4096 && garbage_exits > exits.size() / 2 )
+		compact_exits();
+}
+
+static u32 absdiff( int a, int b ) {
+	return a > b ? u32( a ) - u32( b ) : u32( b ) - u32( a );
+}
+
+static u32 ceil_div( u32 a, u32 b ) {
+	return a / b + ( a % b != 0 ? 1 : 0 );
+}
+
+static void measure_step( const Coords & from, const Coords & to ) {
+	u32 dx = absdiff( from.x, to.x );
+	u32 dy = absdiff( from.y, to.y );
+	u32 dz = absdiff( from.z, to.z );
+	max_axis_step = max( max_axis_step, max( dx, max( dy, dz ) ) );
+	max_manhattan_step = max( max_manhattan_step, u32( min( u64( dx ) + dy + dz, MAX_DIST ) ) );
+}
+
+static void measure_step( u32 from, u32 to ) {
+	if( rooms[ from ].has_coords && rooms[ to ].has_coords ) {
+		measure_step( coords[ from ], coords[ to ] );
+	}
+}
+
+// only called when every room has coordinates
+static void measure_steps() {
+	ZoneScoped;
+
+	max_axis_step = 1;
+	max_manhattan_step = 1;
+
+	for( size_t i = 0; i < rooms.size(); i++ ) {
+		for( u32 e = nodes[ i ].first_exit; e < nodes[ i ].first_exit + nodes[ i ].num_exits; e++ ) {
+			measure_step( coords[ i ], coords[ exits[ e ].to ] );
+		}
+	}
+
+	steps_dirty = false;
+}
+
+static u32 add_room( u32 id ) {
+	u32 idx = find_room( id );
+
+	if( idx == NONE ) {
+		reserve_table( rooms.size() + 1 );
+		idx = checked_cast< u32 >( rooms.extend( 1 ) );
+		nodes.extend( 1 );
+		coords.extend( 1 );
+		rooms[ idx ].id = id;
+		rooms[ idx ].used = false;
+		table_insert( idx );
+	}
+
+	if( !rooms[ idx ].used ) {
+		rooms[ idx ] = { };
+		rooms[ idx ].id = id;
+		rooms[ idx ].used = true;
+		nodes[ idx ] = { };
+		coords[ idx ] = { };
+		num_used_rooms++;
+		num_rooms_without_coords++;
+	}
+
+	return idx;
+}
+
+static void remove_exit( u32 idx, u32 e ) {
+	Node * node = &nodes[ idx ];
+	u32 last = node->first_exit + node->num_exits - 1;
+
+	if( exits[ e ].cost == 0 )
+		num_free_exits--;
+	rooms[ exits[ e ].to ].num_entrances--;
+	garbage_text += exit_commands[ e ].len;
+	steps_dirty = true;
+
+	exits[ e ] = exits[ last ];
+	exit_commands[ e ] = exit_commands[ last ];
+	node->num_exits--;
+}
+
+void map_clear() {
+	nodes.clear();
+	rooms.clear();
+	coords.clear();
+	exits.clear();
+	exit_commands.clear();
+	num_used_rooms = 0;
+	garbage_exits = 0;
+	text.clear();
+	garbage_text = 0;
+	table.clear();
+	num_free_exits = 0;
+	num_rooms_without_coords = 0;
+	steps_dirty = false;
+	max_axis_step = 1;
+	max_manhattan_step = 1;
+}
+
+void map_set_room( u32 id, Span< const char > name, u32 flags, u32 cost ) {
+	ASSERT( cost <= MAP_MAX_COST );
+
+	u32 idx = add_room( id );
+	Room * room = &rooms[ idx ];
+
+	if( !equal( name, text_span( room->name_start, room->name_len ) ) ) {
+		garbage_text += room->name_len;
+		room->name_start = add_text( name );
+		room->name_len = checked_cast< u32 >( name.n );
+	}
+
+	nodes[ idx ].flags = flags;
+	nodes[ idx ].cost = cost;
+
+	collect_garbage();
+}
+
+void map_set_coords( u32 id, int x, int y, int z ) {
+	u32 idx = add_room( id );
+
+	if( !rooms[ idx ].has_coords ) {
+		rooms[ idx ].has_coords = true;
+		num_rooms_without_coords--;
+	}
+
+	coords[ idx ].x = x;
+	coords[ idx ].y = y;
+	coords[ idx ].z = z;
+
+	if( rooms[ idx ].num_entrances > 0 ) {
+		steps_dirty = true;
+	}
+	else {
+		const Node & node = nodes[ idx ];
+		for( u32 e = node.first_exit; e < node.first_exit + node.num_exits; e++ ) {
+			measure_step( idx, exits[ e ].to );
+		}
+	}
+}
+
+void map_remove_room( u32 id ) {
+	u32 idx = find_used_room( id );
+	if( idx == NONE )
+		return;
+
+	for( size_t i = 0; i < rooms.size(); i++ ) {
+		u32 e = nodes[ i ].first_exit;
+		while( e < nodes[ i ].first_exit + nodes[ i ].num_exits ) {
+			if( exits[ e ].to == idx )
+				remove_exit( u32( i ), e );
+			else
+				e++;
+		}
+	}
+
+	while( nodes[ idx ].num_exits > 0 ) {
+		remove_exit( idx, nodes[ idx ].first_exit );
+	}
+
+	garbage_text += rooms[ idx ].name_len;
+	garbage_exits += rooms[ idx ].exit_capacity;
+	if( !rooms[ idx ].has_coords )
+		num_rooms_without_coords--;
+
+	rooms[ idx ] = { };
+	rooms[ idx ].id = id;
+	rooms[ idx ].used = false;
+	nodes[ idx ] = { };
+	num_used_rooms--;
+
+	collect_garbage();
+}
+
+void map_set_exit( u32 from, Span< const char > command, u32 to, u32 cost ) {
+	ASSERT( cost <= MAP_MAX_COST );
+
+	u32 from_idx = add_room( from );
+	u32 to_idx = add_room( to );
+
+	if( cost == 0 )
+		num_free_exits++;
+	rooms[ to_idx ].num_entrances++;
+	measure_step( from_idx, to_idx );
+
+	Node * node = &nodes[ from_idx ];
+	for( u32 e = node->first_exit; e < node->first_exit + node->num_exits; e++ ) {
+		if( equal( command, command_span( e ) ) ) {
+			if( exits[ e ].cost == 0 )
+				num_free_exits--;
+			rooms[ exits[ e ].to ].num_entrances--;
+			exits[ e ].to = to_idx;
+			exits[ e ].cost = cost;
+			return;
+		}
+	}
+
+	Room * room = &rooms[ from_idx ];
+	if( node->num_exits == room->exit_capacity ) {
+		u32 capacity = max( u32( 4 ), room->exit_capacity * 2 );
+		u32 start = checked_cast< u32 >( exits.extend( capacity ) );
+		exit_commands.extend( capacity );
+
+		if( node->num_exits > 0 ) {
+			memmove( exits.ptr() + start, exits.ptr() + node->first_exit, node->num_exits * sizeof( Exit ) );
+			memmove( exit_commands.ptr() + start, exit_commands.ptr() + node->first_exit, node->num_exits * sizeof( ExitCommand ) );
+		}
+
+		garbage_exits += room->exit_capacity;
+		node->first_exit = start;
+		room->exit_capacity = capacity;
+	}
+
+	u32 e = node->first_exit + node->num_exits;
+	node->num_exits++;
+
+	exits[ e ].to = to_idx;
+	exits[ e ].cost = cost;
+	exit_commands[ e ].start = add_text( command );
+	exit_commands[ e ].len = checked_cast< u32 >( command.n );
+
+	collect_garbage();
+}
+
+void map_remove_exit( u32 from, Span< const char > command ) {
+	u32 idx = find_used_room( from );
+	if( idx == NONE )
+		return;
+
+	const Node & node = nodes[ idx ];
+	for( u32 e = node.first_exit; e < node.first_exit + node.num_exits; e++ ) {
+		if( equal( command, command_span( e ) ) ) {
+			remove_exit( idx, e );
+			collect_garbage();
+			return;
+		}
+	}
+}
+
+bool map_get_room( u32 id, MapRoom * room, DynamicArray< MapExit > * room_exits ) {
+	u32 idx = find_used_room( id );
+	if( idx == NONE )
+		return false;
+
+	const Room & r = rooms[ idx ];
+	const Node & node = nodes[ idx ];
+	room->name = text_span( r.name_start, r.name_len );
+	room->flags = node.flags;
+	room->cost = node.cost;
+	room->has_coords = r.has_coords;
+	room->x = coords[ idx ].x;
+	room->y = coords[ idx ].y;
+	room->z = coords[ idx ].z;
+
+	room_exits->clear();
+	for( u32 e = node.first_exit; e < node.first_exit + node.num_exits; e++ ) {
+		MapExit exit;
+		exit.command = command_span( e );
+		exit.to = rooms[ exits[ e ].to ].id;
+		exit.cost = exits[ e ].cost;
+		room_exits->add( exit );
+	}
+
+	return true;
+}
+
+static bool contains_nocase( Span< const char > haystack, Span< const char > needle ) {
+	for( size_t i = 0; i + needle.n <= haystack.n; i++ ) {
+		size_t j = 0;
+		while( j < needle.n && tolower( u8( haystack[ i + j ] ) ) == tolower( u8( needle[ j ] ) ) ) {
+			j++;
+		}
+
+		if( j == needle.n )
+			return true;
+	}
+
+	return false;
+}
+
+void map_find( Span< const char > name, size_t max_results, DynamicArray< u32 > * ids ) {
+	ZoneScoped;
+
+	ids->clear();
+
+	for( const Room & room : rooms ) {
+		if( ids->size() == max_results )
+			break;
+
+		if( room.used && contains_nocase( text_span( room.name_start, room.name_len ), name ) ) {
+			ids->add( room.id );
+		}
+	}
+}
+
+/*
+ * radix heap. it's quicker than a binary heap but keys can never be less
+ * than the last one popped, which holds for Dijkstra and for A* with a
+ * consistent heuristic. items in bucket i differ from the last popped key
+ * first at bit i - 1
+ */
+
+struct HeapItem {
+	u32 key;
+	u32 room;
+};
+
+static DynamicArray< HeapItem > buckets[ 33 ];
+static size_t heap_size;
+static u32 heap_last;
+
+static size_t bucket_index( u32 key ) {
+	u32 diff = key ^ heap_last;
+	if( diff == 0 )
+		return 0;
+
+#if COMPILER_MSVC
+	unsigned long bit;
+	_BitScanReverse( &bit, diff );
+	return bit + 1;
+#else
+	return 32 - __builtin_clz( diff );
+#endif
+}
+
+static void heap_push( u32 key, u32 room ) {
+	// can only happen with A* when the coordinates are off
+	key = max( key, heap_last );
+
+	HeapItem item = { key, room };
+	buckets[ bucket_index( key ) ].add( item );
+	heap_size++;
+}
+
+static HeapItem heap_pop() {
+	if( buckets[ 0 ].size() == 0 ) {
+		size_t i = 1;
+		while( buckets[ i ].size() == 0 ) {
+			i++;
+		}
+
+		u32 smallest = UINT32_MAX;
+		for( HeapItem item : buckets[ i ] ) {
+			smallest = min( smallest, item.key );
+		}
+
+		heap_last = smallest;
+		for( HeapItem item : buckets[ i ] ) {
+			buckets[ bucket_index( item.key ) ].add( item );
+		}
+		buckets[ i ].clear();
+	}
+
+	heap_size--;
+	HeapItem item = buckets[ 0 ].top();
+	buckets[ 0 ].resize( buckets[ 0 ].size() - 1 );
+	return item;
+}
+
+static void heap_clear() {
+	for( DynamicArray< HeapItem > & bucket : buckets ) {
+		bucket.clear();
+	}
+	heap_size = 0;
+	heap_last = 0;
+}
+
+// seen == generation means the rest is valid for this search, which saves
+// clearing everything each time
+struct SearchRoom {
+	u32 seen;
+	u32 dist;
+	u32 parent;
+	u32 via;
+};
+
+static DynamicArray< SearchRoom > search;
+static u32 generation;
+
+static u32 heuristic( const Coords & a, const Coords & b ) {
+	u32 dx = absdiff( a.x, b.x );
+	u32 dy = absdiff( a.y, b.y );
+	u32 dz = absdiff( a.z, b.z );
+	u32 by_axis = ceil_div( max( dx, max( dy, dz ) ), max_axis_step );
+	u32 by_manhattan = u32( ( u64( dx ) + dy + dz + max_manhattan_step - 1 ) / max_manhattan_step );
+	return u32( min( u64( max( by_axis, by_manhattan ) ), MAX_DIST ) );
+}
+
+bool map_path( u32 from, u32 to, u32 avoid_flags, DynamicArray< Span< const char > > * commands, u32 * cost ) {
+	ZoneScoped;
+
+	commands->clear();
+
+	u32 start = find_used_room( from );
+	u32 goal = find_used_room( to );
+	if( start == NONE || goal == NONE )
+		return false;
+
+	if( search.size() < rooms.size() ) {
+		size_t old_size = search.size();
+		search.resize( rooms.size() );
+		memset( search.ptr() + old_size, 0, ( rooms.size() - old_size ) * sizeof( SearchRoom ) );
+	}
+
+	generation++;
+	if( generation == 0 ) {
+		memset( search.ptr(), 0, search.num_bytes() );
+		generation = 1;
+	}
+
+	bool astar = num_free_exits == 0 && num_rooms_without_coords == 0;
+	if( astar && steps_dirty )
+		measure_steps();
+
+	const Node * n = nodes.ptr();
+	const Exit * x = exits.ptr();
+	const Coords * c = coords.ptr();
+	SearchRoom * s = search.ptr();
+	const Coords & target = c[ goal ];
+
+	heap_clear();
+	s[ start ].seen = generation;
+	s[ start ].dist = 0;
+	heap_push( astar ? heuristic( c[ start ], target ) : 0, start );
+
+	bool found = false;
+	while( heap_size > 0 ) {
+		HeapItem item = heap_pop();
+		u32 u = item.room;
+		if( u == goal ) {
+			found = true;
+			break;
+		}
+
+		// skip rooms we already found a shorter way to
+		u32 g = s[ u ].dist;
+		if( item.key != max( g + ( astar ? heuristic( c[ u ], target ) : 0 ), heap_last ) )
+			continue;
+
+		u32 end = n[ u ].first_exit + n[ u ].num_exits;
+		for( u32 e = n[ u ].first_exit; e < end; e++ ) {
+			u32 v = x[ e ].to;
+			if( avoid_flags != 0 && v != goal && ( n[ v ].flags & avoid_flags ) != 0 )
+				continue;
+
+			u64 new_dist = u64( g ) + x[ e ].cost + n[ v ].cost;
+			if( new_dist >= MAX_DIST )
+				continue;
+			if( s[ v ].seen == generation && s[ v ].dist <= new_dist )
+				continue;
+
+			s[ v ].seen = generation;
+			s[ v ].dist = u32( new_dist );
+			s[ v ].parent = u;
+			s[ v ].via = e;
+			heap_push( u32( new_dist ) + ( astar ? heuristic( c[ v ], target ) : 0 ), v );
+		}
+	}
+
+	if( !found )
+		return false;
+
+	*cost = s[ goal ].dist;
+
+	for( u32 v = goal; v != start; v = s[ v ].parent ) {
+		commands->add( command_span( s[ v ].via ) );
+	}
+
+	for( size_t i = 0; i < commands->size() / 2; i++ ) {
+		swap( ( *commands )[ i ], ( *commands )[ commands->size() - i - 1 ] );
+	}
+
+	return true;
+}
+
+size_t map_num_rooms() {
+	return num_used_rooms;
+}
+
+/*
+ * map files are MAP_MAGIC then varints, zigzagged where they can be
+ * negative:
+ *
+ *   num_rooms, then for each room:
+ *     id, flags, cost, has_coords, [ x, y, z ], name_len, name,
+ *     num_exits, then for each exit:
+ *       to, cost, command_len, command
+ *
+ * exits point at rooms by their position in the file. everything gets
+ * written to a temporary file first so a crash can't leave half a map
+ */
+
+static const char MAP_MAGIC[ 8 ] = { 'M', 'G', 'M', 'A', 'P', 0, 0, 1 };
+
+static void write_varint( DynamicArray< u8 > * out, u64 x ) {
+	while( x >= 0x80 ) {
+		out->add( u8( x ) | 0x80 );
+		x >>= 7;
+	}
+	out->add( u8( x ) );
+}
+
+static void write_string( DynamicArray< u8 > * out, Span< const char > str ) {
+	write_varint( out, str.n );
+	size_t idx = out->extend( str.n );
+	if( str.n > 0 )
+		memcpy( out->ptr() + idx, str.ptr, str.n );
+}
+
+static u32 zigzag( int x ) {
+	return ( u32( x ) << 1 ) ^ u32( x >> 31 );
+}
+
+static int unzigzag( u32 x ) {
+	return int( x >> 1 ) ^ -int( x & 1 );
+}
+
+bool map_save( const char ** err, const char * path ) {
+	ZoneScoped;
+
+	DynamicArray< u8 > out;
+	DynamicArray< u32 > file_index;
+	file_index.resize( rooms.size() );
+
+	u32 num_rooms = 0;
+	for( size_t i = 0; i < rooms.size(); i++ ) {
+		file_index[ i ] = num_rooms;
+		if( rooms[ i ].used )
+			num_rooms++;
+	}
+
+	out.from_span( Span< const u8 >( ( const u8 * ) MAP_MAGIC, sizeof( MAP_MAGIC ) ) );
+	write_varint( &out, num_rooms );
+
+	for( size_t i = 0; i < rooms.size(); i++ ) {
+		const Room & room = rooms[ i ];
+		const Node & node = nodes[ i ];
+		if( !room.used )
+			continue;
+
+		write_varint( &out, room.id );
+		write_varint( &out, node.flags );
+		write_varint( &out, node.cost );
+		write_varint( &out, room.has_coords ? 1 : 0 );
+		if( room.has_coords ) {
+			write_varint( &out, zigzag( coords[ i ].x ) );
+			write_varint( &out, zigzag( coords[ i ].y ) );
+			write_varint( &out, zigzag( coords[ i ].z ) );
+		}
+		write_string( &out, text_span( room.name_start, room.name_len ) );
+
+		write_varint( &out, node.num_exits );
+		for( u32 e = node.first_exit; e < node.first_exit + node.num_exits; e++ ) {
+			write_varint( &out, file_index[ exits[ e ].to ] );
+			write_varint( &out, exits[ e ].cost );
+			write_string( &out, command_span( e ) );
+		}
+	}
+
+	char tmp_path[ 1024 ];
+	if( size_t( snprintf( tmp_path, sizeof( tmp_path ), "%s.tmp", path ) ) >= sizeof( tmp_path ) ) {
+		*err = "path is too long";
+		return false;
+	}
+
+	FILE * file = fopen( tmp_path, "wb" );
+	if( file == NULL ) {
+		*err = "couldn't open map file";
+		return false;
+	}
+
+	bool ok = fwrite( out.ptr(), 1, out.size(), file ) == out.size();
+	ok = fclose( file ) == 0 && ok;
+	if( !ok ) {
+		remove( tmp_path );
+		*err = "couldn't write map file";
+		return false;
+	}
+
+#if PLATFORM_WINDOWS
+	ok = MoveFileExA( tmp_path, path, MOVEFILE_REPLACE_EXISTING ) != 0;
+#else
+	ok = rename( tmp_path, path ) == 0;
+#endif
+
+	if( !ok ) {
+		remove( tmp_path );
+		*err = "couldn't replace map file";
+		return false;
+	}
+
+	return true;
+}
+
+struct Reader {
+	const u8 * p;
+	const u8 * end;
+	bool ok;
+};
+
+static u64 read_varint( Reader * r ) {
+	u64 x = 0;
+	for( int shift = 0; shift < 64; shift += 7 ) {
+		if( r->p == r->end )
+			break;
+
+		u8 b = *r->p;
+		r->p++;
+		x |= u64( b & 0x7f ) << shift;
+		if( ( b & 0x80 ) == 0 )
+			return x;
+	}
+
+	r->ok = false;
+	return 0;
+}
+
+static u32 read_u32( Reader * r, u64 max_value ) {
+	u64 x = read_varint( r );
+	if( x > max_value ) {
+		r->ok = false;
+		return 0;
+	}
+	return u32( x );
+}
+
+static Span< const char > read_string( Reader * r ) {
+	size_t len = read_u32( r, size_t( r->end - r->p ) );
+	Span< const char > str( ( const char * ) r->p, len );
+	r->p += len;
+	return str;
+}
+
+static bool has_duplicates( Span< const u32 > ids ) {
+	size_t capacity = 1;
+	while( capacity < ids.n * 2 )
+		capacity *= 2;
+
+	DynamicArray< u32 > seen;
+	seen.resize( capacity );
+	for( u32 & idx : seen ) {
+		idx = NONE;
+	}
+
+	size_t mask = capacity - 1;
+	for( size_t i = 0; i < ids.n; i++ ) {
+		size_t j = hash_id( ids[ i ] ) & mask;
+		while( seen[ j ] != NONE ) {
+			if( ids[ seen[ j ] ] == ids[ i ] )
+				return true;
+			j = ( j + 1 ) & mask;
+		}
+		seen[ j ] = u32( i );
+	}
+
+	return false;
+}
+
+// the first pass only checks the file is sane, so a bad file can't wipe
+// out the map we already have
+static bool decode_map( Reader r, bool store ) {
+	DynamicArray< u32 > ids;
+	u32 num_rooms = read_u32( &r, UINT32_MAX - 1 );
+
+	if( store ) {
+		map_clear();
+		rooms.resize( num_rooms );
+		nodes.resize( num_rooms );
+		coords.resize( num_rooms );
+		reserve_table( num_rooms );
+	}
+
+	for( u32 i = 0; i < num_rooms && r.ok; i++ ) {
+		Room room = { };
+		Node node = { };
+		Coords room_coords = { };
+		room.used = true;
+		room.id = read_u32( &r, UINT32_MAX );
+		node.flags = read_u32( &r, UINT32_MAX );
+		node.cost = read_u32( &r, MAP_MAX_COST );
+		room.has_coords = read_u32( &r, 1 ) == 1;
+		if( room.has_coords ) {
+			room_coords.x = unzigzag( read_u32( &r, UINT32_MAX ) );
+			room_coords.y = unzigzag( read_u32( &r, UINT32_MAX ) );
+			room_coords.z = unzigzag( read_u32( &r, UINT32_MAX ) );
+		}
+		Span< const char > name = read_string( &r );
+		if( !store )
+			ids.add( room.id );
+
+		u32 num_exits = read_u32( &r, UINT32_MAX );
+		node.first_exit = u32( exits.size() );
+		node.num_exits = num_exits;
+		room.exit_capacity = num_exits;
+
+		for( u32 j = 0; j < num_exits && r.ok; j++ ) {
+			Exit exit;
+			exit.to = read_u32( &r, num_rooms - 1 );
+			exit.cost = read_u32( &r, MAP_MAX_COST );
+			Span< const char > command = read_string( &r );
+
+			if( store ) {
+				ExitCommand exit_command;
+				exit_command.start = add_text( command );
+				exit_command.len = u32( command.n );
+				exits.add( exit );
+				exit_commands.add( exit_command );
+
+				if( exit.cost == 0 )
+					num_free_exits++;
+			}
+		}
+
+		if( store ) {
+			room.name_start = add_text( name );
+			room.name_len = u32( name.n );
+			rooms[ i ] = room;
+			nodes[ i ] = node;
+			coords[ i ] = room_coords;
+			table_insert( i );
+
+			if( !room.has_coords )
+				num_rooms_without_coords++;
+		}
+	}
+
+	if( store ) {
+		num_used_rooms = num_rooms;
+		for( const Exit & exit : exits ) {
+			rooms[ exit.to ].num_entrances++;
+		}
+
+		// we don't know how far the loaded exits step
+		steps_dirty = true;
+	}
+
+	return r.ok && r.p == r.end && !has_duplicates( ids.span() );
+}
+
+bool map_load( const char ** err, const char * path ) {
+	ZoneScoped;
+
+	FILE * file = fopen( path, "rb" );
+	if( file == NULL ) {
+		*err = "couldn't open map file";
+		return false;
+	}
+
+	bool ok = fseek( file, 0, SEEK_END ) == 0;
+	long size = ok ? ftell( file ) : -1;
+	ok = ok && size >= 0 && fseek( file, 0, SEEK_SET ) == 0;
+
+	u8 * data = NULL;
+	if( ok ) {
+		data = alloc_many< u8 >( max( size_t( size ), size_t( 1 ) ) );
+		ok = fread( data, 1, size_t( size ), file ) == size_t( size );
+	}
+	fclose( file );
+
+	if( !ok ) {
+		free( data );
+		*err = "couldn't read map file";
+		return false;
+	}
+
+	bool valid = size_t( size ) >= sizeof( MAP_MAGIC ) && memcmp( data, MAP_MAGIC, sizeof( MAP_MAGIC ) ) == 0;
+
+	Reader reader;
+	reader.p = data + ( valid ? sizeof( MAP_MAGIC ) : 0 );
+	reader.end = data + size;
+	reader.ok = true;
+
+	if( !valid || !decode_map( reader, false ) ) {
+		free( data );
+		*err = "not a map file, or it's corrupt";
+		return false;
+	}
+
+	decode_map( reader, true );
+	free( data );
+
+	return true;
+}
@@ -0,0 +1,54 @@
+#pragma once
+
+#include "common.h"
+#include "array.h"
+
+/*
+ * the automapper's room graph. rooms are keyed by whatever ids the scripts
+ * like, e.g. vnums from GMCP or a hash of the room description, and exits
+ * are the commands that walk between them. rooms can carry flags, which
+ * paths can be told to avoid, and an extra cost for walking into them
+ *
+ * paths are always the cheapest. searches use A* when every room has
+ * coordinates and Dijkstra otherwise
+ */
+
+constexpr u32 MAP_MAX_COST = 65535;
+
+struct MapRoom {
+	Span< const char > name;
+	u32 flags;
+	u32 cost;
+	bool has_coords;
+	int x, y, z;
+};
+
+struct MapExit {
+	Span< const char > command;
+	u32 to;
+	u32 cost;
+};
+
+void map_clear();
+
+// creates the room if it doesn't exist
+void map_set_room( u32 id, Span< const char > name, u32 flags, u32 cost );
+void map_set_coords( u32 id, int x, int y, int z );
+void map_remove_room( u32 id );
+
+// replaces any exit from from with the same command, and creates either
+// room if it doesn't exist
+void map_set_exit( u32 from, Span< const char > command, u32 to, u32 cost );
+void map_remove_exit( u32 from, Span< const char > command );
+
+// spans point into the map and are only good until it changes
+bool map_get_room( u32 id, MapRoom * room, DynamicArray< MapExit > * exits );
+void map_find( Span< const char > name, size_t max_results, DynamicArray< u32 > * ids );
+// rooms with any of avoid_flags set are only walked into if they're the
+// destination
+bool map_path( u32 from, u32 to, u32 avoid_flags, DynamicArray< Span< const char > > * commands, u32 * cost );
+
+size_t map_num_rooms();
+
+bool map_save( const char ** err, const char * path );
+bool map_load( const char ** err, const char * path );
@@ -0,0 +1,391 @@
+#include <errno.h>
+#include <poll.h>
+#include <pthread.h>
+
+#include "common.h"
+#include "net_thread.h"
+#include "script.h"
+#include "spsc.h"
+#include "telnet.h"
+#include "wakeup.h"
+
+#include "platform_network.h"
+
+enum NetEventType : u8 {
+	NET_EVENT_DATA,
+	NET_EVENT_LINE,
+	NET_EVENT_PROMPT,
+	NET_EVENT_ECHO_ON,
+	NET_EVENT_ECHO_OFF,
+	NET_EVENT_CLOSED,
+	NET_EVENT_FREED,
+};
+
+enum NetCommandType : u8 {
+	NET_COMMAND_ADD,
+	NET_COMMAND_CLOSE,
+	NET_COMMAND_QUIT,
+};
+
+// followed by the payload, the ring frames it so we don't need a length
+struct NetEvent {
+	NetEventType type;
+	u8 socket;
+};
+
+struct NetCommand {
+	NetCommandType type;
+	u8 socket;
+};
+
+struct Socket {
+	TCPSocket sock;
+	bool telnet;
+
+	// only touched by the main thread
+	bool in_use;
+	bool closing;
+
+	// only touched by the net thread
+	bool polling;
+	TelnetDecoder decoder;
+};
+
+static Socket sockets[ 128 ];
+STATIC_ASSERT( ARRAY_COUNT( sockets ) <= UINT8_MAX );
+
+static constexpr size_t RECV_SIZE = 8192;
+
+static pthread_t thread;
+
+// net thread -> main thread
+static SPSCRing events( 1 << 22 );
+static Wakeup main_wakeup;
+
+// main thread -> net thread
+static SPSCRing commands( 1 << 13 );
+static Wakeup net_wakeup;
+
+// worst case ring usage from one recv. every byte can end an event, and
+// the decoder can be sitting on a full line from the last recv
+static size_t recv_budget() {
+	size_t per_event = SPSCRing::max_framed_size( sizeof( NetEvent ) );
+	size_t wrap = SPSCRing::max_framed_size( sizeof( NetEvent ) + TELNET_MAX_LINE_LENGTH );
+	return ( RECV_SIZE + 1 ) * per_event + RECV_SIZE + TELNET_MAX_LINE_LENGTH + wrap;
+}
+
+static void push_event( NetEventType type, size_t socket, const void * data, size_t len ) {
+	NetEvent header;
+	header.type = type;
+	header.socket = checked_cast< u8 >( socket );
+
+	// we checked for space before reading so this can't fail
+	u8 * p = ( u8 * ) events.reserve( sizeof( header ) + len );
+	ASSERT( p != NULL );
+
+	memcpy( p, &header, sizeof( header ) );
+	if( len > 0 )
+		memcpy( p + sizeof( header ), data, len );
+}
+
+static void on_telnet_event( void * user, TelnetEventType type, const char * data, size_t len ) {
+	size_t socket = *( size_t * ) user;
+
+	NetEventType event_type = NET_EVENT_LINE;
+	switch( type ) {
+		case TELNET_LINE: event_type = NET_EVENT_LINE; break;
+		case TELNET_PROMPT: event_type = NET_EVENT_PROMPT; break;
+		case TELNET_ECHO_ON: event_type = NET_EVENT_ECHO_ON; break;
+		case TELNET_ECHO_OFF: event_type = NET_EVENT_ECHO_OFF; break;
+	}
+
+	push_event( event_type, socket, data, len );
+}
+
+static bool run_commands() {
+	// leave commands in the ring if we have nowhere to put the FREED event,
+	// we get woken up again when the main thread makes some room
+	bool drained = false;
+	while( events.has_space( SPSCRing::max_framed_size( sizeof( NetEvent ) ) ) ) {
+		Span< const u8 > msg;
+		if( !commands.pop( &msg ) ) {
+			drained = true;
+			break;
+		}
+
+		NetCommand cmd;
+		ASSERT( msg.n == sizeof( cmd ) );
+		memcpy( &cmd, msg.ptr, sizeof( cmd ) );
+
+		Socket * sock = &sockets[ cmd.socket ];
+
+		switch( cmd.type ) {
+			case NET_COMMAND_ADD:
+				sock->polling = true;
+				telnet_init( &sock->decoder );
+				break;
+
+			case NET_COMMAND_CLOSE:
+				sock->polling = false;
+				net_destroy( &sock->sock );
+				push_event( NET_EVENT_FREED, cmd.socket, NULL, 0 );
+				break;
+
+			case NET_COMMAND_QUIT:
+				return false;
+		}
+	}
+
+	commands.release();
+
+	// anything committed between the last pop and the release saw head
+	// behind and didn't wake us up, so do it ourselves
+	if( drained && !commands.empty() )
+		wakeup_signal( &net_wakeup );
+
+	return true;
+}
+
+static void read_socket( size_t idx ) {
+	ZoneScoped;
+
+	Socket * sock = &sockets[ idx ];
+
+	char buf[ RECV_SIZE ];
+	size_t n;
+	TCPRecvResult res = net_recv( sock->sock, buf, sizeof( buf ), &n );
+
+	if( res != TCP_OK ) {
+		// stop polling but leave the fd open until the main thread closes it
+		sock->polling = false;
+		push_event( NET_EVENT_CLOSED, idx, NULL, 0 );
+		return;
+	}
+
+	if( sock->telnet ) {
+		telnet_decode( &sock->decoder, buf, n, on_telnet_event, &idx );
+	}
+	else {
+		push_event( NET_EVENT_DATA, idx, buf, n );
+	}
+}
+
+static void * net_thread_main( void * ) {
+	tracy::SetThreadName( "Network" );
+
+	while( true ) {
+		pollfd fds[ ARRAY_COUNT( sockets ) + 1 ] = { };
+		size_t fd_sockets[ ARRAY_COUNT( sockets ) + 1 ];
+		nfds_t num_fds = 1;
+
+		fds[ 0 ].fd = wakeup_fd( &net_wakeup );
+		fds[ 0 ].events = POLLIN;
+
+		// if the main thread is behind stop reading and let the kernel
+		// buffer fill up instead
+		if( events.has_space( recv_budget() ) ) {
+			for( size_t i = 0; i < ARRAY_COUNT( sockets ); i++ ) {
+				if( sockets[ i ].polling ) {
+					fds[ num_fds ].fd = sockets[ i ].sock.fd;
+					fds[ num_fds ].events = POLLIN;
+					fd_sockets[ num_fds ] = i;
+					num_fds++;
+				}
+			}
+		}
+
+		int ok = poll( fds, num_fds, -1 );
+		if( ok == -1 ) {
+			if( errno == EINTR )
+				continue;
+			FATAL( "poll" );
+		}
+
+		if( fds[ 0 ].revents & POLLIN ) {
+			wakeup_drain( &net_wakeup );
+			if( !run_commands() )
+				break;
+		}
+
+		for( nfds_t i = 1; i < num_fds; i++ ) {
+			// the socket might have been closed by a command above
+			size_t idx = fd_sockets[ i ];
+			if( ( fds[ i ].revents & ( POLLIN | POLLHUP | POLLERR ) ) && sockets[ idx ].polling ) {
+				if( !events.has_space( recv_budget() ) )
+					break;
+				read_socket( idx );
+			}
+		}
+
+		if( events.commit() )
+			wakeup_signal( &main_wakeup );
+	}
+
+	return NULL;
+}
+
+static void send_command( NetCommandType type, size_t socket ) {
+	NetCommand cmd;
+	cmd.type = type;
+	cmd.socket = checked_cast< u8 >( socket );
+
+	// at most one ADD and one CLOSE per socket can be in flight so this
+	// never fills up
+	if( !commands.push( &cmd, sizeof( cmd ) ) )
+		FATAL( "net command ring is full" );
+
+	if( commands.commit() )
+		wakeup_signal( &net_wakeup );
+}
+
+void * net_thread_connect( const char ** err, const char * host, int port, bool telnet ) {
+	size_t idx;
+	{
+		bool ok = false;
+		for( size_t i = 0; i < ARRAY_COUNT( sockets ); i++ ) {
+			if( !sockets[ i ].in_use ) {
+				idx = i;
+				ok = true;
+				break;
+			}
+		}
+
+		if( !ok ) {
+			*err = "too many connections";
+			return NULL;
+		}
+	}
+
+	NetAddress addr;
+	{
+		bool ok = dns_first( host, &addr );
+		if( !ok ) {
+			*err = "couldn't resolve hostname"; // TODO: error from dns_first
+			return NULL;
+		}
+	}
+	addr.port = checked_cast< u16 >( port );
+
+	TCPSocket sock;
+	bool ok = net_new_tcp( &sock, addr, err );
+	if( !ok )
+		return NULL;
+
+	sockets[ idx ].sock = sock;
+	sockets[ idx ].telnet = telnet;
+	sockets[ idx ].in_use = true;
+	sockets[ idx ].closing = false;
+
+	send_command( NET_COMMAND_ADD, idx );
+
+	return &sockets[ idx ];
+}
+
+void net_thread_send( void * vsock, const char * data, size_t len ) {
+	Socket * sock = ( Socket * ) vsock;
+	if( sock->closing )
+		return;
+
+	// the net thread only closes the fd after we ask it to so this is safe
+	net_send( sock->sock, data, len );
+}
+
+void net_thread_close( void * vsock ) {
+	Socket * sock = ( Socket * ) vsock;
+	if( sock->closing )
+		return;
+
+	sock->closing = true;
+	send_command( NET_COMMAND_CLOSE, sock - sockets );
+}
+
+int net_thread_wakeup_fd() {
+	return wakeup_fd( &main_wakeup );
+}
+
+void net_thread_dispatch() {
+	ZoneScoped;
+
+	wakeup_drain( &main_wakeup );
+
+	Span< const u8 > msg;
+	while( events.pop( &msg ) ) {
+		ArenaScope packet( &frame_arena );
+
+		NetEvent header;
+		memcpy( &header, msg.ptr, sizeof( header ) );
+		const char * data = ( const char * ) msg.ptr + sizeof( header );
+		size_t len = msg.n - sizeof( header );
+
+		Socket * sock = &sockets[ header.socket ];
+
+		if( header.type == NET_EVENT_FREED ) {
+			sock->in_use = false;
+			sock->closing = false;
+			continue;
+		}
+
+		// drop anything that arrived after the scripts closed the socket
+		if( sock->closing )
+			continue;
+
+		switch( header.type ) {
+			case NET_EVENT_DATA:
+				script_socketData( sock, data, len );
+				break;
+
+			case NET_EVENT_LINE:
+				script_socketLine( sock, data, len, false );
+				break;
+
+			case NET_EVENT_PROMPT:
+				script_socketLine( sock, data, len, true );
+				break;
+
+			case NET_EVENT_ECHO_ON:
+				script_socketEcho( sock, true );
+				break;
+
+			case NET_EVENT_ECHO_OFF:
+				script_socketEcho( sock, false );
+				break;
+
+			case NET_EVENT_CLOSED:
+				script_socketData( sock, NULL, 0 );
+				break;
+
+			case NET_EVENT_FREED:
+				break;
+		}
+	}
+
+	if( events.release() )
+		wakeup_signal( &net_wakeup );
+
+	// anything that was committed while we were dispatching didn't wake us
+	// up, so go round the main loop again rather than starving the UI
+	if( !events.empty() )
+		wakeup_signal( &main_wakeup );
+}
+
+void net_thread_init() {
+	for( Socket & s : sockets ) {
+		s.in_use = false;
+		s.closing = false;
+		s.polling = false;
+	}
+
+	wakeup_init( &main_wakeup );
+	wakeup_init( &net_wakeup );
+
+	if( pthread_create( &thread, NULL, net_thread_main, NULL ) != 0 )
+		FATAL( "pthread_create" );
+}
+
+void net_thread_term() {
+	send_command( NET_COMMAND_QUIT, 0 );
+	pthread_join( thread, NULL );
+
+	wakeup_term( &main_wakeup );
+	wakeup_term( &net_wakeup );
+}
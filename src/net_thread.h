@@ -0,0 +1,22 @@
+#pragma once
+
+#include "common.h"
+
+/*
+ * sockets are owned by a dedicated thread that does the recv and telnet
+ * decoding, so a slow redraw or script can't stop us from draining the
+ * socket. decoded lines are handed to the main thread in batches over a
+ * lock-free ring, and it polls net_thread_wakeup_fd and calls
+ * net_thread_dispatch to run them through the scripts. connect and send
+ * still happen on the main thread
+ */
+
+void * net_thread_connect( const char ** err, const char * host, int port, bool telnet );
+void net_thread_send( void * sock, const char * data, size_t len );
+void net_thread_close( void * sock );
+
+int net_thread_wakeup_fd();
+void net_thread_dispatch();
+
+void net_thread_init();
+void net_thread_term();
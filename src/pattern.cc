@@ -0,0 +1,432 @@
+#include <ctype.h>
+
+#include "common.h"
+#include "pattern.h"
+
+/*
+ * this is lstrlib.c's matcher with luaL_error swapped for an error string,
+ * and bounds checks where it relied on the subject being \0 terminated
+ */
+
+static constexpr char ESCAPE = '%';
+static constexpr ptrdiff_t CAPTURE_UNFINISHED = -1;
+static constexpr int MAX_RECURSION = 200;
+
+struct MatchState {
+	const char * src_init;
+	const char * src_end;
+	const char * p_end;
+	int depth;
+	int level;
+	const char * err;
+	PatternCapture captures[ PATTERN_MAX_CAPTURES ];
+};
+
+static const char * match( MatchState * ms, const char * s, const char * p );
+
+static const char * fail( MatchState * ms, const char * err ) {
+	if( ms->err == NULL )
+		ms->err = err;
+	return NULL;
+}
+
+static int check_capture( MatchState * ms, int l ) {
+	l -= '1';
+	if( l < 0 || l >= ms->level || ms->captures[ l ].len == CAPTURE_UNFINISHED ) {
+		fail( ms, "invalid capture index" );
+		return -1;
+	}
+	return l;
+}
+
+static int capture_to_close( MatchState * ms ) {
+	for( int level = ms->level - 1; level >= 0; level-- ) {
+		if( ms->captures[ level ].len == CAPTURE_UNFINISHED )
+			return level;
+	}
+	fail( ms, "invalid pattern capture" );
+	return -1;
+}
+
+static const char * class_end( MatchState * ms, const char * p ) {
+	switch( *p++ ) {
+		case ESCAPE:
+			if( p == ms->p_end ) {
+				fail( ms, "malformed pattern (ends with '%')" );
+				return ms->p_end;
+			}
+			return p + 1;
+
+		case '[':
+			if( *p == '^' )
+				p++;
+			do {
+				if( p == ms->p_end ) {
+					fail( ms, "malformed pattern (missing ']')" );
+					return ms->p_end;
+				}
+				if( *( p++ ) == ESCAPE && p < ms->p_end )
+					p++;
+			} while( *p != ']' );
+			return p + 1;
+
+		default:
+			return p;
+	}
+}
+
+static bool match_class( int c, int cl ) {
+	bool res;
+	switch( tolower( cl ) ) {
+		case 'a': res = isalpha( c ) != 0; break;
+		case 'c': res = iscntrl( c ) != 0; break;
+		case 'd': res = isdigit( c ) != 0; break;
+		case 'g': res = isgraph( c ) != 0; break;
+		case 'l': res = islower( c ) != 0; break;
+		case 'p': res = ispunct( c ) != 0; break;
+		case 's': res = isspace( c ) != 0; break;
+		case 'u': res = isupper( c ) != 0; break;
+		case 'w': res = isalnum( c ) != 0; break;
+		case 'x': res = isxdigit( c ) != 0; break;
+		case 'z': res = c == 0; break;
+		default: return cl == c;
+	}
+	return isupper( cl ) ? !res : res;
+}
+
+static bool match_bracket_class( int c, const char * p, const char * ec ) {
+	bool sig = true;
+	if( *( p + 1 ) == '^' ) {
+		sig = false;
+		p++;
+	}
+
+	while( ++p < ec ) {
+		if( *p == ESCAPE ) {
+			p++;
+			if( match_class( c, u8( *p ) ) )
+				return sig;
+		}
+		else if( *( p + 1 ) == '-' && p + 2 < ec ) {
+			p += 2;
+			if( u8( *( p - 2 ) ) <= c && c <= u8( *p ) )
+				return sig;
+		}
+		else if( u8( *p ) == c ) {
+			return sig;
+		}
+	}
+
+	return !sig;
+}
+
+static bool single_match( MatchState * ms, const char * s, const char * p, const char * ep ) {
+	if( s >= ms->src_end )
+		return false;
+
+	int c = u8( *s );
+	switch( *p ) {
+		case '.': return true;
+		case ESCAPE: return match_class( c, u8( *( p + 1 ) ) );
+		case '[': return match_bracket_class( c, p, ep - 1 );
+		default: return u8( *p ) == c;
+	}
+}
+
+static const char * match_balance( MatchState * ms, const char * s, const char * p ) {
+	if( p >= ms->p_end - 1 )
+		return fail( ms, "malformed pattern (missing arguments to '%b')" );
+
+	if( s >= ms->src_end || *s != *p )
+		return NULL;
+
+	char b = *p;
+	char e = *( p + 1 );
+	int cont = 1;
+	while( ++s < ms->src_end ) {
+		if( *s == e ) {
+			if( --cont == 0 )
+				return s + 1;
+		}
+		else if( *s == b ) {
+			cont++;
+		}
+	}
+
+	return NULL;
+}
+
+static const char * max_expand( MatchState * ms, const char * s, const char * p, const char * ep ) {
+	ptrdiff_t i = 0;
+	while( single_match( ms, s + i, p, ep ) )
+		i++;
+
+	while( i >= 0 ) {
+		const char * res = match( ms, s + i, ep + 1 );
+		if( res != NULL || ms->err != NULL )
+			return res;
+		i--;
+	}
+
+	return NULL;
+}
+
+static const char * min_expand( MatchState * ms, const char * s, const char * p, const char * ep ) {
+	while( true ) {
+		const char * res = match( ms, s, ep + 1 );
+		if( res != NULL || ms->err != NULL )
+			return res;
+		if( !single_match( ms, s, p, ep ) )
+			return NULL;
+		s++;
+	}
+}
+
+static const char * start_capture( MatchState * ms, const char * s, const char * p, ptrdiff_t what ) {
+	int level = ms->level;
+	if( level >= PATTERN_MAX_CAPTURES )
+		return fail( ms, "too many captures" );
+
+	ms->captures[ level ].init = s;
+	ms->captures[ level ].len = what;
+	ms->level = level + 1;
+
+	const char * res = match( ms, s, p );
+	if( res == NULL )
+		ms->level--;
+	return res;
+}
+
+static const char * end_capture( MatchState * ms, const char * s, const char * p ) {
+	int l = capture_to_close( ms );
+	if( l == -1 )
+		return NULL;
+
+	ms->captures[ l ].len = s - ms->captures[ l ].init;
+
+	const char * res = match( ms, s, p );
+	if( res == NULL )
+		ms->captures[ l ].len = CAPTURE_UNFINISHED;
+	return res;
+}
+
+static const char * match_capture( MatchState * ms, const char * s, int l ) {
+	l = check_capture( ms, l );
+	if( l == -1 )
+		return NULL;
+
+	size_t len = size_t( ms->captures[ l ].len );
+	if( size_t( ms->src_end - s ) >= len && memcmp( ms->captures[ l ].init, s, len ) == 0 )
+		return s + len;
+	return NULL;
+}
+
+static const char * match( MatchState * ms, const char * s, const char * p ) {
+	if( ms->err != NULL )
+		return NULL;
+	if( ms->depth-- == 0 )
+		return fail( ms, "pattern too complex" );
+
+	while( p != ms->p_end ) {
+		bool done = true;
+
+		switch( *p ) {
+			case '(':
+				if( *( p + 1 ) == ')' )
+					s = start_capture( ms, s, p + 2, PATTERN_CAPTURE_POSITION );
+				else
+					s = start_capture( ms, s, p + 1, CAPTURE_UNFINISHED );
+				break;
+
+			case ')':
+				s = end_capture( ms, s, p + 1 );
+				break;
+
+			case '$':
+				if( p + 1 != ms->p_end ) {
+					done = false;
+					break;
+				}
+				s = s == ms->src_end ? s : NULL;
+				break;
+
+			case ESCAPE:
+				switch( *( p + 1 ) ) {
+					case 'b':
+						s = match_balance( ms, s, p + 2 );
+						if( s != NULL ) {
+							p += 4;
+							continue;
+						}
+						break;
+
+					case 'f': {
+						p += 2;
+						if( *p != '[' ) {
+							s = fail( ms, "missing '[' after '%f' in pattern" );
+							break;
+						}
+
+						const char * ep = class_end( ms, p );
+						if( ms->err != NULL ) {
+							s = NULL;
+							break;
+						}
+
+						int previous = s == ms->src_init ? 0 : u8( *( s - 1 ) );
+						int current = s == ms->src_end ? 0 : u8( *s );
+						if( !match_bracket_class( previous, p, ep - 1 ) && match_bracket_class( current, p, ep - 1 ) ) {
+							p = ep;
+							continue;
+						}
+						s = NULL;
+					} break;
+
+					case '0': case '1': case '2': case '3': case '4':
+					case '5': case '6': case '7': case '8': case '9':
+						s = match_capture( ms, s, u8( *( p + 1 ) ) );
+						if( s != NULL ) {
+							p += 2;
+							continue;
+						}
+						break;
+
+					default:
+						done = false;
+						break;
+				}
+				break;
+
+			default:
+				done = false;
+				break;
+		}
+
+		if( done )
+			break;
+
+		// single char class with an optional repetition suffix
+		const char * ep = class_end( ms, p );
+		if( ms->err != NULL ) {
+			s = NULL;
+			break;
+		}
+
+		if( !single_match( ms, s, p, ep ) ) {
+			if( *ep == '*' || *ep == '?' || *ep == '-' ) {
+				p = ep + 1;
+				continue;
+			}
+			s = NULL;
+			break;
+		}
+
+		if( *ep == '?' ) {
+			const char * res = match( ms, s + 1, ep + 1 );
+			if( res != NULL || ms->err != NULL ) {
+				s = res;
+				break;
+			}
+			p = ep + 1;
+			continue;
+		}
+
+		if( *ep == '+' ) {
+			s = max_expand( ms, s + 1, p, ep );
+			break;
+		}
+
+		if( *ep == '*' ) {
+			s = max_expand( ms, s, p, ep );
+			break;
+		}
+
+		if( *ep == '-' ) {
+			s = min_expand( ms, s, p, ep );
+			break;
+		}
+
+		s++;
+		p = ep;
+	}
+
+	ms->depth++;
+	return s;
+}
+
+bool pattern_is_plain( Span< const char > pattern ) {
+	for( char c : pattern ) {
+		if( strchr( "^$*+?.([%-", c ) != NULL )
+			return false;
+	}
+	return true;
+}
+
+size_t pattern_find_plain( Span< const char > str, Span< const char > needle, size_t init ) {
+	if( init > str.n || needle.n > str.n - init )
+		return SIZE_MAX;
+	if( needle.n == 0 )
+		return init;
+
+	const char * cursor = str.ptr + init;
+	const char * last = str.ptr + str.n - needle.n;
+	while( cursor <= last ) {
+		const char * first = ( const char * ) memchr( cursor, needle[ 0 ], last - cursor + 1 );
+		if( first == NULL )
+			break;
+		if( memcmp( first + 1, needle.ptr + 1, needle.n - 1 ) == 0 )
+			return first - str.ptr;
+		cursor = first + 1;
+	}
+
+	return SIZE_MAX;
+}
+
+bool pattern_find( Span< const char > str, Span< const char > pattern, size_t init, PatternMatch * result, const char ** err ) {
+	ZoneScoped;
+
+	*err = NULL;
+	if( init > str.n )
+		return false;
+
+	const char * p = pattern.ptr;
+	bool anchor = pattern.n > 0 && *p == '^';
+	if( anchor )
+		p++;
+
+	MatchState ms;
+	ms.src_init = str.ptr;
+	ms.src_end = str.ptr + str.n;
+	ms.p_end = pattern.ptr + pattern.n;
+	ms.err = NULL;
+
+	const char * s = str.ptr + init;
+	do {
+		ms.level = 0;
+		ms.depth = MAX_RECURSION;
+
+		const char * e = match( &ms, s, p );
+		if( ms.err != NULL ) {
+			*err = ms.err;
+			return false;
+		}
+
+		if( e != NULL ) {
+			result->begin = s;
+			result->end = e;
+			result->num_captures = ms.level;
+			memcpy( result->captures, ms.captures, sizeof( ms.captures[ 0 ] ) * ms.level );
+
+			for( int i = 0; i < ms.level; i++ ) {
+				if( ms.captures[ i ].len == CAPTURE_UNFINISHED ) {
+					*err = "unfinished capture";
+					return false;
+				}
+			}
+
+			return true;
+		}
+	} while( s++ < ms.src_end && !anchor );
+
+	return false;
+}
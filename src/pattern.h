@@ -0,0 +1,34 @@
+#pragma once
+
+#include "common.h"
+
+/*
+ * Lua patterns over arbitrary buffers, adapted from lstrlib.c so we can
+ * match lines without turning them into Lua strings first. the pattern
+ * must be followed by a \0, which Lua strings always are
+ */
+
+constexpr int PATTERN_MAX_CAPTURES = 32;
+constexpr ptrdiff_t PATTERN_CAPTURE_POSITION = -2;
+
+struct PatternCapture {
+	const char * init;
+	ptrdiff_t len;
+};
+
+struct PatternMatch {
+	const char * begin;
+	const char * end;
+	int num_captures;
+	PatternCapture captures[ PATTERN_MAX_CAPTURES ];
+};
+
+// true if the pattern has no magic characters and can be matched with memcmp
+bool pattern_is_plain( Span< const char > pattern );
+
+// finds the first match at or after str[ init ]. returns false if there's no
+// match or the pattern is malformed, in which case *err is set
+bool pattern_find( Span< const char > str, Span< const char > pattern, size_t init, PatternMatch * match, const char ** err );
+
+// plain substring search, returns the offset or SIZE_MAX
+size_t pattern_find_plain( Span< const char > str, Span< const char > needle, size_t init );
@@ -1,5 +1,13 @@
 #include "common.h"
+#include "array.h"
+#include "highlight.h"
+#include "line.h"
+#include "log_writer.h"
+#include "lua_alloc.h"
+#include "map.h"
+#include "pattern.h"
 #include "platform.h"
+#include "timers.h"
 #include "ui.h"
 
 #include "platform_time.h"
@@ -26,7 +34,108 @@ static int inputHandlerIdx = LUA_NOREF;
 static int macroHandlerIdx = LUA_NOREF;
 static int closeHandlerIdx = LUA_NOREF;
 static int socketHandlerIdx = LUA_NOREF;
-static int intervalHandlerIdx = LUA_NOREF;
+static int socketLineHandlerIdx = LUA_NOREF;
+static int socketEchoHandlerIdx = LUA_NOREF;
+static int timerHandlerIdx = LUA_NOREF;
+
+static DynamicArray< u64 > expired_timers;
+
+/*
+ * telnet lines are handed to Lua as one reusable userdata over a native
+ * buffer, so triggers that don't match never create any Lua strings. it's
+ * only valid while the line handler is running
+ */
+
+static StyledLine current_line;
+static StyledLine scratch_line;
+static AnsiStyle main_style = DEFAULT_ANSI_STYLE;
+static bool line_valid = false;
+
+static int lineUserdataIdx = LUA_NOREF;
+static int lineTextIdx = LUA_NOREF;
+static int lineRawIdx = LUA_NOREF;
+
+/*
+ * subs rewrite a copy of the line that's only used for display, so actions
+ * still see what the server sent. they stack, each one sees the output of
+ * the last. the copy's raw gets edited along with its text, so raw subs
+ * still see the server's escape codes after a text sub
+ */
+
+static StyledLine display_line;
+static StyledLine sub_line;
+static StyledLine replacement_line;
+static DynamicArray< char > sub_replacement;
+static DynamicArray< char > sub_raw;
+static DynamicArray< size_t > sub_raw_offsets;
+static bool display_modified = false;
+
+// the last few stripped lines so multi-line triggers can look back without
+// keeping copies in Lua. lines are numbered from 1
+static DynamicArray< char > recent_lines[ RECENT_LINES ];
+static u64 lines_received;
+
+/*
+ * the automatic collector is stopped and we step it ourselves, mostly while
+ * the main loop is idle. handlers only pay for a step when a burst has
+ * allocated enough that we can't wait for idle time
+ */
+
+enum GCMode {
+	GC_INCREMENTAL,
+	GC_GENERATIONAL,
+};
+
+static GCMode gc_mode = GC_INCREMENTAL;
+static int gc_step_kb = 64;
+static double gc_idle_budget = 0.002;
+static double gc_debt_ratio = 2.0;
+
+static size_t gc_baseline;
+static bool gc_cycle_in_progress;
+
+static constexpr double GC_PAUSE_BUCKETS[] = { 0.00005, 0.0001, 0.00025, 0.0005, 0.001, 0.002, 0.005, 0.01, 0.025, 0.05 };
+static u64 gc_pause_histogram[ ARRAY_COUNT( GC_PAUSE_BUCKETS ) + 1 ];
+static double gc_max_pause;
+static u64 gc_idle_steps;
+static u64 gc_forced_steps;
+static u64 gc_cycles;
+
+static void gc_step( bool forced ) {
+	ZoneScoped;
+
+	double start = get_time();
+	bool finished = lua_gc( lua, LUA_GCSTEP, gc_step_kb ) != 0;
+	double pause = get_time() - start;
+
+	size_t bucket = 0;
+	while( bucket < ARRAY_COUNT( GC_PAUSE_BUCKETS ) && pause > GC_PAUSE_BUCKETS[ bucket ] )
+		bucket++;
+	gc_pause_histogram[ bucket ]++;
+	gc_max_pause = max( gc_max_pause, pause );
+
+	if( forced )
+		gc_forced_steps++;
+	else
+		gc_idle_steps++;
+
+	gc_cycle_in_progress = !finished;
+	if( finished ) {
+		gc_baseline = lua_alloc_live_bytes();
+		gc_cycles++;
+	}
+
+	TracyPlot( "Lua GC step ms", pause * 1000.0 );
+}
+
+static bool gc_has_work() {
+	return gc_cycle_in_progress || lua_alloc_live_bytes() > gc_baseline + size_t( gc_step_kb ) * 1024;
+}
+
+static void gc_pay_debt() {
+	if( double( lua_alloc_live_bytes() ) > double( gc_baseline ) * gc_debt_ratio )
+		gc_step( true );
+}
 
 static void pcall( int args, const char * err ) {
 	if( lua_pcall( lua, args, 0, 1 ) ) {
@@ -35,6 +144,8 @@ static void pcall( int args, const char * err ) {
 	}
 
 	assert( lua_gettop( lua ) == 1 );
+
+	gc_pay_debt();
 }
 
 void script_handleInput( const char * buffer, int len ) {
@@ -94,13 +205,81 @@ void script_socketData( void * sock, const char * data, size_t len ) {
 	pcall( 2, "script_socketData" );
 }
 
-void script_fire_intervals() {
+void script_socketLine( void * sock, const char * line, size_t len, bool prompt ) {
 	ZoneScoped;
 
-	assert( intervalHandlerIdx != LUA_NOREF );
+	assert( socketLineHandlerIdx != LUA_NOREF );
+
+	log_session_line( line, len, main_style );
+
+	line_parse( &current_line, main_style, line, len );
+	display_modified = false;
 
-	lua_rawgeti( lua, LUA_REGISTRYINDEX, intervalHandlerIdx );
-	pcall( 0, "script_fire_intervals" );
+	lines_received++;
+	recent_lines[ lines_received % RECENT_LINES ].from_span( current_line.text.span() );
+
+	lua_rawgeti( lua, LUA_REGISTRYINDEX, socketLineHandlerIdx );
+
+	lua_pushlightuserdata( lua, sock );
+	lua_rawgeti( lua, LUA_REGISTRYINDEX, lineUserdataIdx );
+	lua_pushboolean( lua, prompt );
+
+	line_valid = true;
+	pcall( 3, "script_socketLine" );
+	line_valid = false;
+
+	// drop any strings the scripts asked for
+	luaL_unref( lua, LUA_REGISTRYINDEX, lineTextIdx );
+	luaL_unref( lua, LUA_REGISTRYINDEX, lineRawIdx );
+	lineTextIdx = LUA_NOREF;
+	lineRawIdx = LUA_NOREF;
+}
+
+void script_socketEcho( void * sock, bool echo ) {
+	ZoneScoped;
+
+	assert( socketEchoHandlerIdx != LUA_NOREF );
+
+	lua_rawgeti( lua, LUA_REGISTRYINDEX, socketEchoHandlerIdx );
+
+	lua_pushlightuserdata( lua, sock );
+	lua_pushboolean( lua, echo );
+
+	pcall( 2, "script_socketEcho" );
+}
+
+void script_fire_timers() {
+	ZoneScoped;
+
+	assert( timerHandlerIdx != LUA_NOREF );
+
+	// collect first so timers added by callbacks wait until the next call
+	double now = get_time();
+	expired_timers.clear();
+
+	u64 id;
+	while( timers_pop_expired( now, &id ) ) {
+		expired_timers.add( id );
+	}
+
+	for( u64 expired : expired_timers ) {
+		lua_rawgeti( lua, LUA_REGISTRYINDEX, timerHandlerIdx );
+		lua_pushinteger( lua, lua_Integer( expired ) );
+		lua_pushnumber( lua, now );
+
+		pcall( 2, "script_fire_timers" );
+	}
+}
+
+void script_idle( double budget ) {
+	ZoneScoped;
+
+	double deadline = get_time() + min( budget, gc_idle_budget );
+	while( gc_has_work() ) {
+		gc_step( false );
+		if( get_time() >= deadline )
+			break;
+	}
 }
 
 namespace {
@@ -117,12 +296,442 @@ static void generic_print( F * f, lua_State * L ) {
 	f( str, len, fg, bg, bold );
 }
 
+static StyledLine * check_line( lua_State * L ) {
+	luaL_checkudata( L, 1, "mud.line" );
+	if( !line_valid )
+		luaL_error( L, "line used outside of its handler" );
+	return &current_line;
+}
+
+static void push_cached( lua_State * L, int * ref, Span< const char > str ) {
+	if( *ref != LUA_NOREF ) {
+		lua_rawgeti( L, LUA_REGISTRYINDEX, *ref );
+		return;
+	}
+
+	lua_pushlstring( L, str.ptr, str.n );
+	lua_pushvalue( L, -1 );
+	*ref = luaL_ref( L, LUA_REGISTRYINDEX );
+}
+
+static void push_capture( lua_State * L, Span< const char > str, const PatternMatch & match, int i ) {
+	if( i >= match.num_captures ) {
+		lua_pushlstring( L, match.begin, match.end - match.begin );
+		return;
+	}
+
+	const PatternCapture & capture = match.captures[ i ];
+	if( capture.len == PATTERN_CAPTURE_POSITION )
+		lua_pushinteger( L, lua_Integer( capture.init - str.ptr + 1 ) );
+	else
+		lua_pushlstring( L, capture.init, capture.len );
+}
+
+// string.find/string.match over a native buffer
+static int generic_find( lua_State * L, Span< const char > str, bool find ) {
+	size_t pattern_len;
+	const char * pattern_str = luaL_checklstring( L, 2, &pattern_len );
+	Span< const char > pattern( pattern_str, pattern_len );
+
+	lua_Integer init_arg = luaL_optinteger( L, 3, 1 );
+	size_t init;
+	if( init_arg >= 0 )
+		init = init_arg == 0 ? 0 : size_t( init_arg - 1 );
+	else if( size_t( -init_arg ) > str.n )
+		init = 0;
+	else
+		init = str.n - size_t( -init_arg );
+
+	if( init > str.n ) {
+		lua_pushnil( L );
+		return 1;
+	}
+
+	if( find && ( lua_toboolean( L, 4 ) || pattern_is_plain( pattern ) ) ) {
+		size_t pos = pattern_find_plain( str, pattern, init );
+		if( pos == SIZE_MAX ) {
+			lua_pushnil( L );
+			return 1;
+		}
+
+		lua_pushinteger( L, lua_Integer( pos + 1 ) );
+		lua_pushinteger( L, lua_Integer( pos + pattern.n ) );
+		return 2;
+	}
+
+	PatternMatch match;
+	const char * err;
+	if( !pattern_find( str, pattern, init, &match, &err ) ) {
+		if( err != NULL )
+			return luaL_error( L, "%s", err );
+		lua_pushnil( L );
+		return 1;
+	}
+
+	int results = 0;
+	if( find ) {
+		lua_pushinteger( L, lua_Integer( match.begin - str.ptr + 1 ) );
+		lua_pushinteger( L, lua_Integer( match.end - str.ptr ) );
+		results = 2;
+	}
+
+	// match returns the whole match when there are no captures
+	int captures = match.num_captures == 0 && !find ? 1 : match.num_captures;
+	luaL_checkstack( L, captures, "too many captures" );
+	for( int i = 0; i < captures; i++ ) {
+		push_capture( L, str, match, i );
+	}
+
+	return results + captures;
+}
+
+extern "C" int mud_line_text( lua_State * L ) {
+	StyledLine * line = check_line( L );
+	push_cached( L, &lineTextIdx, line->text.span() );
+	return 1;
+}
+
+extern "C" int mud_line_raw( lua_State * L ) {
+	StyledLine * line = check_line( L );
+	push_cached( L, &lineRawIdx, line->raw.span() );
+	return 1;
+}
+
+extern "C" int mud_line_len( lua_State * L ) {
+	StyledLine * line = check_line( L );
+	lua_pushinteger( L, lua_Integer( line->text.size() ) );
+	return 1;
+}
+
+extern "C" int mud_line_number( lua_State * L ) {
+	check_line( L );
+	lua_pushinteger( L, lua_Integer( lines_received ) );
+	return 1;
+}
+
+// recentLine( 1 ) is the line being handled, recentLine( 2 ) the one before
+extern "C" int mud_recentLine( lua_State * L ) {
+	lua_Integer i = luaL_checkinteger( L, 1 );
+	if( i < 1 || u64( i ) > min( lines_received, u64( RECENT_LINES ) ) ) {
+		lua_pushnil( L );
+		return 1;
+	}
+
+	const DynamicArray< char > & line = recent_lines[ ( lines_received - u64( i - 1 ) ) % RECENT_LINES ];
+	lua_pushlstring( L, line.ptr(), line.size() );
+	return 1;
+}
+
+extern "C" int mud_line_find( lua_State * L ) {
+	StyledLine * line = check_line( L );
+	return generic_find( L, line->text.span(), true );
+}
+
+extern "C" int mud_line_match( lua_State * L ) {
+	StyledLine * line = check_line( L );
+	return generic_find( L, line->text.span(), false );
+}
+
+extern "C" int mud_line_find_raw( lua_State * L ) {
+	StyledLine * line = check_line( L );
+	return generic_find( L, line->raw.span(), true );
+}
+
+extern "C" int mud_line_match_raw( lua_State * L ) {
+	StyledLine * line = check_line( L );
+	return generic_find( L, line->raw.span(), false );
+}
+
+static void append( DynamicArray< char > * buf, Span< const char > str ) {
+	if( str.n == 0 )
+		return;
+	size_t idx = buf->extend( str.n );
+	memcpy( buf->ptr() + idx, str.ptr, str.n );
+}
+
+// returns false if a function or table replacement wants to leave the
+// match alone
+static bool expand_replacement( lua_State * L, Span< const char > str, const PatternMatch & match, DynamicArray< char > * out ) {
+	out->clear();
+
+	int replacement_type = lua_type( L, 3 );
+	if( replacement_type == LUA_TFUNCTION || replacement_type == LUA_TTABLE ) {
+		if( replacement_type == LUA_TFUNCTION ) {
+			int captures = max( match.num_captures, 1 );
+			luaL_checkstack( L, captures + 1, "too many captures" );
+
+			lua_pushvalue( L, 3 );
+			for( int i = 0; i < captures; i++ ) {
+				push_capture( L, str, match, i );
+			}
+			lua_call( L, captures, 1 );
+		}
+		else {
+			push_capture( L, str, match, 0 );
+			lua_gettable( L, 3 );
+		}
+
+		if( !lua_toboolean( L, -1 ) ) {
+			lua_pop( L, 1 );
+			return false;
+		}
+
+		if( !lua_isstring( L, -1 ) )
+			luaL_error( L, "invalid replacement value (a %s)", luaL_typename( L, -1 ) );
+
+		size_t len;
+		const char * replacement = lua_tolstring( L, -1, &len );
+		append( out, Span< const char >( replacement, len ) );
+		lua_pop( L, 1 );
+
+		return true;
+	}
+
+	size_t len;
+	const char * replacement = lua_tolstring( L, 3, &len );
+	for( size_t i = 0; i < len; i++ ) {
+		if( replacement[ i ] != '%' ) {
+			out->add( replacement[ i ] );
+			continue;
+		}
+
+		i++;
+		char c = i < len ? replacement[ i ] : '\0';
+		if( c == '%' ) {
+			out->add( '%' );
+			continue;
+		}
+
+		if( c < '0' || c > '9' )
+			luaL_error( L, "invalid use of '%%' in replacement string" );
+
+		int capture = c - '1';
+		if( c == '0' || ( capture == 0 && match.num_captures == 0 ) ) {
+			append( out, Span< const char >( match.begin, match.end - match.begin ) );
+		}
+		else if( capture >= match.num_captures ) {
+			luaL_error( L, "invalid capture index %%%d in replacement string", capture + 1 );
+		}
+		else if( match.captures[ capture ].len == PATTERN_CAPTURE_POSITION ) {
+			char position[ 32 ];
+			int n = snprintf( position, sizeof( position ), "%zu", size_t( match.captures[ capture ].init - str.ptr + 1 ) );
+			append( out, Span< const char >( position, n ) );
+		}
+		else {
+			append( out, Span< const char >( match.captures[ capture ].init, match.captures[ capture ].len ) );
+		}
+	}
+
+	return true;
+}
+
+/*
+ * string.gsub over a native buffer. emit gets called with the unmatched
+ * pieces of str and the replacement for each match, in order
+ */
+template< typename Emit >
+static int generic_sub( lua_State * L, Span< const char > str, Emit * emit ) {
+	size_t pattern_len;
+	const char * pattern_str = luaL_checklstring( L, 2, &pattern_len );
+	Span< const char > pattern( pattern_str, pattern_len );
+
+	int replacement_type = lua_type( L, 3 );
+	luaL_argcheck( L, replacement_type == LUA_TSTRING || replacement_type == LUA_TNUMBER || replacement_type == LUA_TFUNCTION || replacement_type == LUA_TTABLE, 3, "string/function/table expected" );
+
+	bool anchor = pattern.n > 0 && pattern[ 0 ] == '^';
+
+	size_t pos = 0;
+	const char * last_match = NULL;
+	int subs = 0;
+
+	while( true ) {
+		PatternMatch match;
+		const char * err;
+		if( !pattern_find( str, pattern, pos, &match, &err ) ) {
+			if( err != NULL )
+				return luaL_error( L, "%s", err );
+			break;
+		}
+
+		size_t begin = match.begin - str.ptr;
+		size_t end = match.end - str.ptr;
+
+		// an empty match straight after the last one doesn't count
+		if( match.end == last_match ) {
+			if( begin == str.n )
+				break;
+			emit->copy( pos, begin + 1 );
+			pos = begin + 1;
+		}
+		else {
+			emit->copy( pos, begin );
+			if( expand_replacement( L, str, match, &sub_replacement ) ) {
+				emit->replace( begin, end, sub_replacement.span() );
+			}
+			else {
+				emit->copy( begin, end );
+			}
+
+			subs++;
+			pos = end;
+			last_match = match.end;
+		}
+
+		if( anchor || pos > str.n )
+			break;
+	}
+
+	emit->copy( pos, str.n );
+
+	return subs;
+}
+
+static StyledLine * check_display_line( lua_State * L ) {
+	check_line( L );
+
+	if( !display_modified ) {
+		display_line.raw.from_span( current_line.raw.span() );
+		display_line.text.from_span( current_line.text.span() );
+		display_line.runs.from_span( current_line.runs.span() );
+		display_line.end_style = current_line.end_style;
+	}
+
+	return &display_line;
+}
+
+/*
+ * escape codes in raw go with the character after them, so copies bring
+ * along the codes that style what they copy. a replacement goes after the
+ * codes before the match, and the codes inside the match go after it so
+ * the rest of the line keeps its style
+ */
+struct StyledSub {
+	const StyledLine * src;
+	StyledLine * dst;
+	const size_t * raw_offsets;
+	DynamicArray< char > * raw;
+	size_t raw_pos;
+
+	void copy( size_t start, size_t end ) {
+		line_append( dst, src, start, end );
+		append( raw, src->raw.span().slice( raw_pos, raw_offsets[ end ] ) );
+		raw_pos = raw_offsets[ end ];
+	}
+
+	// replacements take the style of the start of the match unless they
+	// have escape codes of their own
+	void replace( size_t begin, size_t end, Span< const char > replacement ) {
+		line_parse( &replacement_line, line_style_at( src, begin ), replacement.ptr, replacement.n );
+		line_append( dst, &replacement_line, 0, replacement_line.text.size() );
+
+		append( raw, replacement );
+		if( replacement_line.text.size() == replacement.n ) {
+			line_copy_escapes( src->raw.span().slice( raw_pos, raw_offsets[ end ] ), raw );
+		}
+		else {
+			line_write_style( end < src->text.size() ? line_style_at( src, end ) : src->end_style, raw );
+		}
+		raw_pos = raw_offsets[ end ];
+	}
+};
+
+struct RawSub {
+	Span< const char > src;
+	DynamicArray< char > * dst;
+
+	void copy( size_t start, size_t end ) {
+		append( dst, src.slice( start, end ) );
+	}
+
+	void replace( size_t begin, size_t end, Span< const char > replacement ) {
+		append( dst, replacement );
+	}
+};
+
+// rewrites the displayed line in place and returns the number of matches
+extern "C" int mud_line_gsub( lua_State * L ) {
+	StyledLine * line = check_display_line( L );
+
+	line_clear( &sub_line, line->end_style );
+	line_raw_offsets( line, &sub_raw_offsets );
+	sub_raw.clear();
+
+	StyledSub emit;
+	emit.src = line;
+	emit.dst = &sub_line;
+	emit.raw_offsets = sub_raw_offsets.ptr();
+	emit.raw = &sub_raw;
+	emit.raw_pos = 0;
+	int subs = generic_sub( L, line->text.span(), &emit );
+
+	if( subs > 0 ) {
+		line->raw.from_span( sub_raw.span() );
+		line->text.from_span( sub_line.text.span() );
+		line->runs.from_span( sub_line.runs.span() );
+		display_modified = true;
+	}
+
+	lua_pushinteger( L, subs );
+	return 1;
+}
+
+// same as gsub but the pattern sees escape codes, for subs that match colours
+extern "C" int mud_line_gsub_raw( lua_State * L ) {
+	StyledLine * line = check_display_line( L );
+
+	sub_raw.clear();
+
+	RawSub emit;
+	emit.src = line->raw.span();
+	emit.dst = &sub_raw;
+	int subs = generic_sub( L, line->raw.span(), &emit );
+
+	if( subs > 0 ) {
+		AnsiStyle end_style = line->end_style;
+		line_parse( line, main_style, sub_raw.ptr(), sub_raw.size() );
+		line->end_style = end_style;
+		display_modified = true;
+	}
+
+	lua_pushinteger( L, subs );
+	return 1;
+}
+
+// prints a line or a string with escape codes to the main window, or only
+// applies its escape codes if it's gagged
+extern "C" int mud_printLine( lua_State * L ) {
+	const StyledLine * line;
+	if( lua_type( L, 1 ) == LUA_TSTRING ) {
+		size_t len;
+		const char * str = lua_tolstring( L, 1, &len );
+		line_parse( &scratch_line, main_style, str, len );
+		line = &scratch_line;
+	}
+	else {
+		line = check_line( L );
+		if( display_modified )
+			line = &display_line;
+	}
+
+	bool gagged = lua_toboolean( L, 2 );
+	if( !gagged ) {
+		for( const StyleRun & run : line->runs ) {
+			ui_main_print( line->text.ptr() + run.start, run.len, run.style.fg, run.style.bg, run.style.bold );
+		}
+	}
+
+	main_style = line->end_style;
+
+	return 0;
+}
+
 extern "C" int mud_connect( lua_State * L ) {
 	const char * host = luaL_checkstring( L, 1 );
 	int port = luaL_checkinteger( L, 2 );
+	bool telnet = lua_toboolean( L, 3 );
 
 	const char * err;
-	void * sock = platform_connect( &err, host, port );
+	void * sock = platform_connect( &err, host, port, telnet );
 	if( sock != NULL ) {
 		lua_pushlightuserdata( lua, sock );
 		return 1;
@@ -215,8 +824,12 @@ extern "C" int mud_setHandlers( lua_State * L ) {
 	luaL_argcheck( L, lua_type( L, 3 ) == LUA_TFUNCTION, 3, "expected function" );
 	luaL_argcheck( L, lua_type( L, 4 ) == LUA_TFUNCTION, 4, "expected function" );
 	luaL_argcheck( L, lua_type( L, 5 ) == LUA_TFUNCTION, 5, "expected function" );
+	luaL_argcheck( L, lua_type( L, 6 ) == LUA_TFUNCTION, 6, "expected function" );
+	luaL_argcheck( L, lua_type( L, 7 ) == LUA_TFUNCTION, 7, "expected function" );
 
-	intervalHandlerIdx = luaL_ref( L, LUA_REGISTRYINDEX );
+	timerHandlerIdx = luaL_ref( L, LUA_REGISTRYINDEX );
+	socketEchoHandlerIdx = luaL_ref( L, LUA_REGISTRYINDEX );
+	socketLineHandlerIdx = luaL_ref( L, LUA_REGISTRYINDEX );
 	socketHandlerIdx = luaL_ref( L, LUA_REGISTRYINDEX );
 	closeHandlerIdx = luaL_ref( L, LUA_REGISTRYINDEX );
 	macroHandlerIdx = luaL_ref( L, LUA_REGISTRYINDEX );
@@ -235,6 +848,149 @@ extern "C" int mud_now( lua_State * L ) {
 	return 1;
 }
 
+extern "C" int mud_timer_add( lua_State * L ) {
+	double deadline = luaL_checknumber( L, 1 );
+	lua_pushinteger( L, lua_Integer( timers_add( deadline ) ) );
+	return 1;
+}
+
+extern "C" int mud_timer_cancel( lua_State * L ) {
+	u64 id = u64( luaL_checkinteger( L, 1 ) );
+	timers_cancel( id );
+	return 0;
+}
+
+extern "C" int mud_memstats( lua_State * L ) {
+	// rates are averaged over the time since the last call
+	static double last_time = get_time();
+	static DynamicArray< u64 > last_allocs;
+
+	Span< const LuaAllocStats > stats = lua_alloc_stats();
+	if( last_allocs.size() != stats.n ) {
+		last_allocs.resize( stats.n );
+		memset( last_allocs.ptr(), 0, last_allocs.num_bytes() );
+	}
+
+	double now = get_time();
+	double dt = max( now - last_time, 0.001 );
+	last_time = now;
+
+	lua_createtable( L, 0, 3 );
+
+	lua_pushinteger( L, lua_Integer( lua_alloc_live_bytes() ) );
+	lua_setfield( L, -2, "live" );
+	lua_pushinteger( L, lua_Integer( lua_alloc_peak_bytes() ) );
+	lua_setfield( L, -2, "peak" );
+
+	lua_createtable( L, int( stats.n ), 0 );
+	for( size_t i = 0; i < stats.n; i++ ) {
+		const LuaAllocStats & s = stats[ i ];
+
+		lua_createtable( L, 0, 5 );
+
+		if( s.block_size == 0 )
+			lua_pushliteral( L, "large" );
+		else
+			lua_pushinteger( L, lua_Integer( s.block_size ) );
+		lua_setfield( L, -2, "size" );
+
+		lua_pushinteger( L, lua_Integer( s.live_bytes ) );
+		lua_setfield( L, -2, "live" );
+		lua_pushinteger( L, lua_Integer( s.peak_bytes ) );
+		lua_setfield( L, -2, "peak" );
+		lua_pushinteger( L, lua_Integer( s.allocs ) );
+		lua_setfield( L, -2, "allocs" );
+		lua_pushnumber( L, double( s.allocs - last_allocs[ i ] ) / dt );
+		lua_setfield( L, -2, "rate" );
+
+		last_allocs[ i ] = s.allocs;
+
+		lua_rawseti( L, -2, int( i + 1 ) );
+	}
+	lua_setfield( L, -2, "classes" );
+
+	return 1;
+}
+
+static void set_gc_mode( lua_State * L, GCMode mode ) {
+#if LUA_VERSION_NUM >= 504
+	lua_gc( L, mode == GC_GENERATIONAL ? LUA_GCGEN : LUA_GCINC, 0, 0 );
+	lua_gc( L, LUA_GCSTOP, 0 );
+#else
+	if( mode == GC_GENERATIONAL )
+		luaL_error( L, "generational GC needs Lua 5.4" );
+#endif
+
+	gc_mode = mode;
+}
+
+extern "C" int mud_gc( lua_State * L ) {
+	if( !lua_isnoneornil( L, 1 ) ) {
+		luaL_checktype( L, 1, LUA_TTABLE );
+
+		lua_getfield( L, 1, "mode" );
+		if( !lua_isnil( L, -1 ) ) {
+			const char * mode = luaL_checkstring( L, -1 );
+			if( strcmp( mode, "incremental" ) == 0 )
+				set_gc_mode( L, GC_INCREMENTAL );
+			else if( strcmp( mode, "generational" ) == 0 )
+				set_gc_mode( L, GC_GENERATIONAL );
+			else
+				luaL_error( L, "bad GC mode: %s", mode );
+		}
+
+		lua_getfield( L, 1, "step" );
+		if( !lua_isnil( L, -1 ) )
+			gc_step_kb = max( 0, int( luaL_checkinteger( L, -1 ) ) );
+
+		lua_getfield( L, 1, "idle_budget" );
+		if( !lua_isnil( L, -1 ) )
+			gc_idle_budget = max( 0.0, double( luaL_checknumber( L, -1 ) ) );
+
+		lua_getfield( L, 1, "debt" );
+		if( !lua_isnil( L, -1 ) )
+			gc_debt_ratio = max( 1.0, double( luaL_checknumber( L, -1 ) ) );
+
+		lua_pop( L, 4 );
+	}
+
+	lua_createtable( L, 0, 9 );
+
+	lua_pushstring( L, gc_mode == GC_GENERATIONAL ? "generational" : "incremental" );
+	lua_setfield( L, -2, "mode" );
+	lua_pushinteger( L, gc_step_kb );
+	lua_setfield( L, -2, "step" );
+	lua_pushnumber( L, gc_idle_budget );
+	lua_setfield( L, -2, "idle_budget" );
+	lua_pushnumber( L, gc_debt_ratio );
+	lua_setfield( L, -2, "debt" );
+
+	lua_pushinteger( L, lua_Integer( gc_idle_steps ) );
+	lua_setfield( L, -2, "idle_steps" );
+	lua_pushinteger( L, lua_Integer( gc_forced_steps ) );
+	lua_setfield( L, -2, "forced_steps" );
+	lua_pushinteger( L, lua_Integer( gc_cycles ) );
+	lua_setfield( L, -2, "cycles" );
+	lua_pushnumber( L, gc_max_pause );
+	lua_setfield( L, -2, "max_pause" );
+
+	// { { max = seconds, count = n }, ... }, the last bucket has no max
+	lua_createtable( L, ARRAY_COUNT( gc_pause_histogram ), 0 );
+	for( size_t i = 0; i < ARRAY_COUNT( gc_pause_histogram ); i++ ) {
+		lua_createtable( L, 0, 2 );
+		if( i < ARRAY_COUNT( GC_PAUSE_BUCKETS ) ) {
+			lua_pushnumber( L, GC_PAUSE_BUCKETS[ i ] );
+			lua_setfield( L, -2, "max" );
+		}
+		lua_pushinteger( L, lua_Integer( gc_pause_histogram[ i ] ) );
+		lua_setfield( L, -2, "count" );
+		lua_rawseti( L, -2, int( i + 1 ) );
+	}
+	lua_setfield( L, -2, "pauses" );
+
+	return 1;
+}
+
 extern "C" int mud_set_font( lua_State * L ) {
 	const char * name = luaL_checkstring( L, 1 );
 	int size = luaL_checkinteger( L, 2 );
@@ -246,8 +1002,472 @@ extern "C" int mud_set_font( lua_State * L ) {
 	return 1;
 }
 
+extern "C" int mud_set_split( lua_State * L ) {
+	lua_Integer rows = luaL_checkinteger( L, 1 );
+	luaL_argcheck( L, rows >= 0, 1, "rows can't be negative" );
+
+	ui_set_split( size_t( rows ) );
+
+	return 0;
+}
+
+extern "C" int mud_window_open( lua_State * L ) {
+	lua_Integer rows = luaL_checkinteger( L, 1 );
+	lua_Integer position = luaL_checkinteger( L, 2 );
+	lua_Integer scrollback = luaL_checkinteger( L, 3 );
+	luaL_argcheck( L, rows >= 0, 1, "rows can't be negative" );
+	luaL_argcheck( L, position == WINDOW_TOP || position == WINDOW_BOTTOM, 2, "bad position" );
+	luaL_argcheck( L, scrollback > 0, 3, "scrollback should be positive" );
+
+	int id = ui_window_open( size_t( rows ), WindowPosition( position ), size_t( scrollback ) );
+	if( id == -1 ) {
+		lua_pushnil( L );
+		lua_pushliteral( L, "too many windows" );
+		return 2;
+	}
+
+	lua_pushinteger( L, id );
+	return 1;
+}
+
+extern "C" int mud_window_layout( lua_State * L ) {
+	int id = int( luaL_checkinteger( L, 1 ) );
+	lua_Integer rows = luaL_checkinteger( L, 2 );
+	lua_Integer position = luaL_checkinteger( L, 3 );
+	luaL_argcheck( L, rows >= 0, 2, "rows can't be negative" );
+	luaL_argcheck( L, position == WINDOW_TOP || position == WINDOW_BOTTOM, 3, "bad position" );
+
+	ui_window_layout( id, size_t( rows ), WindowPosition( position ) );
+	return 0;
+}
+
+extern "C" int mud_window_close( lua_State * L ) {
+	ui_window_close( int( luaL_checkinteger( L, 1 ) ) );
+	return 0;
+}
+
+static void window_print_line( int id, const StyledLine * line ) {
+	for( const StyleRun & run : line->runs ) {
+		ui_window_print( id, line->text.ptr() + run.start, run.len, run.style.fg, run.style.bg, run.style.bold );
+	}
+}
+
+// prints a string with escape codes, each \n starts a new line
+extern "C" int mud_window_print( lua_State * L ) {
+	int id = int( luaL_checkinteger( L, 1 ) );
+	size_t len;
+	const char * str = luaL_checklstring( L, 2, &len );
+
+	AnsiStyle style = DEFAULT_ANSI_STYLE;
+	while( true ) {
+		const char * newline = ( const char * ) memchr( str, '\n', len );
+		size_t n = newline == NULL ? len : size_t( newline - str );
+
+		line_parse( &scratch_line, style, str, n );
+		window_print_line( id, &scratch_line );
+		style = scratch_line.end_style;
+
+		if( newline == NULL )
+			break;
+
+		ui_window_newline( id );
+		str += n + 1;
+		len -= n + 1;
+	}
+
+	return 0;
+}
+
+// copies the line being handled, with any subs, without going through Lua
+extern "C" int mud_window_line( lua_State * L ) {
+	int id = int( luaL_checkinteger( L, 1 ) );
+	if( !line_valid )
+		return luaL_error( L, "no line is being handled" );
+
+	window_print_line( id, display_modified ? &display_line : &current_line );
+	ui_window_newline( id );
+
+	return 0;
+}
+
+extern "C" int mud_grid_open( lua_State * L ) {
+	lua_Integer cols = luaL_checkinteger( L, 1 );
+	lua_Integer rows = luaL_checkinteger( L, 2 );
+	lua_Integer position = luaL_checkinteger( L, 3 );
+	luaL_argcheck( L, cols > 0 && cols <= 1024, 1, "cols should be between 1 and 1024" );
+	luaL_argcheck( L, rows > 0 && rows <= 1024, 2, "rows should be between 1 and 1024" );
+	luaL_argcheck( L, position == WINDOW_TOP || position == WINDOW_BOTTOM, 3, "bad position" );
+
+	int id = ui_grid_open( size_t( cols ), size_t( rows ), WindowPosition( position ) );
+	if( id == -1 ) {
+		lua_pushnil( L );
+		lua_pushliteral( L, "too many windows" );
+		return 2;
+	}
+
+	lua_pushinteger( L, id );
+	return 1;
+}
+
+static Colour check_colour( lua_State * L, int idx ) {
+	lua_Integer colour = luaL_optinteger( L, idx, WHITE );
+	luaL_argcheck( L, colour >= 0 && colour < NUM_COLOURS, idx, "bad colour" );
+	return Colour( colour );
+}
+
+// x and y start from 1. cells outside the grid are ignored
+extern "C" int mud_grid_set( lua_State * L ) {
+	int id = int( luaL_checkinteger( L, 1 ) );
+	lua_Integer x = luaL_checkinteger( L, 2 );
+	lua_Integer y = luaL_checkinteger( L, 3 );
+	size_t len;
+	const char * ch = luaL_checklstring( L, 4, &len );
+	Colour fg = check_colour( L, 5 );
+	bool bold = lua_toboolean( L, 6 );
+
+	if( x >= 1 && y >= 1 ) {
+		ui_grid_set( id, size_t( x - 1 ), size_t( y - 1 ), len > 0 ? ch[ 0 ] : ' ', fg, bold );
+	}
+
+	return 0;
+}
+
+/*
+ * replaces the whole grid with a table of rows, which can have escape codes
+ * in them. missing rows and the ends of short rows get cleared. the grid
+ * only redraws cells that end up different
+ */
+extern "C" int mud_grid_blit( lua_State * L ) {
+	int id = int( luaL_checkinteger( L, 1 ) );
+	luaL_checktype( L, 2, LUA_TTABLE );
+
+	size_t cols, rows;
+	ui_grid_size( id, &cols, &rows );
+
+	for( size_t y = 0; y < rows; y++ ) {
+		lua_rawgeti( L, 2, lua_Integer( y + 1 ) );
+
+		size_t len = 0;
+		const char * str = "";
+		if( !lua_isnil( L, -1 ) ) {
+			if( lua_type( L, -1 ) != LUA_TSTRING )
+				return luaL_error( L, "row %d should be a string", int( y + 1 ) );
+			str = lua_tolstring( L, -1, &len );
+		}
+
+		line_parse( &scratch_line, DEFAULT_ANSI_STYLE, str, len );
+
+		size_t x = 0;
+		for( const StyleRun & run : scratch_line.runs ) {
+			for( size_t i = 0; i < run.len && x < cols; i++ ) {
+				ui_grid_set( id, x, y, scratch_line.text[ run.start + i ], run.style.fg, run.style.bold );
+				x++;
+			}
+		}
+
+		for( ; x < cols; x++ ) {
+			ui_grid_set( id, x, y, ' ', WHITE, false );
+		}
+
+		lua_pop( L, 1 );
+	}
+
+	return 0;
+}
+
+extern "C" int mud_grid_clear( lua_State * L ) {
+	int id = int( luaL_checkinteger( L, 1 ) );
+	ui_grid_clear( id );
+	return 0;
+}
+
+static int opt_style( lua_State * L, int idx ) {
+	if( lua_isnoneornil( L, idx ) )
+		return -1;
+	if( lua_isboolean( L, idx ) )
+		return lua_toboolean( L, idx );
+	return int( luaL_checkinteger( L, idx ) );
+}
+
+extern "C" int mud_highlight_add( lua_State * L ) {
+	size_t len;
+	const char * text = luaL_checklstring( L, 1, &len );
+	bool pattern = lua_toboolean( L, 2 );
+	bool whole_word = lua_toboolean( L, 3 );
+
+	HighlightStyle style;
+	style.fg = opt_style( L, 4 );
+	style.bg = opt_style( L, 5 );
+	style.bold = opt_style( L, 6 );
+
+	u32 id = highlight_add( Span< const char >( text, len ), pattern, whole_word, style );
+	ui_restyle_text();
+
+	lua_pushinteger( L, id );
+	return 1;
+}
+
+extern "C" int mud_highlight_set( lua_State * L ) {
+	u32 id = u32( luaL_checkinteger( L, 1 ) );
+	bool enabled = lua_toboolean( L, 2 );
+
+	highlight_set_enabled( id, enabled );
+	ui_restyle_text();
+
+	return 0;
+}
+
+extern "C" int mud_highlight_remove( lua_State * L ) {
+	u32 id = u32( luaL_checkinteger( L, 1 ) );
+
+	highlight_remove( id );
+	ui_restyle_text();
+
+	return 0;
+}
+
+extern "C" int mud_find( lua_State * L ) {
+	size_t len;
+	const char * query = luaL_checklstring( L, 1, &len );
+
+	lua_pushboolean( L, ui_find( query, len ) );
+	return 1;
+}
+
+extern "C" int mud_find_next( lua_State * L ) {
+	bool older = lua_toboolean( L, 1 );
+
+	lua_pushboolean( L, ui_find_next( older ) );
+	return 1;
+}
+
+extern "C" int mud_clear_find( lua_State * L ) {
+	ui_clear_find();
+	return 0;
+}
+
+extern "C" int mud_log_open( lua_State * L ) {
+	const char * path = luaL_checkstring( L, 1 );
+	int format = int( luaL_checkinteger( L, 2 ) );
+	luaL_argcheck( L, format >= LOG_RAW && format <= LOG_HTML, 2, "bad log format" );
+
+	const char * err;
+	int channel = log_open( &err, path, LogFormat( format ) );
+	if( channel == -1 ) {
+		lua_pushnil( L );
+		lua_pushstring( L, err );
+		return 2;
+	}
+
+	lua_pushinteger( L, channel );
+	return 1;
+}
+
+extern "C" int mud_log_write( lua_State * L ) {
+	int channel = int( luaL_checkinteger( L, 1 ) );
+	size_t len;
+	const char * text = luaL_checklstring( L, 2, &len );
+
+	log_write( channel, text, len, DEFAULT_ANSI_STYLE );
+
+	return 0;
+}
+
+extern "C" int mud_log_close( lua_State * L ) {
+	log_close( int( luaL_checkinteger( L, 1 ) ) );
+	return 0;
+}
+
+extern "C" int mud_log_session( lua_State * L ) {
+	int channel = int( luaL_checkinteger( L, 1 ) );
+	log_set_session( channel, lua_toboolean( L, 2 ) );
+	return 0;
+}
+
+static u32 check_room_id( lua_State * L, int idx ) {
+	lua_Integer id = luaL_checkinteger( L, idx );
+	luaL_argcheck( L, id >= 0 && id <= lua_Integer( UINT32_MAX ), idx, "room ids must be 0 to 2^32 - 1" );
+	return u32( id );
+}
+
+static u32 check_cost( lua_State * L, int idx ) {
+	lua_Integer cost = luaL_checkinteger( L, idx );
+	luaL_argcheck( L, cost >= 0 && cost <= MAP_MAX_COST, idx, "costs must be 0 to 65535" );
+	return u32( cost );
+}
+
+static u32 check_flags( lua_State * L, int idx ) {
+	lua_Integer flags = luaL_checkinteger( L, idx );
+	luaL_argcheck( L, flags >= 0 && flags <= lua_Integer( UINT32_MAX ), idx, "flags must fit in 32 bits" );
+	return u32( flags );
+}
+
+static int check_coord( lua_State * L, int idx ) {
+	lua_Integer coord = luaL_checkinteger( L, idx );
+	luaL_argcheck( L, coord >= INT32_MIN && coord <= INT32_MAX, idx, "coordinate is too big" );
+	return int( coord );
+}
+
+// id, name, flags, cost, [ x, y, z ]
+extern "C" int mud_map_room( lua_State * L ) {
+	u32 id = check_room_id( L, 1 );
+	size_t len;
+	const char * name = luaL_checklstring( L, 2, &len );
+	u32 flags = check_flags( L, 3 );
+	u32 cost = check_cost( L, 4 );
+
+	map_set_room( id, Span< const char >( name, len ), flags, cost );
+
+	if( !lua_isnoneornil( L, 5 ) ) {
+		map_set_coords( id, check_coord( L, 5 ), check_coord( L, 6 ), check_coord( L, 7 ) );
+	}
+
+	return 0;
+}
+
+extern "C" int mud_map_remove_room( lua_State * L ) {
+	map_remove_room( check_room_id( L, 1 ) );
+	return 0;
+}
+
+// from, command, to, cost. to = nil removes the exit
+extern "C" int mud_map_exit( lua_State * L ) {
+	u32 from = check_room_id( L, 1 );
+	size_t len;
+	const char * command = luaL_checklstring( L, 2, &len );
+
+	if( lua_isnoneornil( L, 3 ) ) {
+		map_remove_exit( from, Span< const char >( command, len ) );
+	}
+	else {
+		map_set_exit( from, Span< const char >( command, len ), check_room_id( L, 3 ), check_cost( L, 4 ) );
+	}
+
+	return 0;
+}
+
+extern "C" int mud_map_get( lua_State * L ) {
+	static DynamicArray< MapExit > exits;
+
+	MapRoom room;
+	if( !map_get_room( check_room_id( L, 1 ), &room, &exits ) )
+		return 0;
+
+	lua_createtable( L, 0, 7 );
+
+	lua_pushlstring( L, room.name.ptr, room.name.n );
+	lua_setfield( L, -2, "name" );
+	lua_pushinteger( L, room.flags );
+	lua_setfield( L, -2, "flags" );
+	lua_pushinteger( L, room.cost );
+	lua_setfield( L, -2, "cost" );
+
+	if( room.has_coords ) {
+		lua_pushinteger( L, room.x );
+		lua_setfield( L, -2, "x" );
+		lua_pushinteger( L, room.y );
+		lua_setfield( L, -2, "y" );
+		lua_pushinteger( L, room.z );
+		lua_setfield( L, -2, "z" );
+	}
+
+	lua_createtable( L, 0, int( exits.size() ) );
+	for( const MapExit & exit : exits ) {
+		lua_pushlstring( L, exit.command.ptr, exit.command.n );
+
+		lua_createtable( L, 0, 2 );
+		lua_pushinteger( L, exit.to );
+		lua_setfield( L, -2, "to" );
+		lua_pushinteger( L, exit.cost );
+		lua_setfield( L, -2, "cost" );
+
+		lua_rawset( L, -3 );
+	}
+	lua_setfield( L, -2, "exits" );
+
+	return 1;
+}
+
+extern "C" int mud_map_find( lua_State * L ) {
+	static DynamicArray< u32 > ids;
+
+	size_t len;
+	const char * name = luaL_checklstring( L, 1, &len );
+	lua_Integer max_results = luaL_checkinteger( L, 2 );
+	luaL_argcheck( L, max_results > 0, 2, "max results must be positive" );
+
+	map_find( Span< const char >( name, len ), size_t( max_results ), &ids );
+
+	lua_createtable( L, int( ids.size() ), 0 );
+	for( size_t i = 0; i < ids.size(); i++ ) {
+		lua_pushinteger( L, ids[ i ] );
+		lua_rawseti( L, -2, int( i + 1 ) );
+	}
+
+	return 1;
+}
+
+// returns a table of commands and the total cost, or nothing if there's
+// no way there
+extern "C" int mud_map_path( lua_State * L ) {
+	static DynamicArray< Span< const char > > commands;
+
+	u32 from = check_room_id( L, 1 );
+	u32 to = check_room_id( L, 2 );
+	u32 avoid = check_flags( L, 3 );
+
+	u32 cost;
+	if( !map_path( from, to, avoid, &commands, &cost ) )
+		return 0;
+
+	lua_createtable( L, int( commands.size() ), 0 );
+	for( size_t i = 0; i < commands.size(); i++ ) {
+		lua_pushlstring( L, commands[ i ].ptr, commands[ i ].n );
+		lua_rawseti( L, -2, int( i + 1 ) );
+	}
+
+	lua_pushinteger( L, cost );
+	return 2;
+}
+
+extern "C" int mud_map_save( lua_State * L ) {
+	const char * path = luaL_checkstring( L, 1 );
+
+	const char * err;
+	if( !map_save( &err, path ) ) {
+		lua_pushnil( L );
+		lua_pushstring( L, err );
+		return 2;
+	}
+
+	lua_pushboolean( L, 1 );
+	return 1;
+}
+
+// leaves the map alone if it fails
+extern "C" int mud_map_load( lua_State * L ) {
+	const char * path = luaL_checkstring( L, 1 );
+
+	const char * err;
+	if( !map_load( &err, path ) ) {
+		lua_pushnil( L );
+		lua_pushstring( L, err );
+		return 2;
+	}
+
+	lua_pushinteger( L, lua_Integer( map_num_rooms() ) );
+	return 1;
+}
+
+extern "C" int mud_map_clear( lua_State * L ) {
+	map_clear();
+	return 0;
+}
+
 } // anon namespace
 
+static constexpr int MAIN_LUA_ARGS = 49;
+
 static void push_exe_dir( lua_State * L ) {
 	int len = wai_getExecutablePath( NULL, 0, NULL );
 	if( len == -1 ) {
@@ -276,9 +1496,16 @@ extern "C" int luaopen_lfs( lua_State * L );
 void script_init() {
 	ZoneScoped;
 
-	lua = luaL_newstate();
+	lua_alloc_init();
+
+	lua = lua_newstate( lua_pool_alloc, NULL );
+	if( lua == NULL )
+		FATAL( "lua_newstate" );
 	luaL_openlibs( lua );
 
+	lua_gc( lua, LUA_GCSTOP, 0 );
+	gc_baseline = lua_alloc_live_bytes();
+
 #if PLATFORM_WINDOWS
 	luaL_requiref( lua, "lpeg", luaopen_lpeg, 0 );
 	lua_pop( lua, 1 );
@@ -287,6 +1514,37 @@ void script_init() {
 	lua_pop( lua, 1 );
 #endif
 
+	{
+		const luaL_Reg methods[] = {
+			{ "text", mud_line_text },
+			{ "raw", mud_line_raw },
+			{ "find", mud_line_find },
+			{ "match", mud_line_match },
+			{ "findRaw", mud_line_find_raw },
+			{ "matchRaw", mud_line_match_raw },
+			{ "number", mud_line_number },
+			{ "gsub", mud_line_gsub },
+			{ "gsubRaw", mud_line_gsub_raw },
+			{ "__tostring", mud_line_text },
+			{ "__len", mud_line_len },
+		};
+
+		luaL_newmetatable( lua, "mud.line" );
+		lua_pushvalue( lua, -1 );
+		lua_setfield( lua, -2, "__index" );
+		for( const luaL_Reg & method : methods ) {
+			lua_pushcfunction( lua, method.func );
+			lua_setfield( lua, -2, method.name );
+		}
+
+		lua_newuserdata( lua, 1 );
+		lua_pushvalue( lua, -2 );
+		lua_setmetatable( lua, -2 );
+		lineUserdataIdx = luaL_ref( lua, LUA_REGISTRYINDEX );
+
+		lua_pop( lua, 1 );
+	}
+
 	lua_getglobal( lua, "debug" );
 	lua_getfield( lua, -1, "traceback" );
 	lua_remove( lua, -2 );
@@ -296,6 +1554,10 @@ void script_init() {
 		exit( 1 );
 	}
 
+	// Lua only promises LUA_MINSTACK free slots and main.lua takes more args
+	// than that
+	luaL_checkstack( lua, MAIN_LUA_ARGS, "main.lua args" );
+
 	lua_pushcfunction( lua, mud_printMain );
 	lua_pushcfunction( lua, mud_newlineMain );
 	lua_pushcfunction( lua, mud_printChat );
@@ -312,14 +1574,58 @@ void script_init() {
 	lua_pushcfunction( lua, mud_close );
 
 	lua_pushcfunction( lua, mud_now );
+	lua_pushcfunction( lua, mud_timer_add );
+	lua_pushcfunction( lua, mud_timer_cancel );
 
 	lua_pushcfunction( lua, mud_set_font );
+	lua_pushcfunction( lua, mud_set_split );
+
+	lua_pushcfunction( lua, mud_window_open );
+	lua_pushcfunction( lua, mud_window_layout );
+	lua_pushcfunction( lua, mud_window_close );
+	lua_pushcfunction( lua, mud_window_print );
+	lua_pushcfunction( lua, mud_window_line );
+
+	lua_pushcfunction( lua, mud_grid_open );
+	lua_pushcfunction( lua, mud_grid_set );
+	lua_pushcfunction( lua, mud_grid_blit );
+	lua_pushcfunction( lua, mud_grid_clear );
+
+	lua_pushcfunction( lua, mud_memstats );
+	lua_pushcfunction( lua, mud_gc );
+	lua_pushcfunction( lua, mud_printLine );
+	lua_pushcfunction( lua, mud_recentLine );
+	lua_pushinteger( lua, RECENT_LINES );
+
+	lua_pushcfunction( lua, mud_highlight_add );
+	lua_pushcfunction( lua, mud_highlight_set );
+	lua_pushcfunction( lua, mud_highlight_remove );
+
+	lua_pushcfunction( lua, mud_find );
+	lua_pushcfunction( lua, mud_find_next );
+	lua_pushcfunction( lua, mud_clear_find );
+
+	lua_pushcfunction( lua, mud_log_open );
+	lua_pushcfunction( lua, mud_log_write );
+	lua_pushcfunction( lua, mud_log_close );
+	lua_pushcfunction( lua, mud_log_session );
+
+	lua_pushcfunction( lua, mud_map_room );
+	lua_pushcfunction( lua, mud_map_remove_room );
+	lua_pushcfunction( lua, mud_map_exit );
+	lua_pushcfunction( lua, mud_map_get );
+	lua_pushcfunction( lua, mud_map_find );
+	lua_pushcfunction( lua, mud_map_path );
+	lua_pushcfunction( lua, mud_map_save );
+	lua_pushcfunction( lua, mud_map_load );
+	lua_pushcfunction( lua, mud_map_clear );
 
 	push_exe_dir( lua );
 
-	pcall( 13, "Error running main.lua" );
+	pcall( MAIN_LUA_ARGS, "Error running main.lua" );
 }
 
 void script_term() {
 	lua_close( lua );
+	lua_alloc_term();
 }
@@ -7,7 +7,12 @@ void script_handleInput( const char * buffer, int len );
 void script_doMacro( const char * key, int len, bool shift, bool ctrl, bool alt );
 void script_handleClose();
 void script_socketData( void * sock, const char * data, size_t len );
-void script_fire_intervals();
+void script_socketLine( void * sock, const char * line, size_t len, bool prompt );
+void script_socketEcho( void * sock, bool echo );
+void script_fire_timers();
+
+// run GC steps for up to budget seconds, call before going idle
+void script_idle( double budget );
 
 void script_init();
 void script_term();
@@ -0,0 +1,494 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "common.h"
+#include "platform.h"
+#include "session_log.h"
+
+#if PLATFORM_WINDOWS
+#include <windows.h>
+#include <io.h>
+#else
+#include <errno.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+/*
+ * log file: LOG_MAGIC then one record per line
+ *
+ *   u16 text_len, u16 num_runs, char text[ text_len ],
+ *   { u16 len, u8 style } runs[ num_runs ]
+ *
+ * index file: INDEX_MAGIC then a u64 log offset for every
+ * SESSION_LOG_INDEX_STRIDE'th line. everything is native endian and
+ * unaligned
+ *
+ * both files are only ever appended to, so if we crash the worst case is a
+ * torn record at the end of the log or an index that's ahead of/behind the
+ * log, and open cleans both up
+ */
+
+static const char LOG_MAGIC[ 8 ] = { 'M', 'G', 'L', 'O', 'G', 0, 0, 1 };
+static const char INDEX_MAGIC[ 8 ] = { 'M', 'G', 'I', 'D', 'X', 0, 0, 1 };
+
+static constexpr size_t RECORD_HEADER_SIZE = 4;
+static constexpr size_t RUN_SIZE = 3;
+static constexpr size_t MAX_RECORD_SIZE = RECORD_HEADER_SIZE + MAX_LINE_LENGTH + MAX_LINE_LENGTH * RUN_SIZE;
+
+struct MappedFile {
+	const u8 * ptr;
+	size_t size;
+#if PLATFORM_WINDOWS
+	HANDLE mapping;
+#endif
+};
+
+struct SessionLog {
+	FILE * data;
+	FILE * index;
+
+	size_t data_size;
+	size_t index_entries;
+	size_t num_lines;
+
+	MappedFile data_map;
+	MappedFile index_map;
+
+	bool failed;
+
+	u8 record[ MAX_RECORD_SIZE ];
+};
+
+#if PLATFORM_WINDOWS
+
+static bool map_file( FILE * file, size_t size, MappedFile * map ) {
+	HANDLE handle = HANDLE( _get_osfhandle( _fileno( file ) ) );
+	HANDLE mapping = CreateFileMappingA( handle, NULL, PAGE_READONLY, 0, 0, NULL );
+	if( mapping == NULL )
+		return false;
+
+	void * ptr = MapViewOfFile( mapping, FILE_MAP_READ, 0, 0, size );
+	if( ptr == NULL ) {
+		CloseHandle( mapping );
+		return false;
+	}
+
+	map->ptr = ( const u8 * ) ptr;
+	map->size = size;
+	map->mapping = mapping;
+	return true;
+}
+
+static void unmap_file( MappedFile * map ) {
+	if( map->ptr == NULL )
+		return;
+	UnmapViewOfFile( map->ptr );
+	CloseHandle( map->mapping );
+	*map = { };
+}
+
+static bool truncate_file( FILE * file, size_t size ) {
+	return _chsize_s( _fileno( file ), size ) == 0;
+}
+
+static bool make_dir( const char * path ) {
+	return CreateDirectoryA( path, NULL ) != 0 || GetLastError() == ERROR_ALREADY_EXISTS;
+}
+
+#else
+
+static bool map_file( FILE * file, size_t size, MappedFile * map ) {
+	void * ptr = mmap( NULL, size, PROT_READ, MAP_SHARED, fileno( file ), 0 );
+	if( ptr == MAP_FAILED )
+		return false;
+
+	map->ptr = ( const u8 * ) ptr;
+	map->size = size;
+	return true;
+}
+
+static void unmap_file( MappedFile * map ) {
+	if( map->ptr == NULL )
+		return;
+	munmap( ( void * ) map->ptr, map->size );
+	*map = { };
+}
+
+static bool truncate_file( FILE * file, size_t size ) {
+	return ftruncate( fileno( file ), off_t( size ) ) == 0;
+}
+
+static bool make_dir( const char * path ) {
+	return mkdir( path, 0755 ) == 0 || errno == EEXIST;
+}
+
+#endif
+
+// makes sure [ 0, size ) is mapped, flushing anything we've buffered first
+static bool ensure_mapped( FILE * file, MappedFile * map, size_t size ) {
+	if( map->ptr != NULL && map->size >= size )
+		return true;
+
+	if( fflush( file ) != 0 )
+		return false;
+
+	unmap_file( map );
+	return map_file( file, size, map );
+}
+
+static u16 load_u16( const u8 * p ) {
+	u16 x;
+	memcpy( &x, p, sizeof( x ) );
+	return x;
+}
+
+static u64 load_u64( const u8 * p ) {
+	u64 x;
+	memcpy( &x, p, sizeof( x ) );
+	return x;
+}
+
+static void store_u16( u8 * p, u16 x ) {
+	memcpy( p, &x, sizeof( x ) );
+}
+
+// returns the size of the record at data, or 0 if it's torn or damaged
+static size_t decode_record( const u8 * data, size_t size, TextBox::Line * line ) {
+	if( size < RECORD_HEADER_SIZE )
+		return 0;
+
+	size_t len = load_u16( data );
+	size_t num_runs = load_u16( data + 2 );
+	size_t record_size = RECORD_HEADER_SIZE + len + num_runs * RUN_SIZE;
+	if( len > MAX_LINE_LENGTH || num_runs > len || record_size > size )
+		return 0;
+
+	const char * text = ( const char * ) data + RECORD_HEADER_SIZE;
+	const u8 * runs = data + RECORD_HEADER_SIZE + len;
+
+	size_t covered = 0;
+	for( size_t i = 0; i < num_runs; i++ ) {
+		size_t run_len = load_u16( runs + i * RUN_SIZE );
+		u8 style = runs[ i * RUN_SIZE + 2 ];
+		if( run_len == 0 || run_len > len - covered )
+			return 0;
+
+		if( line != NULL ) {
+			for( size_t j = covered; j < covered + run_len; j++ ) {
+				line->glyphs[ j ].ch = text[ j ];
+				line->glyphs[ j ].style = style;
+			}
+		}
+
+		covered += run_len;
+	}
+
+	if( covered != len )
+		return 0;
+
+	if( line != NULL )
+		line->len = len;
+
+	return record_size;
+}
+
+static FILE * open_with_magic( const char * path, const char * magic, size_t * size ) {
+	FILE * file = fopen( path, "r+b" );
+	if( file == NULL ) {
+		file = fopen( path, "w+b" );
+		if( file == NULL )
+			return NULL;
+	}
+
+	char header[ sizeof( LOG_MAGIC ) ];
+	bool ok = fread( header, sizeof( header ), 1, file ) == 1 && memcmp( header, magic, sizeof( header ) ) == 0;
+
+	// start again if it's empty or not something we understand
+	if( !ok ) {
+		if( !truncate_file( file, 0 ) || fseek( file, 0, SEEK_SET ) != 0 || fwrite( magic, sizeof( header ), 1, file ) != 1 ) {
+			fclose( file );
+			return NULL;
+		}
+	}
+
+	if( fseek( file, 0, SEEK_END ) != 0 ) {
+		fclose( file );
+		return NULL;
+	}
+
+	long end = ftell( file );
+	if( end < 0 ) {
+		fclose( file );
+		return NULL;
+	}
+
+	*size = size_t( end );
+	return file;
+}
+
+static bool write_index_entry( SessionLog * log, u64 offset ) {
+	if( fwrite( &offset, sizeof( offset ), 1, log->index ) != 1 )
+		return false;
+	log->index_entries++;
+	return true;
+}
+
+/*
+ * the index can be ahead of the log if the log's buffer didn't make it to
+ * disk, or behind it if the index's buffer didn't. drop index entries that
+ * point past the log, then walk the log from the last good entry to count
+ * lines, indexing as we go and cutting off anything torn
+ */
+static bool recover( SessionLog * log, size_t index_size ) {
+	ZoneScoped;
+
+	size_t entries = ( index_size - sizeof( INDEX_MAGIC ) ) / sizeof( u64 );
+
+	if( log->data_size > sizeof( LOG_MAGIC ) && !ensure_mapped( log->data, &log->data_map, log->data_size ) )
+		return false;
+	if( entries > 0 && !ensure_mapped( log->index, &log->index_map, index_size ) )
+		return false;
+
+	size_t start, lines, walked;
+	while( true ) {
+		start = sizeof( LOG_MAGIC );
+		if( entries > 0 )
+			start = size_t( load_u64( log->index_map.ptr + sizeof( INDEX_MAGIC ) + ( entries - 1 ) * sizeof( u64 ) ) );
+
+		if( start < sizeof( LOG_MAGIC ) || start >= log->data_size ) {
+			if( entries == 0 )
+				break;
+			entries--;
+			continue;
+		}
+
+		size_t first = decode_record( log->data_map.ptr + start, log->data_size - start, NULL );
+		if( first == 0 && entries > 0 ) {
+			entries--;
+			continue;
+		}
+
+		break;
+	}
+
+	lines = entries > 0 ? ( entries - 1 ) * SESSION_LOG_INDEX_STRIDE : 0;
+	walked = start;
+
+	unmap_file( &log->index_map );
+	if( !truncate_file( log->index, sizeof( INDEX_MAGIC ) + entries * sizeof( u64 ) ) || fseek( log->index, 0, SEEK_END ) != 0 )
+		return false;
+	log->index_entries = entries;
+
+	while( walked < log->data_size ) {
+		size_t record_size = decode_record( log->data_map.ptr + walked, log->data_size - walked, NULL );
+		if( record_size == 0 )
+			break;
+
+		if( lines % SESSION_LOG_INDEX_STRIDE == 0 && lines / SESSION_LOG_INDEX_STRIDE >= log->index_entries ) {
+			if( !write_index_entry( log, walked ) )
+				return false;
+		}
+
+		walked += record_size;
+		lines++;
+	}
+
+	unmap_file( &log->data_map );
+	if( walked != log->data_size ) {
+		if( !truncate_file( log->data, walked ) )
+			return false;
+		log->data_size = walked;
+	}
+
+	if( fseek( log->data, 0, SEEK_END ) != 0 )
+		return false;
+
+	log->num_lines = lines;
+	return true;
+}
+
+SessionLog * session_log_open( const char ** err, const char * path ) {
+	ZoneScoped;
+
+	size_t path_len = strlen( path );
+	char * index_path = alloc_many< char >( path_len + sizeof( ".idx" ) );
+	memcpy( index_path, path, path_len );
+	memcpy( index_path + path_len, ".idx", sizeof( ".idx" ) );
+
+	SessionLog * log = alloc< SessionLog >();
+	*log = { };
+
+	size_t index_size;
+	log->data = open_with_magic( path, LOG_MAGIC, &log->data_size );
+	log->index = log->data == NULL ? NULL : open_with_magic( index_path, INDEX_MAGIC, &index_size );
+	free( index_path );
+
+	bool ok = false;
+	if( log->data == NULL )
+		*err = "couldn't open the log";
+	else if( log->index == NULL )
+		*err = "couldn't open the log's index";
+	else if( !recover( log, index_size ) )
+		*err = "couldn't read the log";
+	else
+		ok = true;
+
+	if( !ok ) {
+		session_log_close( log );
+		return NULL;
+	}
+
+	return log;
+}
+
+// if we can't tell how big it is, assume it's too big
+static bool too_big( const char * path ) {
+	FILE * file = fopen( path, "rb" );
+	if( file == NULL )
+		return false;
+
+	long size = fseek( file, 0, SEEK_END ) == 0 ? ftell( file ) : -1;
+	fclose( file );
+
+	return size < 0 || size_t( size ) >= SESSION_LOG_MAX_SIZE;
+}
+
+SessionLog * session_log_open_default( const char ** err ) {
+#if PLATFORM_WINDOWS
+	const char * home = getenv( "APPDATA" );
+	const char * dir_name = "\\Mud Gangster";
+	const char * file_name = "\\session.log";
+#else
+	const char * home = getenv( "HOME" );
+	const char * dir_name = "/.mudgangster";
+	const char * file_name = "/session.log";
+#endif
+
+	if( home == NULL ) {
+		*err = "couldn't find the home directory";
+		return NULL;
+	}
+
+	char dir[ 1024 ];
+	char path[ 1024 ];
+	char index_path[ 1024 ];
+	if( size_t( snprintf( dir, sizeof( dir ), "%s%s", home, dir_name ) ) >= sizeof( dir ) ||
+	    size_t( snprintf( path, sizeof( path ), "%s%s", dir, file_name ) ) >= sizeof( path ) ||
+	    size_t( snprintf( index_path, sizeof( index_path ), "%s.idx", path ) ) >= sizeof( index_path ) ) {
+		*err = "the path is too long";
+		return NULL;
+	}
+
+	if( !make_dir( dir ) ) {
+		*err = "couldn't create the directory";
+		return NULL;
+	}
+
+	// the index is useless without the log so they go together
+	if( too_big( path ) ) {
+		remove( path );
+		remove( index_path );
+	}
+
+	return session_log_open( err, path );
+}
+
+void session_log_close( SessionLog * log ) {
+	if( log == NULL )
+		return;
+
+	unmap_file( &log->data_map );
+	unmap_file( &log->index_map );
+
+	if( log->data != NULL )
+		fclose( log->data );
+	if( log->index != NULL )
+		fclose( log->index );
+
+	free( log );
+}
+
+void session_log_append( SessionLog * log, const TextBox::Line & line ) {
+	if( log->failed )
+		return;
+
+	ASSERT( line.len <= MAX_LINE_LENGTH );
+
+	u8 * text = log->record + RECORD_HEADER_SIZE;
+	u8 * runs = text + line.len;
+	size_t num_runs = 0;
+
+	for( size_t i = 0; i < line.len; ) {
+		u8 style = line.glyphs[ i ].style;
+		size_t run_end = i;
+		while( run_end < line.len && line.glyphs[ run_end ].style == style ) {
+			text[ run_end ] = u8( line.glyphs[ run_end ].ch );
+			run_end++;
+		}
+
+		store_u16( runs + num_runs * RUN_SIZE, u16( run_end - i ) );
+		runs[ num_runs * RUN_SIZE + 2 ] = style;
+		num_runs++;
+
+		i = run_end;
+	}
+
+	store_u16( log->record, u16( line.len ) );
+	store_u16( log->record + 2, u16( num_runs ) );
+	size_t record_size = RECORD_HEADER_SIZE + line.len + num_runs * RUN_SIZE;
+
+	bool ok = true;
+	if( log->num_lines % SESSION_LOG_INDEX_STRIDE == 0 )
+		ok = write_index_entry( log, log->data_size );
+	ok = ok && fwrite( log->record, record_size, 1, log->data ) == 1;
+
+	// the line numbers are wrong from here on so stop paging from the log
+	if( !ok ) {
+		log->failed = true;
+		return;
+	}
+
+	log->data_size += record_size;
+	log->num_lines++;
+}
+
+size_t session_log_num_lines( const SessionLog * log ) {
+	return log->failed ? 0 : log->num_lines;
+}
+
+bool session_log_read( SessionLog * log, size_t idx, TextBox::Line * line ) {
+	ZoneScoped;
+
+	if( log->failed || idx >= log->num_lines )
+		return false;
+
+	size_t entry = idx / SESSION_LOG_INDEX_STRIDE;
+	bool last_entry = entry + 1 == log->index_entries;
+	size_t entries_needed = last_entry ? entry + 1 : entry + 2;
+	if( !ensure_mapped( log->index, &log->index_map, sizeof( INDEX_MAGIC ) + entries_needed * sizeof( u64 ) ) )
+		return false;
+
+	const u8 * entries = log->index_map.ptr + sizeof( INDEX_MAGIC );
+	size_t offset = size_t( load_u64( entries + entry * sizeof( u64 ) ) );
+
+	// only the stride we want has to be mapped, so reading old lines while
+	// new ones arrive doesn't remap every time
+	size_t stride_end = last_entry ? log->data_size : size_t( load_u64( entries + ( entry + 1 ) * sizeof( u64 ) ) );
+	if( offset >= stride_end || stride_end > log->data_size )
+		return false;
+	if( !ensure_mapped( log->data, &log->data_map, stride_end ) )
+		return false;
+
+	// skip to the line we want within the stride
+	for( size_t i = entry * SESSION_LOG_INDEX_STRIDE; i < idx; i++ ) {
+		size_t record_size = decode_record( log->data_map.ptr + offset, stride_end - offset, NULL );
+		if( record_size == 0 )
+			return false;
+		offset += record_size;
+	}
+
+	return decode_record( log->data_map.ptr + offset, stride_end - offset, line ) != 0;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include "textbox.h"
+
+/*
+ * every line committed to the main window gets appended to a log on disk so
+ * scrollback survives the in-memory ring and previous sessions. a line is
+ * stored as its text followed by its style runs, and a sparse index records
+ * where every SESSION_LOG_INDEX_STRIDE'th line starts. reads go through
+ * read-only mappings of both files, so opening a huge log costs nothing and
+ * only the pages we scroll over get loaded
+ *
+ * the default log lives in ~/.mudgangster or %APPDATA%\Mud Gangster. it's
+ * checked against SESSION_LOG_MAX_SIZE when the client starts and thrown
+ * away once it gets that big, so one long session can go over. delete
+ * session.log and session.log.idx to clear it by hand
+ */
+
+constexpr size_t SESSION_LOG_INDEX_STRIDE = 64;
+constexpr size_t SESSION_LOG_MAX_SIZE = 256 * 1024 * 1024;
+
+struct SessionLog;
+
+// returns NULL and sets err if the log can't be opened, in which case we
+// don't log
+SessionLog * session_log_open( const char ** err, const char * path );
+SessionLog * session_log_open_default( const char ** err );
+void session_log_close( SessionLog * log );
+
+void session_log_append( SessionLog * log, const TextBox::Line & line );
+
+// 0 if writing has failed, so callers stop paging from a log that's missing
+// lines
+size_t session_log_num_lines( const SessionLog * log );
+
+// returns false if the line is out of range or damaged
+bool session_log_read( SessionLog * log, size_t idx, TextBox::Line * line );
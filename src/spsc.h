@@ -0,0 +1,277 @@
+#pragma once
+
+#include <atomic>
+
+#include "common.h"
+
+/*
+ * lock-free single producer/single consumer rings
+ *
+ * the producer and consumer each work on a private cursor and only
+ * publish it on commit/release, so a batch of pushes or pops costs one
+ * atomic store. commit returns true when the consumer had run dry before
+ * the batch and needs waking up, release returns true when the producer
+ * gave up for lack of space and needs waking up. use a Wakeup from
+ * wakeup.h for that
+ *
+ * the cursors sit on their own cache lines, so rings need to live in
+ * static storage or somewhere else that respects alignas
+ */
+
+constexpr size_t CACHE_LINE_SIZE = 64;
+
+class SPSCRingBase {
+protected:
+	// written by the consumer
+	alignas( CACHE_LINE_SIZE ) std::atomic< size_t > head;
+	size_t read_pos;
+	size_t cached_tail;
+
+	// written by the producer
+	alignas( CACHE_LINE_SIZE ) std::atomic< size_t > tail;
+	std::atomic< bool > producer_blocked;
+	size_t write_pos;
+	size_t published_pos;
+	size_t cached_head;
+
+	alignas( CACHE_LINE_SIZE ) u8 * buf;
+	size_t capacity;
+
+	SPSCRingBase( size_t capacity_ ) {
+		ASSERT( capacity_ >= 64 && ( capacity_ & ( capacity_ - 1 ) ) == 0 );
+
+		capacity = capacity_;
+		buf = alloc_many< u8 >( capacity );
+
+		head.store( 0 );
+		tail.store( 0 );
+		producer_blocked.store( false );
+		read_pos = 0;
+		cached_tail = 0;
+		write_pos = 0;
+		published_pos = 0;
+		cached_head = 0;
+	}
+
+	~SPSCRingBase() {
+		free( buf );
+	}
+
+	size_t free_space() {
+		return capacity - ( write_pos - cached_head );
+	}
+
+	bool ensure_space( size_t n ) {
+		if( free_space() >= n )
+			return true;
+
+		cached_head = head.load( std::memory_order_acquire );
+		if( free_space() >= n )
+			return true;
+
+		// tell the consumer we're waiting then check again in case it
+		// released before it could see the flag
+		producer_blocked.store( true, std::memory_order_seq_cst );
+		cached_head = head.load( std::memory_order_seq_cst );
+		if( free_space() >= n ) {
+			producer_blocked.store( false, std::memory_order_relaxed );
+			return true;
+		}
+
+		return false;
+	}
+
+	size_t readable() {
+		// seq_cst pairs with commit so a consumer that releases and then
+		// finds the ring empty can't miss a wakeup
+		if( cached_tail == read_pos )
+			cached_tail = tail.load( std::memory_order_seq_cst );
+		return cached_tail - read_pos;
+	}
+
+public:
+	NONCOPYABLE( SPSCRingBase );
+
+	// producer
+
+	bool commit() {
+		if( write_pos == published_pos )
+			return false;
+
+		size_t old_tail = published_pos;
+		tail.store( write_pos, std::memory_order_seq_cst );
+		published_pos = write_pos;
+
+		return head.load( std::memory_order_seq_cst ) == old_tail;
+	}
+
+	// check there's room for n more bytes, including framing. if there isn't
+	// the producer is marked as blocked and the next release returns true
+	bool has_space( size_t n ) {
+		return ensure_space( n );
+	}
+
+	// consumer
+
+	bool release() {
+		if( head.load( std::memory_order_relaxed ) == read_pos )
+			return false;
+
+		head.store( read_pos, std::memory_order_seq_cst );
+		return producer_blocked.exchange( false, std::memory_order_seq_cst );
+	}
+
+	bool empty() {
+		return readable() == 0;
+	}
+};
+
+/*
+ * variable sized messages, each one is contiguous in memory so they can be
+ * written in place with reserve and read in place with pop
+ */
+class SPSCRing : public SPSCRingBase {
+	static constexpr u32 WRAP = UINT32_MAX;
+	static constexpr size_t ALIGNMENT = 8;
+
+	static size_t framed_size( size_t n ) {
+		return ( sizeof( u32 ) + n + ALIGNMENT - 1 ) & ~( ALIGNMENT - 1 );
+	}
+
+public:
+	SPSCRing( size_t capacity_ ) : SPSCRingBase( capacity_ ) { }
+
+	// worst case number of ring bytes used by a message with n bytes of payload
+	static size_t max_framed_size( size_t n ) {
+		return framed_size( n ) * 2;
+	}
+
+	// returns NULL if the ring is full, the message isn't visible until commit
+	void * reserve( size_t n ) {
+		size_t size = framed_size( n );
+		ASSERT( size <= capacity / 2 );
+
+		size_t offset = write_pos & ( capacity - 1 );
+		size_t contiguous = capacity - offset;
+		size_t padding = contiguous < size ? contiguous : 0;
+
+		if( !ensure_space( padding + size ) )
+			return NULL;
+
+		if( padding > 0 ) {
+			u32 wrap = WRAP;
+			memcpy( buf + offset, &wrap, sizeof( wrap ) );
+			write_pos += padding;
+			offset = 0;
+		}
+
+		u32 len = checked_cast< u32 >( n );
+		memcpy( buf + offset, &len, sizeof( len ) );
+		write_pos += size;
+
+		return buf + offset + sizeof( len );
+	}
+
+	bool push( const void * data, size_t n ) {
+		void * p = reserve( n );
+		if( p == NULL )
+			return false;
+		memcpy( p, data, n );
+		return true;
+	}
+
+	// the message stays valid until the next release
+	bool pop( Span< const u8 > * msg ) {
+		while( readable() > 0 ) {
+			size_t offset = read_pos & ( capacity - 1 );
+
+			u32 len;
+			memcpy( &len, buf + offset, sizeof( len ) );
+
+			if( len == WRAP ) {
+				read_pos += capacity - offset;
+				continue;
+			}
+
+			*msg = Span< const u8 >( buf + offset + sizeof( len ), len );
+			read_pos += framed_size( len );
+			return true;
+		}
+
+		return false;
+	}
+};
+
+/*
+ * a plain stream of bytes. reserve/peek hand out the largest contiguous
+ * region so the caller can read/write in place, write/read copy and
+ * handle the wraparound for you
+ */
+class SPSCByteRing : public SPSCRingBase {
+public:
+	SPSCByteRing( size_t capacity_ ) : SPSCRingBase( capacity_ ) { }
+
+	// producer
+
+	Span< u8 > reserve() {
+		ensure_space( 1 );
+
+		size_t offset = write_pos & ( capacity - 1 );
+		size_t contiguous = capacity - offset;
+		return Span< u8 >( buf + offset, min( contiguous, free_space() ) );
+	}
+
+	void advance( size_t n ) {
+		ASSERT( n <= free_space() );
+		write_pos += n;
+	}
+
+	// all or nothing, returns false if there isn't room for the whole thing
+	bool write( const void * data, size_t n ) {
+		if( !ensure_space( n ) )
+			return false;
+
+		const u8 * bytes = ( const u8 * ) data;
+		while( n > 0 ) {
+			Span< u8 > dst = reserve();
+			size_t chunk = min( n, dst.n );
+			memcpy( dst.ptr, bytes, chunk );
+			advance( chunk );
+			bytes += chunk;
+			n -= chunk;
+		}
+
+		return true;
+	}
+
+	// consumer
+
+	Span< const u8 > peek() {
+		size_t offset = read_pos & ( capacity - 1 );
+		size_t contiguous = capacity - offset;
+		return Span< const u8 >( buf + offset, min( contiguous, readable() ) );
+	}
+
+	void consume( size_t n ) {
+		ASSERT( n <= readable() );
+		read_pos += n;
+	}
+
+	size_t read( void * data, size_t n ) {
+		u8 * bytes = ( u8 * ) data;
+		size_t total = 0;
+
+		while( total < n ) {
+			Span< const u8 > src = peek();
+			if( src.n == 0 )
+				break;
+
+			size_t chunk = min( n - total, src.n );
+			memcpy( bytes + total, src.ptr, chunk );
+			consume( chunk );
+			total += chunk;
+		}
+
+		return total;
+	}
+};
@@ -0,0 +1,97 @@
+#include "common.h"
+#include "telnet.h"
+
+enum TelnetState {
+	STATE_DATA,
+	STATE_IAC,
+	STATE_OPTION,
+	STATE_SUBNEGOTIATION,
+	STATE_SUBNEGOTIATION_IAC,
+};
+
+enum TelnetByte : u8 {
+	TELNET_SE = 240,
+	TELNET_EOR = 239,
+	TELNET_GA = 249,
+	TELNET_SB = 250,
+	TELNET_WILL = 251,
+	TELNET_WONT = 252,
+	TELNET_DO = 253,
+	TELNET_DONT = 254,
+	TELNET_IAC = 255,
+
+	TELNET_OPT_ECHO = 1,
+};
+
+void telnet_init( TelnetDecoder * telnet ) {
+	telnet->state = STATE_DATA;
+	telnet->verb = 0;
+	telnet->line.clear();
+}
+
+static void flush( TelnetDecoder * telnet, TelnetEventType type, TelnetCallback callback, void * user ) {
+	callback( user, type, telnet->line.ptr(), telnet->line.size() );
+	telnet->line.clear();
+}
+
+static void add_char( TelnetDecoder * telnet, u8 c, TelnetCallback callback, void * user ) {
+	if( telnet->line.size() == TELNET_MAX_LINE_LENGTH )
+		flush( telnet, TELNET_LINE, callback, user );
+	telnet->line.add( char( c ) );
+}
+
+void telnet_decode( TelnetDecoder * telnet, const char * data, size_t len, TelnetCallback callback, void * user ) {
+	ZoneScoped;
+
+	for( size_t i = 0; i < len; i++ ) {
+		u8 c = u8( data[ i ] );
+
+		switch( telnet->state ) {
+			case STATE_DATA:
+				if( c == TELNET_IAC )
+					telnet->state = STATE_IAC;
+				else if( c == '\n' )
+					flush( telnet, TELNET_LINE, callback, user );
+				else if( c != '\r' )
+					add_char( telnet, c, callback, user );
+				break;
+
+			case STATE_IAC:
+				telnet->state = STATE_DATA;
+
+				if( c == TELNET_IAC ) {
+					add_char( telnet, c, callback, user );
+				}
+				else if( c == TELNET_GA || c == TELNET_EOR ) {
+					flush( telnet, TELNET_PROMPT, callback, user );
+				}
+				else if( c == TELNET_SB ) {
+					telnet->state = STATE_SUBNEGOTIATION;
+				}
+				else if( c >= TELNET_WILL && c <= TELNET_DONT ) {
+					telnet->verb = c;
+					telnet->state = STATE_OPTION;
+				}
+				break;
+
+			case STATE_OPTION:
+				telnet->state = STATE_DATA;
+
+				// we never reply to negotiation, the server treats that as a refusal
+				if( c == TELNET_OPT_ECHO && telnet->verb == TELNET_WILL )
+					callback( user, TELNET_ECHO_OFF, NULL, 0 );
+				else if( c == TELNET_OPT_ECHO && telnet->verb == TELNET_WONT )
+					callback( user, TELNET_ECHO_ON, NULL, 0 );
+				break;
+
+			case STATE_SUBNEGOTIATION:
+				if( c == TELNET_IAC )
+					telnet->state = STATE_SUBNEGOTIATION_IAC;
+				break;
+
+			case STATE_SUBNEGOTIATION_IAC:
+				telnet->state = c == TELNET_SE ? STATE_DATA : STATE_SUBNEGOTIATION;
+				break;
+		}
+	}
+}
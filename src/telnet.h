@@ -0,0 +1,31 @@
+#pragma once
+
+#include "common.h"
+#include "array.h"
+
+enum TelnetEventType {
+	TELNET_LINE,
+	TELNET_PROMPT,
+	TELNET_ECHO_ON,
+	TELNET_ECHO_OFF,
+};
+
+struct TelnetDecoder {
+	int state;
+	u8 verb;
+	DynamicArray< char > line;
+};
+
+// longer lines get split so consumers can bound how much one read produces
+constexpr size_t TELNET_MAX_LINE_LENGTH = 16384;
+
+typedef void ( *TelnetCallback )( void * user, TelnetEventType type, const char * data, size_t len );
+
+/*
+ * strips \r and telnet negotiation, splits the stream into lines and
+ * prompts (text terminated by GA/EOR) and reports echo changes. partial
+ * lines are kept in the decoder until the rest arrives
+ */
+void telnet_decode( TelnetDecoder * telnet, const char * data, size_t len, TelnetCallback callback, void * user );
+
+void telnet_init( TelnetDecoder * telnet );
@@ -1,7 +1,10 @@
 #include <string.h>
+#include <ctype.h>
 
 #include "common.h"
+#include "highlight.h"
 #include "textbox.h"
+#include "session_log.h"
 #include "ui.h"
 #include "platform.h"
 #include "platform_ui.h"
@@ -33,80 +36,505 @@ static void unpack_style( u8 style, int * fg, int * bg, int * bold ) {
 	*fg = style;
 }
 
-void textbox_init( TextBox * tb, size_t scrollback ) {
+void textbox_init( TextBox * tb, size_t scrollback, SessionLog * log ) {
 	ZoneScoped;
 
 	// TODO: this is kinda crap
 	*tb = { };
 	tb->lines = alloc_span< TextBox::Line >( scrollback );
 	memset( tb->lines.ptr, 0, tb->lines.num_bytes() );
+	tb->trigrams = alloc_span< TextBox::Trigrams >( scrollback );
+	memset( tb->trigrams.ptr, 0, tb->trigrams.num_bytes() );
+	tb->wraps = alloc_span< TextBox::Wrap >( scrollback );
+	memset( tb->wraps.ptr, 0, tb->wraps.num_bytes() );
 	tb->num_lines = 1;
 	tb->max_lines = scrollback;
+	tb->log = log;
+
+	// carry on numbering from the end of the log
+	if( log != NULL )
+		tb->newest_id = session_log_num_lines( log );
+	tb->scroll_id = tb->newest_id;
 }
 
 void textbox_destroy( TextBox * tb ) {
 	free( tb->lines.ptr );
+	free( tb->trigrams.ptr );
+	free( tb->wraps.ptr );
+}
+
+static size_t line_index( const TextBox * tb, u64 id ) {
+	return size_t( id % tb->max_lines );
+}
+
+static u64 oldest_ring_id( const TextBox * tb ) {
+	return tb->newest_id + 1 - tb->num_lines;
+}
+
+// the oldest line we can scroll to, including anything paged from the log.
+// the committed lines in the ring are always the newest lines in the log
+static u64 oldest_id( const TextBox * tb ) {
+	if( tb->log != NULL && session_log_num_lines( tb->log ) > 0 )
+		return 0;
+	return oldest_ring_id( tb );
+}
+
+// lines older than the ring get decoded into scratch
+static const TextBox::Line & get_line( const TextBox * tb, u64 id, TextBox::Line * scratch ) {
+	if( id >= oldest_ring_id( tb ) )
+		return tb->lines[ line_index( tb, id ) ];
+
+	if( !session_log_read( tb->log, size_t( id ), scratch ) )
+		scratch->len = 0;
+	return *scratch;
+}
+
+static bool at_bottom( const TextBox * tb ) {
+	return tb->scroll_id == tb->newest_id && tb->scroll_row == 0;
+}
+
+static size_t num_rows( size_t h ) {
+	int fw, fh;
+	ui_get_font_size( &fw, &fh );
+	return h / ( fh + SPACING );
+}
+
+static size_t num_cols( size_t w ) {
+	int fw, fh;
+	ui_get_font_size( &fw, &fh );
+	return max( w / fw, size_t( 1 ) );
+}
+
+/*
+ * when we're scrolled back and split_rows is set, the bottom of the textbox
+ * keeps showing the newest lines under a divider. the newest lines' pane
+ * doesn't have an anchor of its own, it always shows the bottom
+ */
+struct Pane {
+	int y, h;
+	u64 scroll_id;
+	size_t scroll_row;
+};
+
+// 0 if there's no split or it wouldn't leave a row above it
+static int tail_height( const TextBox * tb ) {
+	int fw, fh;
+	ui_get_font_size( &fw, &fh );
+
+	int tail = int( tb->split_rows ) * ( fh + SPACING );
+	if( tail == 0 || tail + 1 + fh + SPACING > tb->h )
+		return 0;
+	return tail;
+}
+
+static size_t get_panes( const TextBox * tb, Pane * panes ) {
+	int tail = at_bottom( tb ) ? 0 : tail_height( tb );
+	if( tail == 0 ) {
+		panes[ 0 ] = { tb->y, tb->h, tb->scroll_id, tb->scroll_row };
+		return 1;
+	}
+
+	panes[ 0 ] = { tb->y, tb->h - tail - 1, tb->scroll_id, tb->scroll_row };
+	panes[ 1 ] = { tb->y + tb->h - tail, tail, tb->newest_id, 0 };
+	return 2;
+}
+
+static bool split( const TextBox * tb ) {
+	return !at_bottom( tb ) && tail_height( tb ) > 0;
+}
+
+// rows in the pane that scrolls. counts the split even when we're at the
+// bottom so paging up a screenful doesn't go under the divider
+static size_t scrolled_rows( const TextBox * tb ) {
+	int tail = tail_height( tb );
+	return num_rows( tail == 0 ? tb->h : tb->h - tail - 1 );
+}
+
+static char fold( char c ) {
+	return char( tolower( u8( c ) ) );
+}
+
+static void add_trigram( TextBox::Trigrams * trigrams, char a, char b, char c ) {
+	u32 hash = u32( u8( fold( a ) ) ) | u32( u8( fold( b ) ) ) << 8 | u32( u8( fold( c ) ) ) << 16;
+	hash *= 0x9E3779B1;
+	u32 bit = hash >> ( 32 - 8 );
+	trigrams->bits[ bit / 64 ] |= u64( 1 ) << ( bit % 64 );
 }
 
 void textbox_add( TextBox * tb, const char * str, size_t len, Colour fg, Colour bg, bool bold ) {
-	TextBox::Line * line = &tb->lines[ ( tb->head + tb->num_lines ) % tb->max_lines ];
+	size_t idx = line_index( tb, tb->newest_id );
+	TextBox::Line * line = &tb->lines[ idx ];
+	TextBox::Trigrams * trigrams = &tb->trigrams[ idx ];
 	size_t remaining = MAX_LINE_LENGTH - line->len;
-	size_t n = min( strlen( str ), remaining );
+	size_t n = min( len, remaining );
 
 	for( size_t i = 0; i < n; i++ ) {
-		TextBox::Glyph & glyph = line->glyphs[ line->len + i ];
+		size_t pos = line->len + i;
+		TextBox::Glyph & glyph = line->glyphs[ pos ];
 		glyph.ch = str[ i ];
 		glyph.style = pack_style( fg, bg, bold );
+
+		if( pos >= 2 )
+			add_trigram( trigrams, line->glyphs[ pos - 2 ].ch, line->glyphs[ pos - 1 ].ch, glyph.ch );
 	};
 
 	line->len += n;
-	tb->dirty = true;
+	tb->wraps[ idx ] = { };
+
+	if( split( tb ) )
+		tb->tail_dirty = true;
+	else
+		tb->dirty = true;
 }
 
+/*
+ * everything that refers to a line does it by id, so nothing needs fixing
+ * up when a line gets committed. only things pointing at lines that just
+ * fell out of the ring need to let go
+ */
 void textbox_newline( TextBox * tb ) {
-	bool freeze = tb->scroll_offset > 0 || tb->selecting;
+	bool follow = !tb->selecting && at_bottom( tb );
 
-	if( tb->num_lines < tb->max_lines ) {
+	if( tb->log != NULL )
+		session_log_append( tb->log, tb->lines[ line_index( tb, tb->newest_id ) ] );
+
+	tb->newest_id++;
+	if( tb->num_lines < tb->max_lines )
 		tb->num_lines++;
-		if( freeze )
-			tb->scroll_offset++;
-		else
-			tb->dirty = true;
-		return;
+
+	// this evicts the oldest line once the ring is full
+	size_t idx = line_index( tb, tb->newest_id );
+	tb->lines[ idx ].len = 0;
+	tb->trigrams[ idx ] = { };
+	tb->wraps[ idx ] = { };
+
+	if( follow ) {
+		tb->scroll_id = tb->newest_id;
+		tb->dirty = true;
+	}
+	else if( tb->scroll_id < oldest_id( tb ) ) {
+		tb->scroll_id = oldest_id( tb );
+		tb->scroll_row = 0;
+		tb->dirty = true;
+	}
+	else if( split( tb ) ) {
+		tb->tail_dirty = true;
 	}
 
-	tb->head++;
-	if( freeze )
-		tb->scroll_offset = min( tb->scroll_offset + 1, tb->num_lines - 1 );
-	tb->dirty = true;
+	if( tb->search_found && tb->search_match < oldest_ring_id( tb ) )
+		tb->search_found = false;
+}
+
+/*
+ * lines wrap at the last space that fits, or mid-word if a word is wider
+ * than the textbox. the space stays at the end of the upper row
+ */
+static size_t wrap_line( const TextBox::Line & line, size_t cols, u32 * starts ) {
+	size_t rows = 0;
+	size_t start = 0;
+
+	while( true ) {
+		if( starts != NULL )
+			starts[ rows ] = u32( start );
+		rows++;
+
+		if( line.len - start <= cols )
+			return rows;
+
+		size_t end = start + cols;
+		for( size_t i = end; i > start + 1; i-- ) {
+			if( line.glyphs[ i - 1 ].ch == ' ' ) {
+				end = i;
+				break;
+			}
+		}
+
+		start = end;
+	}
+}
+
+/*
+ * returns how many rows a line takes up, and fills starts with the offset
+ * each row begins at if it's not NULL. lines in the ring remember their row
+ * count for the last width they were wrapped at, which is all hit testing
+ * needs and lets drawing skip the scan for lines that fit on one row
+ */
+static size_t wrap( TextBox * tb, u64 id, const TextBox::Line & line, size_t cols, u32 * starts ) {
+	TextBox::Wrap * cached = NULL;
+	if( id >= oldest_ring_id( tb ) ) {
+		cached = &tb->wraps[ line_index( tb, id ) ];
+		if( cached->cols == cols && ( starts == NULL || cached->rows == 1 ) ) {
+			if( starts != NULL )
+				starts[ 0 ] = 0;
+			return cached->rows;
+		}
+	}
+
+	size_t rows = wrap_line( line, cols, starts );
+	if( cached != NULL ) {
+		cached->cols = u32( cols );
+		cached->rows = u32( rows );
+	}
 
-	TextBox::Line * line = &tb->lines[ ( tb->head + tb->num_lines ) % tb->max_lines ];
-	line->len = 0;
+	return rows;
 }
 
-void textbox_scroll( TextBox * tb, int offset ) {
-	if( offset < 0 ) {
-		tb->scroll_offset -= min( size_t( -offset ), tb->scroll_offset );
+/*
+ * the anchor can end up pointing past the lines we have if the ring evicts
+ * it or the log stops working, or past the rows its line has if the
+ * textbox gets wider
+ */
+static void clamp_anchor( TextBox * tb, TextBox::Line * scratch ) {
+	u64 oldest = oldest_id( tb );
+	if( tb->scroll_id < oldest ) {
+		tb->scroll_id = oldest;
+		tb->scroll_row = 0;
+	}
+
+	if( tb->scroll_row > 0 ) {
+		size_t rows = wrap( tb, tb->scroll_id, get_line( tb, tb->scroll_id, scratch ), num_cols( tb->w ), NULL );
+		tb->scroll_row = min( tb->scroll_row, rows - 1 );
+	}
+}
+
+// moves the anchor up by offset rows, or down if it's negative, stopping
+// at the oldest and newest rows
+static void scroll_rows( TextBox * tb, int offset ) {
+	size_t cols = num_cols( tb->w );
+	u64 oldest = oldest_id( tb );
+
+	ArenaScope scope( &frame_arena );
+	TextBox::Line * scratch = alloc_many< TextBox::Line >( &frame_arena, 1 );
+
+	clamp_anchor( tb, scratch );
+
+	if( offset > 0 ) {
+		size_t n = size_t( offset );
+		while( true ) {
+			size_t rows = wrap( tb, tb->scroll_id, get_line( tb, tb->scroll_id, scratch ), cols, NULL );
+			size_t above = rows - 1 - tb->scroll_row;
+			if( n <= above ) {
+				tb->scroll_row += n;
+				break;
+			}
+			if( tb->scroll_id == oldest ) {
+				tb->scroll_row = rows - 1;
+				break;
+			}
+
+			n -= above + 1;
+			tb->scroll_id--;
+			tb->scroll_row = 0;
+		}
 	}
 	else {
-		tb->scroll_offset = min( tb->scroll_offset + offset, tb->num_lines - 1 );
+		size_t n = size_t( -offset );
+		while( n > tb->scroll_row ) {
+			if( tb->scroll_id == tb->newest_id ) {
+				n = tb->scroll_row;
+				break;
+			}
+
+			n -= tb->scroll_row + 1;
+			tb->scroll_id++;
+			tb->scroll_row = wrap( tb, tb->scroll_id, get_line( tb, tb->scroll_id, scratch ), cols, NULL ) - 1;
+		}
+		tb->scroll_row -= n;
 	}
 
 	tb->dirty = true;
 }
 
-static size_t num_rows( size_t h ) {
-	int fw, fh;
-	ui_get_font_size( &fw, &fh );
-	return h / ( fh + SPACING );
+/*
+ * maps a row counted up from the bottom of the textbox and a column to a
+ * line and an offset into it. columns past the end of a row clamp to the end
+ * of the row, and rows above the oldest line clamp to its start
+ */
+static void hit_test( TextBox * tb, u64 scroll_id, size_t scroll_row, int row, int col, u64 * id_out, size_t * offset_out ) {
+	size_t cols = num_cols( tb->w );
+	u64 oldest = oldest_id( tb );
+
+	ArenaScope scope( &frame_arena );
+	TextBox::Line * scratch = alloc_many< TextBox::Line >( &frame_arena, 1 );
+	u32 * starts = alloc_many< u32 >( &frame_arena, MAX_LINE_LENGTH + 1 );
+
+	// count rows from the bottom of the anchor line
+	size_t target = size_t( max( row, 0 ) ) + scroll_row;
+	size_t rows_below = 0;
+
+	u64 id = scroll_id;
+	while( true ) {
+		const TextBox::Line & line = get_line( tb, id, scratch );
+		size_t rows = wrap( tb, id, line, cols, NULL );
+
+		if( target < rows_below + rows ) {
+			wrap_line( line, cols, starts );
+			size_t r = rows_below + rows - 1 - target;
+			size_t row_end = r + 1 < rows ? starts[ r + 1 ] : line.len;
+
+			*id_out = id;
+			*offset_out = min( starts[ r ] + size_t( max( col, 0 ) ), row_end );
+			return;
+		}
+
+		if( id == oldest )
+			break;
+
+		rows_below += rows;
+		id--;
+	}
+
+	*id_out = oldest;
+	*offset_out = 0;
+}
+
+void textbox_scroll( TextBox * tb, int offset ) {
+	scroll_rows( tb, offset );
 }
 
 void textbox_page_down( TextBox * tb ) {
-	textbox_scroll( tb, -int( num_rows( tb->h ) ) + 1 );
+	scroll_rows( tb, -int( max( scrolled_rows( tb ), size_t( 2 ) ) - 1 ) );
 }
 
 void textbox_page_up( TextBox * tb ) {
-	textbox_scroll( tb, num_rows( tb->h ) - 1 );
+	scroll_rows( tb, int( max( scrolled_rows( tb ), size_t( 2 ) ) - 1 ) );
+}
+
+void textbox_set_split( TextBox * tb, size_t rows ) {
+	tb->split_rows = rows;
+	tb->dirty = true;
+}
+
+/*
+ * wrapping is worked out lazily, so resizing only costs whatever's on
+ * screen. this tops up the wrap cache a few lines at a time when we're
+ * otherwise idle, working back from the newest line, so paging and
+ * selecting through old scrollback don't have to wrap as they go
+ */
+bool textbox_reflow( TextBox * tb, size_t max_lines ) {
+	ZoneScoped;
+
+	size_t cols = num_cols( tb->w );
+	if( cols != tb->reflow_cols ) {
+		tb->reflow_cols = cols;
+		tb->reflow_id = tb->newest_id + 1;
+	}
+
+	u64 oldest = oldest_ring_id( tb );
+	for( size_t i = 0; i < max_lines && tb->reflow_id > oldest; i++ ) {
+		tb->reflow_id--;
+		wrap( tb, tb->reflow_id, tb->lines[ line_index( tb, tb->reflow_id ) ], cols, NULL );
+	}
+
+	return tb->reflow_id > oldest;
+}
+
+/*
+ * search checks each line's trigram bloom before looking at its glyphs, so
+ * most lines cost a few ANDs and the Line structs only get touched for lines
+ * that probably match. queries shorter than a trigram have to look at
+ * everything
+ */
+
+static size_t find_in_line( const TextBox::Line & line, const char * query, size_t len, size_t start ) {
+	if( len > line.len )
+		return SIZE_MAX;
+
+	for( size_t i = start; i <= line.len - len; i++ ) {
+		size_t j = 0;
+		while( j < len && fold( line.glyphs[ i + j ].ch ) == query[ j ] )
+			j++;
+		if( j == len )
+			return i;
+	}
+
+	return SIZE_MAX;
+}
+
+static bool line_might_match( const TextBox::Trigrams & line, const TextBox::Trigrams & query ) {
+	for( size_t i = 0; i < ARRAY_COUNT( query.bits ); i++ ) {
+		if( ( line.bits[ i ] & query.bits[ i ] ) != query.bits[ i ] )
+			return false;
+	}
+	return true;
+}
+
+static bool find_from( TextBox * tb, u64 from, bool older ) {
+	ZoneScoped;
+
+	TextBox::Trigrams wanted = { };
+	for( size_t i = 2; i < tb->search_len; i++ ) {
+		add_trigram( &wanted, tb->search[ i - 2 ], tb->search[ i - 1 ], tb->search[ i ] );
+	}
+
+	// going older from id 0 wraps around and stops on the second check
+	u64 oldest = oldest_ring_id( tb );
+	for( u64 id = from; id >= oldest && id <= tb->newest_id; id = older ? id - 1 : id + 1 ) {
+		size_t idx = line_index( tb, id );
+		if( !line_might_match( tb->trigrams[ idx ], wanted ) )
+			continue;
+		if( find_in_line( tb->lines[ idx ], tb->search, tb->search_len, 0 ) == SIZE_MAX )
+			continue;
+
+		tb->search_found = true;
+		tb->search_match = id;
+
+		// put the match in the middle of the screen where we can
+		tb->scroll_id = id;
+		tb->scroll_row = 0;
+		scroll_rows( tb, -int( scrolled_rows( tb ) / 2 ) );
+
+		return true;
+	}
+
+	return false;
+}
+
+bool textbox_find( TextBox * tb, const char * query, size_t len ) {
+	textbox_clear_search( tb );
+
+	if( len == 0 || len > MAX_SEARCH_LENGTH )
+		return false;
+
+	for( size_t i = 0; i < len; i++ ) {
+		tb->search[ i ] = fold( query[ i ] );
+	}
+	tb->search_len = len;
+
+	return find_from( tb, tb->newest_id, true );
+}
+
+bool textbox_find_next( TextBox * tb, bool older ) {
+	if( !tb->search_found )
+		return false;
+	return find_from( tb, older ? tb->search_match - 1 : tb->search_match + 1, older );
+}
+
+void textbox_clear_search( TextBox * tb ) {
+	if( tb->search_len > 0 )
+		tb->dirty = true;
+	tb->search_len = 0;
+	tb->search_found = false;
+}
+
+static void mouse_to_text( TextBox * tb, int window_x, int window_y, u64 * id, size_t * offset ) {
+	{
+		ArenaScope scope( &frame_arena );
+		clamp_anchor( tb, alloc_many< TextBox::Line >( &frame_arena, 1 ) );
+	}
+
+	// drags off the top of the tail carry on into the scrolled pane
+	Pane panes[ 2 ];
+	size_t n = get_panes( tb, panes );
+	const Pane & pane = n == 2 && window_y >= panes[ 1 ].y ? panes[ 1 ] : panes[ 0 ];
+
+	int fw, fh;
+	ui_get_font_size( &fw, &fh );
+
+	int row = ( pane.y + pane.h - window_y ) / ( fh + SPACING );
+	int col = ( window_x - tb->x ) / fw;
+
+	hit_test( tb, pane.scroll_id, pane.scroll_row, row, col, id, offset );
 }
 
 void textbox_mouse_down( TextBox * tb, int window_x, int window_y ) {
@@ -116,19 +544,17 @@ void textbox_mouse_down( TextBox * tb, int window_x, int window_y ) {
 	if( x < 0 || y < 0 || x >= tb->w || y >= tb->h )
 		return;
 
-	int fw, fh;
-	ui_get_font_size( &fw, &fh );
-
-	int row = ( tb->h - y ) / ( fh + SPACING );
-	int col = x / fw;
+	u64 id;
+	size_t offset;
+	mouse_to_text( tb, window_x, window_y, &id, &offset );
 
 	tb->selecting = true;
 	tb->selecting_and_mouse_moved = false;
-	tb->scroll_down_after_selecting = tb->scroll_offset == 0;
-	tb->selection_start_col = col;
-	tb->selection_start_row = row;
-	tb->selection_end_col = col;
-	tb->selection_end_row = row;
+	tb->scroll_down_after_selecting = at_bottom( tb );
+	tb->selection_start_id = id;
+	tb->selection_start_offset = offset;
+	tb->selection_end_id = id;
+	tb->selection_end_offset = offset;
 	tb->dirty = true;
 }
 
@@ -136,18 +562,13 @@ void textbox_mouse_move( TextBox * tb, int window_x, int window_y ) {
 	if( !tb->selecting )
 		return;
 
-	int x = window_x - tb->x;
-	int y = window_y - tb->y;
-
-	int fw, fh;
-	ui_get_font_size( &fw, &fh );
-
-	int row = ( tb->h - y ) / ( fh + SPACING );
-	int col = x / fw;
+	u64 id;
+	size_t offset;
+	mouse_to_text( tb, window_x, window_y, &id, &offset );
 
-	if( col != tb->selection_end_col || row != tb->selection_end_row ) {
-		tb->selection_end_col = col;
-		tb->selection_end_row = row;
+	if( id != tb->selection_end_id || offset != tb->selection_end_offset ) {
+		tb->selection_end_id = id;
+		tb->selection_end_offset = offset;
 		tb->dirty = true;
 	}
 	else if( !tb->selecting_and_mouse_moved ) {
@@ -157,112 +578,89 @@ void textbox_mouse_move( TextBox * tb, int window_x, int window_y ) {
 	tb->selecting_and_mouse_moved = true;
 }
 
-void textbox_mouse_up( TextBox * tb, int window_x, int window_y ) {
-	if( !tb->selecting || !tb->selecting_and_mouse_moved ) {
-		tb->selecting = false;
-		return;
-	}
-
-	int fw, fh;
-	ui_get_font_size( &fw, &fh );
-
-	size_t tb_cols = tb->w / fw;
-
-	// convert mouse start/end points to ordered start/end points
-	int start_row = tb->selection_start_row;
-	int end_row = tb->selection_end_row;
-	int start_col = tb->selection_start_col;
-	int end_col = tb->selection_end_col;
-	if( tb->selection_start_row == tb->selection_end_row ) {
-		start_col = min( tb->selection_start_col, tb->selection_end_col );
-		end_col = max( tb->selection_start_col, tb->selection_end_col );
-	}
-	else if( tb->selection_start_row < tb->selection_end_row ) {
-		swap( start_row, end_row );
-		swap( start_col, end_col );
-	}
+static bool selection_before( u64 id_a, size_t offset_a, u64 id_b, size_t offset_b ) {
+	return id_a < id_b || ( id_a == id_b && offset_a < offset_b );
+}
 
-	// find what the start/end lines/offsets are
-	// TODO: this is incorrect when wrapping...
-	int end_line = 0;
-	int rows = 0;
+// ordered selection, end is inclusive
+static void selection_range( const TextBox * tb, u64 * start_id, size_t * start_offset, u64 * end_id, size_t * end_offset ) {
+	*start_id = tb->selection_start_id;
+	*start_offset = tb->selection_start_offset;
+	*end_id = tb->selection_end_id;
+	*end_offset = tb->selection_end_offset;
 
-	while( rows < end_row && end_line < tb->num_lines ) {
-		const TextBox::Line & line = tb->lines[ ( tb->head + tb->num_lines - tb->scroll_offset - end_line ) % tb->max_lines ];
-		int line_rows = 1 + line.len / tb_cols;
-		if( line.len > 0 && line.len % tb_cols == 0 )
-			line_rows--;
-		rows += line_rows;
-		end_line++;
+	if( selection_before( *end_id, *end_offset, *start_id, *start_offset ) ) {
+		swap( *start_id, *end_id );
+		swap( *start_offset, *end_offset );
 	}
+}
 
-	if( end_line == tb->num_lines )
+void textbox_mouse_up( TextBox * tb, int window_x, int window_y ) {
+	if( !tb->selecting || !tb->selecting_and_mouse_moved ) {
+		tb->selecting = false;
 		return;
+	}
 
-	size_t end_line_offset = ( rows - end_row ) * tb_cols + end_col + 1;
-	int start_line = end_line;
+	u64 start_id, end_id;
+	size_t start_offset, end_offset;
+	selection_range( tb, &start_id, &start_offset, &end_id, &end_offset );
+	end_offset++;
 
-	while( rows < start_row && start_line < tb->num_lines ) {
-		const TextBox::Line & line = tb->lines[ ( tb->head + tb->num_lines - tb->scroll_offset - start_line ) % tb->max_lines ];
-		int line_rows = 1 + line.len / tb_cols;
-		if( line.len > 0 && line.len % tb_cols == 0 )
-			line_rows--;
-		rows += line_rows;
-		start_line++;
-	}
+	// the selection can't have scrolled out of the log, but it can have
+	// fallen out of the ring when there's no log
+	start_id = max( start_id, oldest_id( tb ) );
+	end_id = max( end_id, start_id );
 
-	size_t start_line_offset = ( rows - start_row ) * tb_cols + start_col;
-	if( start_line == tb->num_lines ) {
-		start_line--;
-		start_line_offset = 0;
-	}
+	ArenaScope scope( &frame_arena );
+	TextBox::Line * scratch = alloc_many< TextBox::Line >( &frame_arena, 1 );
 
 	// first pass to get the length of the selected string
 	size_t selected_length = 1; // include space for \0
-	for( int i = start_line; i >= end_line; i-- ) {
-		const TextBox::Line & line = tb->lines[ ( tb->head + tb->num_lines - tb->scroll_offset - i ) % tb->max_lines ];
-		size_t start_offset = i == start_line ? start_line_offset : 0;
-		size_t end_offset = i == end_line ? end_line_offset : line.len;
+	for( u64 id = start_id; id <= end_id; id++ ) {
+		const TextBox::Line & line = get_line( tb, id, scratch );
+		size_t from = id == start_id ? start_offset : 0;
+		size_t to = id == end_id ? end_offset : line.len;
 		// TODO: iterate over glyphs to see when ansi codes need inserting
-		if( start_offset <= line.len ) {
-			selected_length += min( line.len, end_offset ) - start_offset;
+		if( from <= line.len ) {
+			selected_length += min( line.len, to ) - from;
 		}
-		if( i != end_line ) {
+		if( id != end_id ) {
 			selected_length += sizeof( NEWLINE_STRING ) - 1;
 		}
 	}
 
-	char * selected = alloc_many< char >( selected_length );
+	char * selected = alloc_many< char >( &frame_arena, selected_length );
 	selected[ selected_length - 1 ] = '\0';
 
 	// second pass to copy the selection out
 	size_t n = 0;
-	for( int i = start_line; i >= end_line; i-- ) {
-		const TextBox::Line & line = tb->lines[ ( tb->head + tb->num_lines - tb->scroll_offset - i ) % tb->max_lines ];
-		size_t start_offset = i == start_line ? start_line_offset : 0;
-		size_t end_offset = i == end_line ? end_line_offset : line.len;
-		if( start_offset <= line.len ) {
-			size_t len = min( line.len, end_offset ) - start_offset;
+	for( u64 id = start_id; id <= end_id; id++ ) {
+		const TextBox::Line & line = get_line( tb, id, scratch );
+		size_t from = id == start_id ? start_offset : 0;
+		size_t to = id == end_id ? end_offset : line.len;
+		if( from <= line.len ) {
+			size_t len = min( line.len, to ) - from;
 			// TODO: insert ansi codes when style changes
 			for( size_t j = 0; j < len; j++ ) {
-				selected[ n ] = line.glyphs[ j + start_offset ].ch;
+				selected[ n ] = line.glyphs[ j + from ].ch;
 				n++;
 			}
 		}
-		if( i != end_line ) {
+		if( id != end_id ) {
 			memcpy( selected + n, NEWLINE_STRING, sizeof( NEWLINE_STRING ) - 1 );
 			n += sizeof( NEWLINE_STRING ) - 1;
 		}
 	}
 
 	platform_set_clipboard( selected, selected_length );
-	free( selected );
 
 	tb->selecting = false;
 	tb->dirty = true;
 
-	if( tb->scroll_down_after_selecting )
-		tb->scroll_offset = 0;
+	if( tb->scroll_down_after_selecting ) {
+		tb->scroll_id = tb->newest_id;
+		tb->scroll_row = 0;
+	}
 }
 
 void textbox_set_pos( TextBox * tb, int x, int y ) {
@@ -275,43 +673,8 @@ void textbox_set_size( TextBox * tb, int w, int h ) {
 	tb->h = h;
 }
 
-static bool inside_selection( int col, int row, int start_col, int start_row, int end_col, int end_row ) {
-	int min_row = min( start_row, end_row );
-	int max_row = max( start_row, end_row );
-
-	if( row < min_row || row > max_row )
-		return false;
-
-	if( start_row == end_row ) {
-		int min_col = min( start_col, end_col );
-		int max_col = max( start_col, end_col );
-		return col >= min_col && col <= max_col;
-	}
-
-	if( row > min_row && row < max_row )
-		return true;
-
-	if( start_row < end_row ) {
-		if( row == start_row )
-			return col <= start_col;
-		if( row == end_row )
-			return col >= end_col;
-	}
-	else {
-		if( row == start_row )
-			return col >= start_col;
-		if( row == end_row )
-			return col <= end_col;
-	}
-
-	return false;
-}
-
-void textbox_draw( TextBox * tb ) {
-	if( tb->w <= 0 || tb->h <= 0 )
-		return;
-
-	ui_fill_rect( tb->x, tb->y, tb->w, tb->h, COLOUR_BG, false );
+static void draw_pane( TextBox * tb, const Pane & pane, TextBox::Line * scratch ) {
+	ui_fill_rect( tb->x, pane.y, tb->w, pane.h, COLOUR_BG, false );
 
 	/*
 	 * lines refers to lines of text sent from the game
@@ -322,39 +685,101 @@ void textbox_draw( TextBox * tb ) {
 	int fw, fh;
 	ui_get_font_size( &fw, &fh );
 
-	size_t lines_drawn = 0;
-	size_t rows_drawn = 0;
-	size_t tb_rows = num_rows( tb->h );
-	size_t tb_cols = tb->w / fw;
+	size_t tb_rows = num_rows( pane.h );
+	size_t tb_cols = num_cols( tb->w );
 
 	int top_spacing = SPACING / 2;
 	int bot_spacing = SPACING - top_spacing;
 
-	while( rows_drawn < tb_rows && lines_drawn + tb->scroll_offset < tb->num_lines ) {
-		const TextBox::Line & line = tb->lines[ ( tb->head + tb->num_lines - tb->scroll_offset - lines_drawn ) % tb->max_lines ];
+	ArenaScope scope( &frame_arena );
+	bool highlighting = highlight_any();
+	bool searching = tb->search_len > 0;
+	char * text = NULL;
+	u16 * highlights = NULL;
+	bool * found = NULL;
+	if( highlighting ) {
+		text = alloc_many< char >( &frame_arena, MAX_LINE_LENGTH );
+		highlights = alloc_many< u16 >( &frame_arena, MAX_LINE_LENGTH );
+	}
+	if( searching ) {
+		found = alloc_many< bool >( &frame_arena, MAX_LINE_LENGTH );
+	}
+
+	u64 oldest = oldest_id( tb );
+
+	u32 * row_starts = alloc_many< u32 >( &frame_arena, MAX_LINE_LENGTH + 1 );
+
+	bool selection = tb->selecting && tb->selecting_and_mouse_moved;
+	u64 selection_start_id, selection_end_id;
+	size_t selection_start_offset, selection_end_offset;
+	selection_range( tb, &selection_start_id, &selection_start_offset, &selection_end_id, &selection_end_offset );
+
+	// the anchor row sits on the bottom row, so the rows below it are
+	// offscreen
+	int rows_drawn = -int( pane.scroll_row );
+
+	for( u64 id = pane.scroll_id; rows_drawn < int( tb_rows ); id-- ) {
+		const TextBox::Line & line = get_line( tb, id, scratch );
+
+		size_t line_rows = wrap( tb, id, line, tb_cols, row_starts );
+
+		bool highlighted = false;
+		if( highlighting ) {
+			for( size_t i = 0; i < line.len; i++ ) {
+				text[ i ] = line.glyphs[ i ].ch;
+			}
+			highlighted = highlight_line( Span< const char >( text, line.len ), highlights );
+		}
 
-		size_t line_rows = 1 + line.len / tb_cols;
-		if( line.len > 0 && line.len % tb_cols == 0 )
-			line_rows--;
+		bool any_found = false;
+		if( searching ) {
+			size_t pos = find_in_line( line, tb->search, tb->search_len, 0 );
+			if( pos != SIZE_MAX ) {
+				any_found = true;
+				memset( found, 0, line.len * sizeof( found[ 0 ] ) );
+				while( pos != SIZE_MAX ) {
+					memset( found + pos, 1, tb->search_len * sizeof( found[ 0 ] ) );
+					pos = find_in_line( line, tb->search, tb->search_len, pos + 1 );
+				}
+			}
+		}
+		bool current_match = tb->search_found && id == tb->search_match;
 
+		size_t row = 0;
 		for( size_t i = 0; i < line.len; i++ ) {
 			const TextBox::Glyph & glyph = line.glyphs[ i ];
 
-			size_t row = i / tb_cols;
-			size_t col = i % tb_cols;
+			while( row + 1 < line_rows && i >= row_starts[ row + 1 ] )
+				row++;
+			size_t col = i - row_starts[ row ];
 
+			int rows_up = rows_drawn + int( line_rows - row );
 			int left = col * fw;
-			int top = tb->h - ( rows_drawn + line_rows - row ) * ( fh + SPACING );
-			if( top < 0 )
+			int top = pane.h - rows_up * ( fh + SPACING );
+			if( top < 0 || rows_up <= 0 )
 				continue;
 
 			int fg, bg, bold;
 			unpack_style( glyph.style, &fg, &bg, &bold );
 
+			if( highlighted && highlights[ i ] != 0 ) {
+				HighlightStyle highlight = highlight_style( highlights[ i ] );
+				fg = highlight.fg >= 0 ? highlight.fg : fg;
+				bg = highlight.bg >= 0 ? highlight.bg : bg;
+				bold = highlight.bold >= 0 ? highlight.bold : bold;
+			}
+
+			if( any_found && found[ i ] ) {
+				fg = BLACK;
+				bg = current_match ? YELLOW : WHITE;
+			}
+
 			bool bold_fg = bold;
 			bool bold_bg = false;
-			if( tb->selecting && tb->selecting_and_mouse_moved ) {
-				if( inside_selection( col, rows_drawn + line_rows - row - 1, tb->selection_start_col, tb->selection_start_row, tb->selection_end_col, tb->selection_end_row ) ) {
+			if( selection ) {
+				bool after_start = !selection_before( id, i, selection_start_id, selection_start_offset );
+				bool before_end = !selection_before( selection_end_id, selection_end_offset, id, i );
+				if( after_start && before_end ) {
 					swap( fg, bg );
 					swap( bold_fg, bold_bg );
 				}
@@ -363,18 +788,58 @@ void textbox_draw( TextBox * tb ) {
 			// bg
 			// TODO: top/bottom spacing seems to be inconsistent here, try with large spacing
 			if( bg != BLACK ) {
-				ui_fill_rect( tb->x + left, tb->y + top - top_spacing, fw, fh + bot_spacing, Colour( bg ), bold_bg );
+				ui_fill_rect( tb->x + left, pane.y + top - top_spacing, fw, fh + bot_spacing, Colour( bg ), bold_bg );
 			}
 
 			// fg
-			ui_draw_char( tb->x + left, tb->y + top, glyph.ch, Colour( fg ), bold_fg, bold );
+			ui_draw_char( tb->x + left, pane.y + top, glyph.ch, Colour( fg ), bold_fg, bold );
 		}
 
-		lines_drawn++;
-		rows_drawn += line_rows;
+		rows_drawn += int( line_rows );
+		if( id == oldest )
+			break;
+	}
+}
+
+void textbox_draw( TextBox * tb ) {
+	if( tb->w <= 0 || tb->h <= 0 )
+		return;
+
+	ArenaScope scope( &frame_arena );
+	TextBox::Line * scratch = alloc_many< TextBox::Line >( &frame_arena, 1 );
+
+	clamp_anchor( tb, scratch );
+
+	Pane panes[ 2 ];
+	size_t n = get_panes( tb, panes );
+	for( size_t i = 0; i < n; i++ ) {
+		draw_pane( tb, panes[ i ], scratch );
+	}
+
+	if( n == 2 ) {
+		int divider = panes[ 0 ].y + panes[ 0 ].h;
+		ui_fill_rect( tb->x, divider, tb->w, tb->y + tb->h - divider, COLOUR_BG, false );
+		ui_fill_rect( tb->x, divider, tb->w, 1, COLOUR_STATUSBG, false );
 	}
 
 	platform_make_dirty( tb->x, tb->y, tb->w, tb->h );
 
 	tb->dirty = false;
+	tb->tail_dirty = false;
+}
+
+void textbox_draw_tail( TextBox * tb ) {
+	Pane panes[ 2 ];
+	if( tb->w <= 0 || tb->h <= 0 || get_panes( tb, panes ) == 1 ) {
+		textbox_draw( tb );
+		return;
+	}
+
+	ArenaScope scope( &frame_arena );
+	TextBox::Line * scratch = alloc_many< TextBox::Line >( &frame_arena, 1 );
+
+	draw_pane( tb, panes[ 1 ], scratch );
+	platform_make_dirty( tb->x, panes[ 1 ].y, tb->w, panes[ 1 ].h );
+
+	tb->tail_dirty = false;
 }
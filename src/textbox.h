@@ -4,6 +4,9 @@
 
 constexpr size_t MAX_LINE_LENGTH = 2048;
 constexpr size_t SCROLLBACK_SIZE = 1 << 14;
+constexpr size_t MAX_SEARCH_LENGTH = 256;
+
+struct SessionLog;
 
 struct TextBox {
 	struct Glyph {
@@ -16,33 +19,88 @@ struct TextBox {
 		size_t len;
 	};
 
+	// bloom filter of each line's case folded trigrams, kept apart from the
+	// lines so searching doesn't have to touch them
+	struct Trigrams {
+		u64 bits[ 4 ];
+	};
+
+	// how many rows a line wraps to at a given width. 0 cols means unknown
+	struct Wrap {
+		u32 cols;
+		u32 rows;
+	};
+
+	// the line with id i lives in lines[ i % max_lines ]
 	Span< Line > lines;
-	size_t head;
+	Span< Trigrams > trigrams;
+	Span< Wrap > wraps;
 	size_t num_lines;
 	size_t max_lines;
 
+	// every line gets the next id when it's started, and the ring holds the
+	// newest num_lines, ending with the line still being added to. with a
+	// log, a line's id is its index in the log
+	u64 newest_id;
+
+	// optional. committed lines are appended to it, and scrolling past the
+	// top of the ring pages older lines back in from it
+	SessionLog * log;
+
 	int x, y;
 	int w, h;
-	size_t scroll_offset;
 
+	// the bottom of the textbox shows row scroll_row of line scroll_id,
+	// counting up from the line's last row. we follow new lines while that's
+	// the bottom row of the newest line, otherwise the view stays put
+	u64 scroll_id;
+	size_t scroll_row;
+
+	// while we're scrolled back the bottom split_rows rows keep showing the
+	// newest lines, 0 turns it off
+	size_t split_rows;
+
+	// textbox_reflow has wrapped every line from reflow_id to the newest
+	size_t reflow_cols;
+	u64 reflow_id;
+
+	// the selection runs between ( id, offset ) pairs, in either order
 	bool selecting;
 	bool selecting_and_mouse_moved;
 	bool scroll_down_after_selecting;
-	int selection_start_col, selection_start_row;
-	int selection_end_col, selection_end_row;
+	u64 selection_start_id, selection_end_id;
+	size_t selection_start_offset, selection_end_offset;
+
+	char search[ MAX_SEARCH_LENGTH ];
+	size_t search_len;
+	bool search_found;
+	u64 search_match;
 
 	bool dirty;
+	bool tail_dirty; // only the newest lines' pane needs redrawing
 };
 
-void textbox_init( TextBox * tb, size_t scrollback );
+void textbox_init( TextBox * tb, size_t scrollback, SessionLog * log );
 
 void textbox_add( TextBox * tb, const char * str, size_t len, Colour fg, Colour bg, bool bold );
 void textbox_newline( TextBox * tb );
 
+// positive offsets scroll up, by rows rather than lines
 void textbox_scroll( TextBox * tb, int offset );
 void textbox_page_down( TextBox * tb );
 void textbox_page_up( TextBox * tb );
 
+void textbox_set_split( TextBox * tb, size_t rows );
+
+// does a little background wrapping, returns true if there's more to do
+bool textbox_reflow( TextBox * tb, size_t max_lines );
+
+// case insensitive. textbox_find finds the newest match and scrolls to it,
+// textbox_find_next moves on from there. only searches the in-memory ring
+bool textbox_find( TextBox * tb, const char * query, size_t len );
+bool textbox_find_next( TextBox * tb, bool older );
+void textbox_clear_search( TextBox * tb );
+
 void textbox_mouse_down( TextBox * tb, int x, int y );
 void textbox_mouse_move( TextBox * tb, int x, int y );
 void textbox_mouse_up( TextBox * tb, int x, int y );
@@ -51,5 +109,7 @@ void textbox_set_pos( TextBox * tb, int x, int y );
 void textbox_set_size( TextBox * tb, int w, int h );
 
 void textbox_draw( TextBox * tb );
+// redraws the newest lines when split, otherwise everything
+void textbox_draw_tail( TextBox * tb );
 
 void textbox_destroy( TextBox * tb );
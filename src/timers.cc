@@ -0,0 +1,106 @@
+#include "common.h"
+#include "array.h"
+#include "timers.h"
+
+struct Timer {
+	double deadline;
+	u64 id;
+};
+
+static DynamicArray< Timer > heap;
+static u64 next_id;
+
+static bool earlier( const Timer & a, const Timer & b ) {
+	if( a.deadline != b.deadline )
+		return a.deadline < b.deadline;
+	return a.id < b.id;
+}
+
+static void sift_up( size_t i ) {
+	while( i > 0 ) {
+		size_t parent = ( i - 1 ) / 2;
+		if( !earlier( heap[ i ], heap[ parent ] ) )
+			break;
+		swap( heap[ i ], heap[ parent ] );
+		i = parent;
+	}
+}
+
+static void sift_down( size_t i ) {
+	while( true ) {
+		size_t left = i * 2 + 1;
+		size_t right = left + 1;
+		size_t smallest = i;
+
+		if( left < heap.size() && earlier( heap[ left ], heap[ smallest ] ) )
+			smallest = left;
+		if( right < heap.size() && earlier( heap[ right ], heap[ smallest ] ) )
+			smallest = right;
+
+		if( smallest == i )
+			break;
+
+		swap( heap[ i ], heap[ smallest ] );
+		i = smallest;
+	}
+}
+
+static void remove_at( size_t i ) {
+	heap[ i ] = heap.top();
+	heap.resize( heap.size() - 1 );
+
+	if( i < heap.size() ) {
+		sift_up( i );
+		sift_down( i );
+	}
+}
+
+u64 timers_add( double deadline ) {
+	Timer timer;
+	timer.deadline = deadline;
+	timer.id = next_id;
+	next_id++;
+
+	sift_up( heap.add( timer ) );
+
+	return timer.id;
+}
+
+bool timers_cancel( u64 id ) {
+	// linear scan is fine, scripts have hundreds of timers at most
+	for( size_t i = 0; i < heap.size(); i++ ) {
+		if( heap[ i ].id == id ) {
+			remove_at( i );
+			return true;
+		}
+	}
+
+	return false;
+}
+
+bool timers_next_deadline( double * deadline ) {
+	if( heap.size() == 0 )
+		return false;
+
+	*deadline = heap[ 0 ].deadline;
+	return true;
+}
+
+bool timers_pop_expired( double now, u64 * id ) {
+	if( heap.size() == 0 || heap[ 0 ].deadline > now )
+		return false;
+
+	*id = heap[ 0 ].id;
+	remove_at( 0 );
+
+	return true;
+}
+
+void timers_init() {
+	heap.clear();
+	next_id = 1;
+}
+
+void timers_term() {
+	heap.clear();
+}
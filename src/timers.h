@@ -0,0 +1,17 @@
+#pragma once
+
+#include "common.h"
+
+/*
+ * timers are kept in a min-heap ordered by deadline so the main loop can
+ * sleep until the next one is due and only fire the ones that expired
+ */
+
+u64 timers_add( double deadline );
+bool timers_cancel( u64 id );
+
+bool timers_next_deadline( double * deadline );
+bool timers_pop_expired( double now, u64 * id );
+
+void timers_init();
+void timers_term();
@@ -2,10 +2,30 @@
 #include "array.h"
 #include "input.h"
 #include "textbox.h"
+#include "grid.h"
+#include "platform_time.h"
+#include "session_log.h"
 #include "gitversion.h"
 
+Arena frame_arena;
+
 static TextBox main_text;
 static TextBox chat_text;
+static SessionLog * session_log;
+
+// extra windows from scripts, each with its own scrollback. grid windows
+// use grid and leave text alone
+struct Window {
+	TextBox text;
+	Grid grid;
+	bool is_grid;
+	size_t rows;
+	WindowPosition position;
+	int divider_y;
+	bool open;
+};
+
+static Window windows[ MAX_WINDOWS ];
 
 static int window_width, window_height;
 
@@ -19,19 +39,78 @@ typedef struct {
 static DynamicArray< StatusChar > status;
 static bool status_dirty = false;
 
+static void destroy_window( Window * window ) {
+	if( window->is_grid )
+		grid_destroy( &window->grid );
+	else
+		textbox_destroy( &window->text );
+}
+
+static bool window_needs_redraw( const Window & window ) {
+	if( !window.open )
+		return false;
+	if( window.is_grid )
+		return grid_needs_redraw( &window.grid );
+	return window.text.dirty;
+}
+
+static void draw_window( Window * window, bool everything ) {
+	if( window->is_grid ) {
+		if( everything )
+			grid_draw( &window->grid );
+		else
+			grid_draw_damaged( &window->grid );
+	}
+	else {
+		textbox_draw( &window->text );
+	}
+}
+
+static void set_window_rect( Window * window, int x, int y, int w, int h ) {
+	if( window->is_grid ) {
+		grid_set_pos( &window->grid, x, y );
+		grid_set_size( &window->grid, w, h );
+	}
+	else {
+		textbox_set_pos( &window->text, x, y );
+		textbox_set_size( &window->text, w, h );
+	}
+}
+
 void ui_init() {
 	ZoneScoped;
 
-	textbox_init( &main_text, SCROLLBACK_SIZE );
-	textbox_init( &chat_text, CHAT_ROWS );
+	arena_init( &frame_arena, FRAME_ARENA_SIZE );
+
+	const char * log_err;
+	session_log = session_log_open_default( &log_err );
+
+	textbox_init( &main_text, SCROLLBACK_SIZE, session_log );
+	textbox_init( &chat_text, CHAT_ROWS, NULL );
 
-	ui_main_print( "> Mud Gangster ", 0, SYSTEM, BLACK, false );
-	ui_main_print( APP_VERSION, 0, SYSTEM, BLACK, true );
+	const char * title = "> Mud Gangster ";
+	ui_main_print( title, strlen( title ), SYSTEM, BLACK, false );
+	ui_main_print( APP_VERSION, strlen( APP_VERSION ), SYSTEM, BLACK, true );
+
+	if( session_log == NULL ) {
+		char msg[ 256 ];
+		snprintf( msg, sizeof( msg ), "> Session log disabled, %s. Scrollback only goes back %zu lines", log_err, SCROLLBACK_SIZE );
+		ui_main_newline();
+		ui_main_print( msg, strlen( msg ), SYSTEM, BLACK, false );
+	}
 }
 
 void ui_term() {
 	textbox_destroy( &main_text );
 	textbox_destroy( &chat_text );
+	for( Window & window : windows ) {
+		if( window.open ) {
+			destroy_window( &window );
+		}
+	}
+	session_log_close( session_log );
+
+	arena_term( &frame_arena );
 }
 
 void ui_fill_rect( int left, int top, int width, int height, Colour colour, bool bold ) {
@@ -227,11 +306,36 @@ void ui_draw_status() {
 	status_dirty = false;
 }
 
+void ui_restyle_text() {
+	main_text.dirty = true;
+	chat_text.dirty = true;
+	for( Window & window : windows ) {
+		window.text.dirty = true;
+		window.grid.dirty = true;
+	}
+}
+
+bool ui_needs_redraw() {
+	for( const Window & window : windows ) {
+		if( window_needs_redraw( window ) )
+			return true;
+	}
+
+	return main_text.dirty || main_text.tail_dirty || chat_text.dirty || input_is_dirty() || status_dirty;
+}
+
 void ui_redraw_dirty() {
 	if( main_text.dirty )
 		textbox_draw( &main_text );
+	else if( main_text.tail_dirty )
+		textbox_draw_tail( &main_text );
 	if( chat_text.dirty )
 		textbox_draw( &chat_text );
+	for( Window & window : windows ) {
+		if( window_needs_redraw( window ) ) {
+			draw_window( &window, false );
+		}
+	}
 	if( input_is_dirty() )
 		input_draw();
 	if( status_dirty )
@@ -252,6 +356,13 @@ void ui_redraw_everything() {
 
 	int spacerY = ( 2 * PADDING ) + ( fh + SPACING ) * CHAT_ROWS;
 	ui_fill_rect( 0, spacerY, window_width, 1, COLOUR_STATUSBG, false );
+
+	for( Window & window : windows ) {
+		if( window.open ) {
+			draw_window( &window, true );
+			ui_fill_rect( 0, window.divider_y, window_width, 1, COLOUR_STATUSBG, false );
+		}
+	}
 }
 
 void ui_main_newline() {
@@ -270,23 +381,74 @@ void ui_chat_print( const char * str, size_t len, Colour fg, Colour bg, bool bol
 	textbox_add( &chat_text, str, len, fg, bg, bold );
 }
 
+/*
+ * script windows stack up under the chat window or above the status bar in
+ * the order they were opened, and the main window gets what's left. each
+ * one is separated from the main window by a divider like the chat window
+ */
 void ui_update_layout() {
 	int fw, fh;
 	ui_get_font_size( &fw, &fh );
 
+	int width = window_width - ( 2 * PADDING );
+
 	textbox_set_pos( &chat_text, PADDING, PADDING );
-	textbox_set_size( &chat_text, window_width - ( 2 * PADDING ), ( fh + SPACING ) * CHAT_ROWS );
+	textbox_set_size( &chat_text, width, ( fh + SPACING ) * CHAT_ROWS );
+
+	int top = ( PADDING * 2 ) + CHAT_ROWS * ( fh + SPACING ) + 1;
+	int bottom = window_height - ( fh * 2 ) - ( PADDING * 5 );
+
+	for( Window & window : windows ) {
+		if( !window.open || window.position != WINDOW_TOP )
+			continue;
+
+		int h = int( window.rows ) * ( fh + SPACING );
+		set_window_rect( &window, PADDING, top, width, h );
+		window.divider_y = top + h + PADDING;
+		top = window.divider_y + 1;
+	}
+
+	for( size_t i = MAX_WINDOWS; i-- > 0; ) {
+		Window & window = windows[ i ];
+		if( !window.open || window.position != WINDOW_BOTTOM )
+			continue;
+
+		int h = int( window.rows ) * ( fh + SPACING );
+		set_window_rect( &window, PADDING, bottom - h, width, h );
+		window.divider_y = bottom - h - 1;
+		bottom = window.divider_y - PADDING;
+	}
 
-	textbox_set_pos( &main_text, PADDING, ( PADDING * 2 ) + CHAT_ROWS * ( fh + SPACING ) + 1 );
-	textbox_set_size( &main_text, window_width - ( 2 * PADDING ), window_height
-		- ( ( ( fh + SPACING ) * CHAT_ROWS ) + ( PADDING * 2 ) )
-		- ( ( fh * 2 ) + ( PADDING * 5 ) ) - 1
-	);
+	textbox_set_pos( &main_text, PADDING, top );
+	textbox_set_size( &main_text, width, max( bottom - top, 0 ) );
 
 	input_set_pos( PADDING, window_height - PADDING - fh );
 	input_set_size( window_width - PADDING * 2, fh );
 }
 
+// returns true if there's more to do next time we're idle
+bool ui_idle( double budget ) {
+	ZoneScoped;
+
+	double deadline = get_time() + budget;
+	while( textbox_reflow( &main_text, 256 ) ) {
+		if( get_time() >= deadline )
+			return true;
+	}
+
+	for( Window & window : windows ) {
+		if( !window.open || window.is_grid )
+			continue;
+
+		while( textbox_reflow( &window.text, 256 ) ) {
+			if( get_time() >= deadline )
+				return true;
+		}
+	}
+
+	return false;
+}
+
 void ui_resize( int width, int height ) {
 	int old_width = window_width;
 	int old_height = window_height;
@@ -300,29 +462,199 @@ void ui_resize( int width, int height ) {
 	ui_update_layout();
 }
 
+// scrolling goes to whichever textbox the mouse is over, so script windows
+// and chat can be scrolled back too
+static int mouse_x = -1;
+static int mouse_y = -1;
+
+static bool under_mouse( const TextBox * tb ) {
+	return mouse_x >= tb->x && mouse_y >= tb->y && mouse_x < tb->x + tb->w && mouse_y < tb->y + tb->h;
+}
+
+static TextBox * scroll_target() {
+	if( under_mouse( &chat_text ) )
+		return &chat_text;
+
+	for( Window & window : windows ) {
+		if( window.open && !window.is_grid && under_mouse( &window.text ) )
+			return &window.text;
+	}
+
+	return &main_text;
+}
+
 void ui_scroll( int offset ) {
-	textbox_scroll( &main_text, offset );
+	textbox_scroll( scroll_target(), offset );
+}
+
+// layout changes move everything so redraw the lot
+static void relayout() {
+	ui_update_layout();
+	ui_redraw_everything();
+	platform_make_dirty( 0, 0, window_width, window_height );
+}
+
+static Window * alloc_window() {
+	for( Window & window : windows ) {
+		if( !window.open )
+			return &window;
+	}
+	return NULL;
+}
+
+int ui_window_open( size_t rows, WindowPosition position, size_t scrollback ) {
+	Window * window = alloc_window();
+	if( window == NULL )
+		return -1;
+
+	textbox_init( &window->text, max( scrollback, size_t( 1 ) ), NULL );
+	window->is_grid = false;
+	window->rows = rows;
+	window->position = position;
+	window->open = true;
+
+	relayout();
+
+	return int( window - windows );
+}
+
+int ui_grid_open( size_t cols, size_t rows, WindowPosition position ) {
+	Window * window = alloc_window();
+	if( window == NULL )
+		return -1;
+
+	grid_init( &window->grid, cols, rows );
+	window->is_grid = true;
+	window->rows = rows;
+	window->position = position;
+	window->open = true;
+
+	relayout();
+
+	return int( window - windows );
+}
+
+static Window * get_window( int id ) {
+	ASSERT( id >= 0 && id < MAX_WINDOWS && windows[ id ].open );
+	return &windows[ id ];
+}
+
+static TextBox * get_text( int id ) {
+	Window * window = get_window( id );
+	ASSERT( !window->is_grid );
+	return &window->text;
+}
+
+static Grid * get_grid( int id ) {
+	Window * window = get_window( id );
+	ASSERT( window->is_grid );
+	return &window->grid;
+}
+
+void ui_window_layout( int id, size_t rows, WindowPosition position ) {
+	Window * window = get_window( id );
+	if( !window->is_grid )
+		window->rows = rows;
+	window->position = position;
+	relayout();
+}
+
+void ui_window_close( int id ) {
+	Window * window = get_window( id );
+	destroy_window( window );
+	window->open = false;
+	relayout();
+}
+
+void ui_window_print( int id, const char * str, size_t len, Colour fg, Colour bg, bool bold ) {
+	textbox_add( get_text( id ), str, len, fg, bg, bold );
+}
+
+void ui_window_newline( int id ) {
+	textbox_newline( get_text( id ) );
+}
+
+void ui_grid_size( int id, size_t * cols, size_t * rows ) {
+	Grid * grid = get_grid( id );
+	*cols = grid->cols;
+	*rows = grid->rows;
+}
+
+void ui_grid_set( int id, size_t x, size_t y, char ch, Colour fg, bool bold ) {
+	grid_set( get_grid( id ), x, y, ch, fg, bold );
+}
+
+void ui_grid_clear( int id ) {
+	grid_clear( get_grid( id ) );
+}
+
+void ui_set_split( size_t rows ) {
+	textbox_set_split( &main_text, rows );
 }
 
 void ui_page_down() {
-	textbox_page_down( &main_text );
+	textbox_page_down( scroll_target() );
 }
 
 void ui_page_up() {
-	textbox_page_up( &main_text );
+	textbox_page_up( scroll_target() );
+}
+
+bool ui_find( const char * query, size_t len ) {
+	return textbox_find( &main_text, query, len );
+}
+
+bool ui_find_next( bool older ) {
+	return textbox_find_next( &main_text, older );
+}
+
+void ui_clear_find() {
+	textbox_clear_search( &main_text );
 }
 
 void ui_mouse_down( int x, int y ) {
+	mouse_x = x;
+	mouse_y = y;
+
 	textbox_mouse_down( &main_text, x, y );
 	textbox_mouse_down( &chat_text, x, y );
+	for( Window & window : windows ) {
+		if( window.open && !window.is_grid ) {
+			textbox_mouse_down( &window.text, x, y );
+		}
+	}
 }
 
 void ui_mouse_up( int x, int y ) {
+	mouse_x = x;
+	mouse_y = y;
+
 	textbox_mouse_up( &main_text, x, y );
 	textbox_mouse_up( &chat_text, x, y );
+	for( Window & window : windows ) {
+		if( window.open && !window.is_grid ) {
+			textbox_mouse_up( &window.text, x, y );
+		}
+	}
 }
 
 void ui_mouse_move( int x, int y ) {
+	mouse_x = x;
+	mouse_y = y;
+
 	textbox_mouse_move( &main_text, x, y );
 	textbox_mouse_move( &chat_text, x, y );
+	for( Window & window : windows ) {
+		if( window.open && !window.is_grid ) {
+			textbox_mouse_move( &window.text, x, y );
+		}
+	}
+}
+
+// positive notches scroll up
+void ui_mouse_wheel( int x, int y, int notches ) {
+	mouse_x = x;
+	mouse_y = y;
+
+	ui_scroll( notches * SCROLL_ROWS_PER_WHEEL_NOTCH );
 }
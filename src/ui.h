@@ -33,19 +33,52 @@ void ui_chat_print( const char * str, size_t len, Colour fg, Colour bg, bool bol
 void ui_fill_rect( int left, int top, int width, int height, Colour colour, bool bold );
 void ui_draw_char( int left, int top, char c, Colour colour, bool bold, bool force_bold_font = false );
 
+// redraws the text boxes, for when something changes how text is drawn
+void ui_restyle_text();
+
+bool ui_needs_redraw();
 void ui_redraw_dirty();
 void ui_redraw_everything();
 
 void ui_update_layout();
+// seconds of background work to do at a time while we're otherwise idle
+constexpr double UI_IDLE_BUDGET = 0.005;
+bool ui_idle( double budget );
 void ui_resize( int width, int height );
 
 void ui_scroll( int offset );
 void ui_page_down();
 void ui_page_up();
+void ui_set_split( size_t rows );
+
+enum WindowPosition : u8 {
+	WINDOW_TOP,
+	WINDOW_BOTTOM,
+};
+
+// extra textboxes for scripts to print to. returns -1 if there are already
+// MAX_WINDOWS, ids get reused after ui_window_close
+int ui_window_open( size_t rows, WindowPosition position, size_t scrollback );
+void ui_window_layout( int id, size_t rows, WindowPosition position );
+void ui_window_close( int id );
+void ui_window_print( int id, const char * str, size_t len, Colour fg, Colour bg, bool bold );
+void ui_window_newline( int id );
+
+// grid windows are a fixed block of cells, see grid.h. they go through
+// ui_window_layout and ui_window_close too, but keep their own row count
+int ui_grid_open( size_t cols, size_t rows, WindowPosition position );
+void ui_grid_size( int id, size_t * cols, size_t * rows );
+void ui_grid_set( int id, size_t x, size_t y, char ch, Colour fg, bool bold );
+void ui_grid_clear( int id );
+
+bool ui_find( const char * query, size_t len );
+bool ui_find_next( bool older );
+void ui_clear_find();
 
 void ui_mouse_down( int x, int y );
 void ui_mouse_move( int x, int y );
 void ui_mouse_up( int x, int y );
+void ui_mouse_wheel( int x, int y, int notches );
 
 void ui_get_font_size( int * fw, int * fh );
 
@@ -54,7 +87,7 @@ void ui_urgent();
 void ui_init();
 void ui_term();
 
-void * platform_connect( const char ** err, const char * host, int port );
+void * platform_connect( const char ** err, const char * host, int port, bool telnet );
 void platform_send( void * sock, const char * data, size_t len );
 void platform_close( void * sock );
 
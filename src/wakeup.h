@@ -0,0 +1,113 @@
+#pragma once
+
+#include "platform.h"
+#include "common.h"
+
+/*
+ * lets one thread wake another that's blocked in poll/wait. signals
+ * coalesce, so drain once and then check everything you're waiting on
+ */
+
+#if PLATFORM_WINDOWS
+
+#include <windows.h>
+
+struct Wakeup {
+	HANDLE event;
+};
+
+inline void wakeup_init( Wakeup * w ) {
+	w->event = CreateEventA( NULL, FALSE, FALSE, NULL );
+	if( w->event == NULL )
+		FATAL( "CreateEvent" );
+}
+
+inline void wakeup_term( Wakeup * w ) {
+	CloseHandle( w->event );
+}
+
+inline void wakeup_signal( Wakeup * w ) {
+	SetEvent( w->event );
+}
+
+// auto-reset event, nothing to drain
+inline void wakeup_drain( Wakeup * w ) { }
+
+inline void wakeup_wait( Wakeup * w, int timeout_ms ) {
+	WaitForSingleObject( w->event, timeout_ms < 0 ? INFINITE : DWORD( timeout_ms ) );
+}
+
+#elif PLATFORM_UNIX
+
+#include <errno.h>
+#include <fcntl.h>
+#include <poll.h>
+#include <unistd.h>
+
+#if PLATFORM_LINUX
+#include <sys/eventfd.h>
+#endif
+
+struct Wakeup {
+	int read_fd;
+	int write_fd;
+};
+
+inline void wakeup_init( Wakeup * w ) {
+#if PLATFORM_LINUX
+	int fd = eventfd( 0, EFD_NONBLOCK | EFD_CLOEXEC );
+	if( fd == -1 )
+		FATAL( "eventfd" );
+	w->read_fd = fd;
+	w->write_fd = fd;
+#else
+	int fds[ 2 ];
+	if( pipe( fds ) == -1 )
+		FATAL( "pipe" );
+
+	// nobody should ever block on these
+	for( int fd : fds ) {
+		int flags = fcntl( fd, F_GETFL );
+		if( flags == -1 || fcntl( fd, F_SETFL, flags | O_NONBLOCK ) == -1 )
+			FATAL( "fcntl" );
+	}
+
+	w->read_fd = fds[ 0 ];
+	w->write_fd = fds[ 1 ];
+#endif
+}
+
+inline void wakeup_term( Wakeup * w ) {
+	close( w->read_fd );
+	if( w->write_fd != w->read_fd )
+		close( w->write_fd );
+}
+
+inline void wakeup_signal( Wakeup * w ) {
+	u64 one = 1;
+	ssize_t ok = write( w->write_fd, &one, sizeof( one ) );
+	// EAGAIN means there's already a wakeup pending
+	if( ok == -1 && errno != EAGAIN )
+		FATAL( "write" );
+}
+
+inline void wakeup_drain( Wakeup * w ) {
+	u64 buf[ 8 ];
+	while( read( w->read_fd, buf, sizeof( buf ) ) > 0 )
+		continue;
+}
+
+inline int wakeup_fd( const Wakeup * w ) {
+	return w->read_fd;
+}
+
+inline void wakeup_wait( Wakeup * w, int timeout_ms ) {
+	pollfd fd = { };
+	fd.fd = w->read_fd;
+	fd.events = POLLIN;
+	poll( &fd, 1, timeout_ms );
+}
+
+#else
+#error new platform
+#endif
@@ -2,13 +2,19 @@
 #include <windowsx.h>
 #include <Winsock2.h>
 #include <stdio.h>
+#include <math.h>
 
 #include "common.h"
 #include "input.h"
+#include "log_writer.h"
+#include "lua_alloc.h"
 #include "script.h"
+#include "telnet.h"
+#include "timers.h"
 #include "ui.h"
 
 #include "platform_network.h"
+#include "platform_time.h"
 
 #define WINDOW_CLASSNAME "MudGangsterClass"
 
@@ -25,11 +31,13 @@ struct {
 struct Socket {
 	TCPSocket sock;
 	bool in_use;
+	bool telnet;
+	TelnetDecoder decoder;
 };
 
 static Socket sockets[ 128 ];
 
-void * platform_connect( const char ** err, const char * host, int port ) {
+void * platform_connect( const char ** err, const char * host, int port, bool telnet ) {
 	size_t idx;
 	{
 		bool ok = false;
@@ -64,6 +72,8 @@ void * platform_connect( const char ** err, const char * host, int port ) {
 
 	sockets[ idx ].sock = sock;
 	sockets[ idx ].in_use = true;
+	sockets[ idx ].telnet = telnet;
+	telnet_init( &sockets[ idx ].decoder );
 
 	WSAAsyncSelect( sock.fd, UI.hwnd, 12345, FD_READ | FD_CLOSE );
 
@@ -81,6 +91,27 @@ void platform_close( void * vsock ) {
 	sock->in_use = false;
 }
 
+static void on_telnet_event( void * sock, TelnetEventType type, const char * data, size_t len ) {
+	// the scripts might close the socket halfway through a packet
+	if( !( ( Socket * ) sock )->in_use )
+		return;
+
+	switch( type ) {
+		case TELNET_LINE:
+			script_socketLine( sock, data, len, false );
+			break;
+		case TELNET_PROMPT:
+			script_socketLine( sock, data, len, true );
+			break;
+		case TELNET_ECHO_ON:
+			script_socketEcho( sock, true );
+			break;
+		case TELNET_ECHO_OFF:
+			script_socketEcho( sock, false );
+			break;
+	}
+}
+
 static Socket * socket_from_fd( int fd ) {
 	for( Socket & sock : sockets ) {
 		if( sock.in_use && sock.sock.fd == fd ) {
@@ -328,6 +359,13 @@ static LRESULT CALLBACK WndProc( HWND hwnd, UINT msg, WPARAM wParam, LPARAM lPar
 			ui_mouse_up( GET_X_LPARAM( lParam ), GET_Y_LPARAM( lParam ) );
 		} break;
 
+		case WM_MOUSEWHEEL: {
+			// wheel messages come with screen coordinates
+			POINT p = { GET_X_LPARAM( lParam ), GET_Y_LPARAM( lParam ) };
+			ScreenToClient( hwnd, &p );
+			ui_mouse_wheel( p.x, p.y, GET_WHEEL_DELTA_WPARAM( wParam ) / WHEEL_DELTA );
+		} break;
+
 		case WM_CLOSE: {
 			DestroyWindow( hwnd );
 		} break;
@@ -337,7 +375,8 @@ static LRESULT CALLBACK WndProc( HWND hwnd, UINT msg, WPARAM wParam, LPARAM lPar
 		} break;
 
 		case WM_TIMER: {
-			script_fire_intervals();
+			KillTimer( UI.hwnd, 1 );
+			script_fire_timers();
 		} break;
 
 		case WM_CHAR: {
@@ -470,7 +509,15 @@ static LRESULT CALLBACK WndProc( HWND hwnd, UINT msg, WPARAM wParam, LPARAM lPar
 				char buf[ 2048 ];
 				int n = recv( fd, buf, sizeof( buf ), 0 );
 				if( n > 0 ) {
-					script_socketData( sock, buf, n );
+					ArenaScope packet( &frame_arena );
+
+					if( sock->telnet )
+						telnet_decode( &sock->decoder, buf, n, on_telnet_event, sock );
+					else
+						script_socketData( sock, buf, n );
+
+					if( !sock->in_use )
+						break;
 				}
 				else if( n == 0 ) {
 					script_socketData( sock, NULL, n );
@@ -528,6 +575,17 @@ static bool is_macro( const MSG * msg ) {
 	return ctrl || alt;
 }
 
+static void schedule_timer() {
+	double deadline;
+	if( !timers_next_deadline( &deadline ) ) {
+		KillTimer( UI.hwnd, 1 );
+		return;
+	}
+
+	double ms = ceil( ( deadline - get_time() ) * 1000.0 );
+	SetTimer( UI.hwnd, 1, UINT( max( 0.0, min( ms, double( USER_TIMER_MAXIMUM ) ) ) ), NULL );
+}
+
 int WINAPI WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLine, int nCmdShow ) {
 	for( Socket & s : sockets ) {
 		s.in_use = false;
@@ -566,23 +624,44 @@ int WINAPI WinMain( HINSTANCE hInstance, HINSTANCE hPrevInstance, LPSTR lpCmdLin
 
 	ShowWindow( UI.hwnd, SW_MAXIMIZE );
 	UpdateWindow( UI.hwnd );
-	SetTimer( UI.hwnd, 1, 500, NULL );
 
 	net_init();
+	log_writer_init();
 	ui_init();
+	timers_init();
 	script_init();
 
 	FrameMark;
 
 	MSG msg;
-	while( GetMessage( &msg, NULL, 0, 0 ) > 0 ) {
+	while( true ) {
+		// collect garbage while we'd otherwise be blocked in GetMessage
+		if( PeekMessage( &msg, NULL, 0, 0, PM_NOREMOVE ) == FALSE ) {
+			while( ui_idle( UI_IDLE_BUDGET ) && PeekMessage( &msg, NULL, 0, 0, PM_NOREMOVE ) == FALSE )
+				continue;
+
+			double deadline;
+			script_idle( timers_next_deadline( &deadline ) ? deadline - get_time() : HUGE_VAL );
+		}
+
+		if( GetMessage( &msg, NULL, 0, 0 ) <= 0 )
+			break;
+
+		arena_next_frame( &frame_arena, "Frame arena bytes" );
+		lua_alloc_plot();
+
 		if( !is_macro( &msg ) )
 			TranslateMessage( &msg );
 		DispatchMessage( &msg );
+
+		// Windows only wakes us for timers we ask for
+		schedule_timer();
 	}
 
 	script_term();
+	timers_term();
 	ui_term();
+	log_writer_term();
 	net_term();
 
 	// TODO: clean up UI stuff
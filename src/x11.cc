@@ -1,4 +1,7 @@
 #include <err.h>
+#include <errno.h>
+#include <limits.h>
+#include <math.h>
 #include <poll.h>
 
 #include <X11/Xutil.h>
@@ -8,73 +11,33 @@
 
 #include "common.h"
 #include "input.h"
+#include "log_writer.h"
+#include "lua_alloc.h"
+#include "net_thread.h"
 #include "script.h"
+#include "timers.h"
 #include "ui.h"
 
 #include "platform_ui.h"
 #include "platform_network.h"
+#include "platform_time.h"
 
 #include "libclipboard/libclipboard.h"
 
-struct Socket {
-	TCPSocket sock;
-	bool in_use;
-};
-
-static Socket sockets[ 128 ];
-
 static bool closing = false;
 
 static clipboard_c * clipboard;
 
-void * platform_connect( const char ** err, const char * host, int port ) {
-	size_t idx;
-	{
-		bool ok = false;
-		for( size_t i = 0; i < ARRAY_COUNT( sockets ); i++ ) {
-			if( !sockets[ i ].in_use ) {
-				idx = i;
-				ok = true;
-				break;
-			}
-		}
-
-		if( !ok ) {
-			*err = "too many connections";
-			return NULL;
-		}
-	}
-
-	NetAddress addr;
-	{
-		bool ok = dns_first( host, &addr );
-		if( !ok ) {
-			*err = "couldn't resolve hostname"; // TODO: error from dns_first
-			return NULL;
-		}
-	}
-	addr.port = checked_cast< u16 >( port );
-
-	TCPSocket sock;
-	bool ok = net_new_tcp( &sock, addr, err );
-	if( !ok )
-		return NULL;
-
-	sockets[ idx ].sock = sock;
-	sockets[ idx ].in_use = true;
-
-	return &sockets[ idx ];
+void * platform_connect( const char ** err, const char * host, int port, bool telnet ) {
+	return net_thread_connect( err, host, port, telnet );
 }
 
-void platform_send( void * vsock, const char * data, size_t len ) {
-	Socket * sock = ( Socket * ) vsock;
-	net_send( sock->sock, data, len );
+void platform_send( void * sock, const char * data, size_t len ) {
+	net_thread_send( sock, data, len );
 }
 
-void platform_close( void * vsock ) {
-	Socket * sock = ( Socket * ) vsock;
-	net_destroy( &sock->sock );
-	sock->in_use = false;
+void platform_close( void * sock ) {
+	net_thread_close( sock );
 }
 
 struct {
@@ -93,6 +56,7 @@ struct {
 
 	bool dirty;
 	int dirty_left, dirty_top, dirty_right, dirty_bottom;
+	double next_frame_time;
 
 	bool has_focus;
 } UI;
@@ -199,7 +163,13 @@ void platform_draw_char( int left, int top, char c, Colour colour, bool bold, bo
 static Atom wmDeleteWindow;
 
 static void event_mouse_down( XEvent * xevent ) {
-	ui_mouse_down( xevent->xbutton.x, xevent->xbutton.y );
+	// X sends wheel notches as presses of buttons 4 and 5
+	if( xevent->xbutton.button == Button4 )
+		ui_mouse_wheel( xevent->xbutton.x, xevent->xbutton.y, 1 );
+	else if( xevent->xbutton.button == Button5 )
+		ui_mouse_wheel( xevent->xbutton.x, xevent->xbutton.y, -1 );
+	else
+		ui_mouse_down( xevent->xbutton.x, xevent->xbutton.y );
 }
 
 static void event_mouse_move( XEvent * xevent ) {
@@ -207,7 +177,8 @@ static void event_mouse_move( XEvent * xevent ) {
 }
 
 static void event_mouse_up( XEvent * xevent ) {
-	ui_mouse_up( xevent->xbutton.x, xevent->xbutton.y );
+	if( xevent->xbutton.button != Button4 && xevent->xbutton.button != Button5 )
+		ui_mouse_up( xevent->xbutton.x, xevent->xbutton.y );
 }
 
 static void event_message( XEvent * xevent ) {
@@ -419,25 +390,35 @@ static void ui_handleXEvents() {
 	event_names[ FocusOut ] = "FocusOut";
 	event_names[ FocusIn ] = "FocusIn";
 
-	do {
-		while( XPending( UI.display ) ) {
-			XEvent event;
-			XNextEvent( UI.display, &event );
+	while( XPending( UI.display ) ) {
+		XEvent event;
+		XNextEvent( UI.display, &event );
 
-			if( event_handlers[ event.type ] != NULL ) {
-				// printf( "%s\n", event_names[ event.type ] );
-				event_handlers[ event.type ]( &event );
-			}
+		if( event_handlers[ event.type ] != NULL ) {
+			// printf( "%s\n", event_names[ event.type ] );
+			event_handlers[ event.type ]( &event );
 		}
+	}
 
-		ui_redraw_dirty();
+	// coalesce redraws when we're getting spammed, the main loop wakes us
+	// up again when the frame is due
+	double now = get_time();
+	if( now < UI.next_frame_time )
+		return;
 
-		if( UI.dirty ) {
-			XCopyArea( UI.display, UI.back_buffer, UI.window, UI.gc, UI.dirty_left, UI.dirty_top, UI.dirty_right - UI.dirty_left, UI.dirty_bottom - UI.dirty_top, UI.dirty_left, UI.dirty_top );
-			UI.dirty = false;
-			ui_handleXEvents();
-		}
-	} while( UI.dirty );
+	ui_redraw_dirty();
+
+	if( UI.dirty ) {
+		XCopyArea( UI.display, UI.back_buffer, UI.window, UI.gc, UI.dirty_left, UI.dirty_top, UI.dirty_right - UI.dirty_left, UI.dirty_bottom - UI.dirty_top, UI.dirty_left, UI.dirty_top );
+		XFlush( UI.display );
+		UI.dirty = false;
+		UI.next_frame_time = now + 1.0 / MAX_FPS;
+		FrameMark;
+	}
+}
+
+static bool frame_pending() {
+	return UI.dirty || ui_needs_redraw();
 }
 
 static MudFont load_font( const char * regular_name, const char * bold_name ) {
@@ -494,10 +475,6 @@ static void initStyle() {
 void platform_ui_init() {
 	ZoneScoped;
 
-	for( Socket & s : sockets ) {
-		s.in_use = false;
-	}
-
 	int default_width = 800;
 	int default_height = 600;
 
@@ -580,20 +557,30 @@ void platform_ui_term() {
 	XCloseDisplay( UI.display );
 }
 
-static Socket * socket_from_fd( int fd ) {
-	for( Socket & sock : sockets ) {
-		if( sock.in_use && sock.sock.fd == fd ) {
-			return &sock;
-		}
+static int poll_timeout() {
+	double deadline;
+	bool have_deadline = timers_next_deadline( &deadline );
+
+	if( frame_pending() ) {
+		deadline = have_deadline ? min( deadline, UI.next_frame_time ) : UI.next_frame_time;
+		have_deadline = true;
 	}
 
-	return NULL;
+	// nothing to do until we get input
+	if( !have_deadline )
+		return -1;
+
+	double ms = ceil( ( deadline - get_time() ) * 1000.0 );
+	return int( max( 0.0, min( ms, double( INT_MAX ) ) ) );
 }
 
 int main() {
 	net_init();
+	net_thread_init();
+	log_writer_init();
 	ui_init();
 	platform_ui_init();
+	timers_init();
 	script_init();
 
 	clipboard = clipboard_new( NULL );
@@ -601,49 +588,37 @@ int main() {
 		FATAL( "clipboard_new" );
 	}
 
-	FrameMark;
-
 	ui_handleXEvents();
 
 	while( !closing ) {
-		pollfd fds[ ARRAY_COUNT( sockets ) + 1 ] = { };
-		nfds_t num_fds = 1;
+		pollfd fds[ 2 ] = { };
 
 		fds[ 0 ].fd = ConnectionNumber( UI.display );
 		fds[ 0 ].events = POLLIN;
 
-		for( Socket sock : sockets ) {
-			if( sock.in_use ) {
-				fds[ num_fds ].fd = sock.sock.fd;
-				fds[ num_fds ].events = POLLIN;
-				num_fds++;
-			}
+		fds[ 1 ].fd = net_thread_wakeup_fd();
+		fds[ 1 ].events = POLLIN;
+
+		// use the time we'd spend blocked to collect garbage, so it doesn't
+		// happen in the middle of handling a line
+		int timeout = poll_timeout();
+		if( timeout != 0 ) {
+			bool more = ui_idle( UI_IDLE_BUDGET );
+			script_idle( timeout < 0 ? HUGE_VAL : timeout / 1000.0 );
+			timeout = more ? 0 : poll_timeout();
 		}
 
-		int ok = poll( fds, num_fds, 500 );
-		if( ok == -1 )
+		int ok = poll( fds, ARRAY_COUNT( fds ), timeout );
+		if( ok == -1 && errno != EINTR )
 			FATAL( "poll" );
 
-		script_fire_intervals();
+		arena_next_frame( &frame_arena, "Frame arena bytes" );
+		lua_alloc_plot();
 
-		for( size_t i = 1; i < ARRAY_COUNT( fds ); i++ ) {
-			if( fds[ i ].revents & POLLIN ) {
-				Socket * sock = socket_from_fd( fds[ i ].fd );
-				assert( sock != NULL );
+		script_fire_timers();
 
-				char buf[ 8192 ];
-				size_t n;
-				TCPRecvResult res = net_recv( sock->sock, buf, sizeof( buf ), &n );
-				if( res == TCP_OK ) {
-					script_socketData( sock, buf, n );
-				}
-				else if( res == TCP_CLOSED ) {
-					script_socketData( sock, NULL, 0 );
-				}
-				else {
-					FATAL( "net_recv" );
-				}
-			}
+		if( fds[ 1 ].revents & POLLIN ) {
+			net_thread_dispatch();
 		}
 
 		ui_handleXEvents();
@@ -652,8 +627,11 @@ int main() {
 	clipboard_free( clipboard );
 
 	script_term();
+	timers_term();
 	platform_ui_term();
 	ui_term();
+	log_writer_term();
+	net_thread_term();
 	net_term();
 
 	return 0;
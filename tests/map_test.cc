@@ -0,0 +1,287 @@
+#include <stdio.h>
+
+#include "common.h"
+#include "array.h"
+#include "map.h"
+
+/*
+ * builds maps, finds paths, saves, loads and finds the same paths again.
+ * every path gets walked through the room's exits to check it goes where
+ * it says for what it says, and A* gets checked against Dijkstra, which we
+ * force by adding a room with no coordinates. A* that overestimates finds
+ * paths that cost more
+ */
+
+static const char * MAP_PATH = "map_test.map";
+
+static constexpr int GRID_SIZE = 30;
+static constexpr int NUM_PATHS = 2000;
+
+struct RNG {
+	u64 state;
+};
+
+static u32 rng_next( RNG * rng ) {
+	rng->state ^= rng->state << 13;
+	rng->state ^= rng->state >> 7;
+	rng->state ^= rng->state << 17;
+	return u32( rng->state >> 32 );
+}
+
+// inclusive
+static u32 rng_range( RNG * rng, u32 lo, u32 hi ) {
+	return lo + rng_next( rng ) % ( hi - lo + 1 );
+}
+
+static Span< const char > str( const char * s ) {
+	return Span< const char >( s, strlen( s ) );
+}
+
+static bool equal( Span< const char > a, Span< const char > b ) {
+	return a.n == b.n && ( a.n == 0 || memcmp( a.ptr, b.ptr, a.n ) == 0 );
+}
+
+// follows the commands from one room and returns what they cost, or fails
+// if they don't lead to the other room
+static u32 walk( u32 from, u32 to, u32 avoid, const DynamicArray< Span< const char > > & commands ) {
+	DynamicArray< MapExit > exits;
+	MapRoom room;
+	u32 here = from;
+	u32 cost = 0;
+
+	for( Span< const char > command : commands ) {
+		if( !map_get_room( here, &room, &exits ) )
+			FATAL( "walked into missing room %u\n", here );
+
+		const MapExit * taken = NULL;
+		for( const MapExit & exit : exits ) {
+			if( equal( exit.command, command ) ) {
+				taken = &exit;
+				break;
+			}
+		}
+		if( taken == NULL )
+			FATAL( "room %u has no exit %.*s\n", here, int( command.n ), command.ptr );
+
+		here = taken->to;
+		cost += taken->cost;
+
+		if( !map_get_room( here, &room, &exits ) )
+			FATAL( "walked into missing room %u\n", here );
+		if( here != to && ( room.flags & avoid ) != 0 )
+			FATAL( "path from %u to %u walks through avoided room %u\n", from, to, here );
+		cost += room.cost;
+	}
+
+	if( here != to )
+		FATAL( "path from %u to %u ends in %u\n", from, to, here );
+
+	return cost;
+}
+
+static u32 path_cost( u32 from, u32 to, u32 avoid ) {
+	DynamicArray< Span< const char > > commands;
+	u32 cost;
+	if( !map_path( from, to, avoid, &commands, &cost ) )
+		return UINT32_MAX;
+
+	u32 walked = walk( from, to, avoid, commands );
+	if( walked != cost )
+		FATAL( "path from %u to %u says it costs %u but walking it costs %u\n", from, to, cost, walked );
+
+	return cost;
+}
+
+static void save_and_load() {
+	const char * err;
+	size_t num_rooms = map_num_rooms();
+
+	if( !map_save( &err, MAP_PATH ) )
+		FATAL( "map_save: %s\n", err );
+	map_clear();
+	if( !map_load( &err, MAP_PATH ) )
+		FATAL( "map_load: %s\n", err );
+
+	if( map_num_rooms() != num_rooms )
+		FATAL( "saved %zu rooms but loaded %zu\n", num_rooms, map_num_rooms() );
+}
+
+static void expect_cost( u32 from, u32 to, u32 expected, const char * when ) {
+	u32 cost = path_cost( from, to, 0 );
+	if( cost != expected )
+		FATAL( "path from %u to %u costs %u %s, expected %u\n", from, to, cost, when, expected );
+}
+
+static void test_jump() {
+	// a chain of cheap exits and an expensive exit that skips it. the jump
+	// is the longest step so it's what A*'s heuristic has to allow for
+	map_clear();
+	for( u32 i = 1; i <= 4; i++ ) {
+		map_set_room( i, str( "" ), 0, 0 );
+		map_set_coords( i, int( i ) * 10, 0, 0 );
+	}
+	map_set_exit( 1, str( "e" ), 2, 1 );
+	map_set_exit( 2, str( "e" ), 3, 1 );
+	map_set_exit( 3, str( "e" ), 4, 1 );
+	map_set_exit( 1, str( "jump" ), 4, 5 );
+
+	expect_cost( 1, 4, 3, "before saving" );
+	save_and_load();
+	expect_cost( 1, 4, 3, "after loading" );
+
+	printf( "jump: ok\n" );
+}
+
+static u32 grid_id( int x, int y ) {
+	return u32( y * GRID_SIZE + x ) * 7 + 1000;
+}
+
+static void build_grid( RNG * rng ) {
+	map_clear();
+
+	for( int y = 0; y < GRID_SIZE; y++ ) {
+		for( int x = 0; x < GRID_SIZE; x++ ) {
+			char name[ 64 ];
+			snprintf( name, sizeof( name ), "Room %d,%d", x, y );
+			u32 flags = rng_next( rng ) % 8 == 0 ? 1 : 0;
+			u32 cost = rng_next( rng ) % 4 == 0 ? rng_range( rng, 1, 20 ) : 0;
+			map_set_room( grid_id( x, y ), str( name ), flags, cost );
+			map_set_coords( grid_id( x, y ), x, y, 0 );
+		}
+	}
+
+	for( int y = 0; y < GRID_SIZE; y++ ) {
+		for( int x = 0; x < GRID_SIZE; x++ ) {
+			if( x > 0 ) {
+				map_set_exit( grid_id( x, y ), str( "w" ), grid_id( x - 1, y ), rng_range( rng, 1, 9 ) );
+				map_set_exit( grid_id( x - 1, y ), str( "e" ), grid_id( x, y ), rng_range( rng, 1, 9 ) );
+			}
+			if( y > 0 ) {
+				map_set_exit( grid_id( x, y ), str( "n" ), grid_id( x, y - 1 ), rng_range( rng, 1, 9 ) );
+				map_set_exit( grid_id( x, y - 1 ), str( "s" ), grid_id( x, y ), rng_range( rng, 1, 9 ) );
+			}
+		}
+	}
+
+	// portals across the map
+	for( int i = 0; i < 20; i++ ) {
+		u32 from = grid_id( int( rng_range( rng, 0, GRID_SIZE - 1 ) ), int( rng_range( rng, 0, GRID_SIZE - 1 ) ) );
+		u32 to = grid_id( int( rng_range( rng, 0, GRID_SIZE - 1 ) ), int( rng_range( rng, 0, GRID_SIZE - 1 ) ) );
+		map_set_exit( from, str( "enter portal;say hi" ), to, rng_range( rng, 1, 5 ) );
+	}
+
+	// and knock some holes in it
+	for( int i = 0; i < 100; i++ ) {
+		u32 from = grid_id( int( rng_range( rng, 0, GRID_SIZE - 1 ) ), int( rng_range( rng, 0, GRID_SIZE - 1 ) ) );
+		map_remove_exit( from, str( "n" ) );
+	}
+}
+
+static void test_grid() {
+	RNG rng = { 0x9e3779b97f4a7c15 };
+	build_grid( &rng );
+
+	struct Path {
+		u32 from, to, avoid;
+		u32 cost;
+	};
+
+	DynamicArray< Path > paths;
+	for( int i = 0; i < NUM_PATHS; i++ ) {
+		Path path;
+		path.from = grid_id( int( rng_range( &rng, 0, GRID_SIZE - 1 ) ), int( rng_range( &rng, 0, GRID_SIZE - 1 ) ) );
+		path.to = grid_id( int( rng_range( &rng, 0, GRID_SIZE - 1 ) ), int( rng_range( &rng, 0, GRID_SIZE - 1 ) ) );
+		path.avoid = rng_next( &rng ) % 2;
+		path.cost = path_cost( path.from, path.to, path.avoid );
+		paths.add( path );
+	}
+
+	// no coordinates anywhere means Dijkstra
+	const u32 OFF_MAP = 1;
+	map_set_room( OFF_MAP, str( "off the map" ), 0, 0 );
+	for( const Path & path : paths ) {
+		u32 cost = path_cost( path.from, path.to, path.avoid );
+		if( cost != path.cost )
+			FATAL( "path from %u to %u costs %u with A* but %u with Dijkstra\n", path.from, path.to, path.cost, cost );
+	}
+	map_remove_room( OFF_MAP );
+
+	save_and_load();
+
+	for( const Path & path : paths ) {
+		u32 cost = path_cost( path.from, path.to, path.avoid );
+		if( cost != path.cost )
+			FATAL( "path from %u to %u costs %u before saving but %u after loading\n", path.from, path.to, path.cost, cost );
+	}
+
+	printf( "grid: ok\n" );
+}
+
+static void write_file( const u8 * data, size_t n ) {
+	FILE * file = fopen( MAP_PATH, "wb" );
+	if( file == NULL || fwrite( data, 1, n, file ) != n || fclose( file ) != 0 )
+		FATAL( "couldn't write %s\n", MAP_PATH );
+}
+
+static void expect_load_fails( const char * what ) {
+	const char * err;
+	size_t num_rooms = map_num_rooms();
+
+	if( map_load( &err, MAP_PATH ) )
+		FATAL( "loaded a map with %s\n", what );
+	if( map_num_rooms() != num_rooms )
+		FATAL( "loading a map with %s changed the map\n", what );
+}
+
+static void test_bad_files() {
+	map_clear();
+	map_set_room( 1, str( "a" ), 0, 0 );
+	map_set_exit( 1, str( "e" ), 2, 1 );
+
+	// two rooms with id 5, no flags, cost or coordinates, empty names and
+	// no exits
+	const u8 duplicates[] = {
+		'M', 'G', 'M', 'A', 'P', 0, 0, 1,
+		2,
+		5, 0, 0, 0, 0, 0,
+		5, 0, 0, 0, 0, 0,
+	};
+	write_file( duplicates, sizeof( duplicates ) );
+	expect_load_fails( "duplicate room ids" );
+
+	const u8 unique[] = {
+		'M', 'G', 'M', 'A', 'P', 0, 0, 1,
+		2,
+		5, 0, 0, 0, 0, 0,
+		6, 0, 0, 0, 0, 0,
+	};
+	write_file( unique, sizeof( unique ) );
+	const char * err;
+	if( !map_load( &err, MAP_PATH ) || map_num_rooms() != 2 )
+		FATAL( "couldn't load a map with two rooms\n" );
+
+	write_file( unique, sizeof( unique ) - 1 );
+	expect_load_fails( "a room cut off" );
+
+	const u8 bad_exit[] = {
+		'M', 'G', 'M', 'A', 'P', 0, 0, 1,
+		1,
+		5, 0, 0, 0, 0, 1, 1, 1, 0,
+	};
+	write_file( bad_exit, sizeof( bad_exit ) );
+	expect_load_fails( "an exit to a room that isn't there" );
+
+	printf( "bad files: ok\n" );
+}
+
+int main() {
+	// FATAL aborts without flushing
+	setvbuf( stdout, NULL, _IONBF, 0 );
+
+	test_jump();
+	test_grid();
+	test_bad_files();
+
+	remove( MAP_PATH );
+	return 0;
+}
@@ -0,0 +1,141 @@
+#include <stdio.h>
+
+#include "common.h"
+#include "session_log.h"
+
+#include <unistd.h>
+
+/*
+ * writes logs, damages them the ways a crash can, reopens them and checks
+ * open put them back together: a torn record at the end of the log, an
+ * index that points past the end of the log, and an index that's missing
+ * entries for the end of the log. every line that survives has to read
+ * back exactly, and appending afterwards has to carry on where it left off
+ */
+
+static const char * LOG_PATH = "session_log_test.log";
+static const char * INDEX_PATH = "session_log_test.log.idx";
+
+static TextBox::Line line;
+static TextBox::Line read_back;
+
+static void make_line( size_t n, TextBox::Line * out ) {
+	char text[ 64 ];
+	int len = snprintf( text, sizeof( text ), "line %zu %.*s", n, int( n % 40 ), "........................................" );
+
+	out->len = size_t( len );
+	for( size_t i = 0; i < out->len; i++ ) {
+		out->glyphs[ i ].ch = text[ i ];
+		out->glyphs[ i ].style = u8( ( n + i / 4 ) % 16 );
+	}
+}
+
+static void remove_files() {
+	remove( LOG_PATH );
+	remove( INDEX_PATH );
+}
+
+static size_t file_size( const char * path ) {
+	FILE * file = fopen( path, "rb" );
+	if( file == NULL || fseek( file, 0, SEEK_END ) != 0 )
+		FATAL( "couldn't open %s\n", path );
+	long size = ftell( file );
+	fclose( file );
+	return size_t( size );
+}
+
+static void truncate_to( const char * path, size_t size ) {
+	if( truncate( path, off_t( size ) ) != 0 )
+		FATAL( "couldn't truncate %s\n", path );
+}
+
+static SessionLog * open_log() {
+	const char * err;
+	SessionLog * log = session_log_open( &err, LOG_PATH );
+	if( log == NULL )
+		FATAL( "session_log_open: %s\n", err );
+	return log;
+}
+
+static void append_lines( size_t first, size_t count ) {
+	SessionLog * log = open_log();
+	if( session_log_num_lines( log ) != first )
+		FATAL( "log has %zu lines, expected %zu\n", session_log_num_lines( log ), first );
+
+	for( size_t i = first; i < first + count; i++ ) {
+		make_line( i, &line );
+		session_log_append( log, line );
+	}
+
+	session_log_close( log );
+}
+
+static void check_lines( const char * when, size_t expected ) {
+	SessionLog * log = open_log();
+
+	if( session_log_num_lines( log ) != expected )
+		FATAL( "%s: log has %zu lines, expected %zu\n", when, session_log_num_lines( log ), expected );
+
+	for( size_t i = 0; i < expected; i++ ) {
+		make_line( i, &line );
+		if( !session_log_read( log, i, &read_back ) )
+			FATAL( "%s: couldn't read line %zu\n", when, i );
+
+		bool same = read_back.len == line.len;
+		for( size_t j = 0; same && j < line.len; j++ ) {
+			same = read_back.glyphs[ j ].ch == line.glyphs[ j ].ch && read_back.glyphs[ j ].style == line.glyphs[ j ].style;
+		}
+		if( !same )
+			FATAL( "%s: line %zu is wrong\n", when, i );
+	}
+
+	if( session_log_read( log, expected, &read_back ) )
+		FATAL( "%s: read a line past the end\n", when );
+
+	session_log_close( log );
+
+	printf( "%s: ok\n", when );
+}
+
+int main() {
+	// FATAL aborts without flushing
+	setvbuf( stdout, NULL, _IONBF, 0 );
+
+	remove_files();
+
+	// enough lines for a few index entries, and a partial stride at the end
+	append_lines( 0, 200 );
+	check_lines( "fresh log", 200 );
+
+	size_t log_size_200 = file_size( LOG_PATH );
+	size_t index_size_200 = file_size( INDEX_PATH );
+
+	append_lines( 200, 100 );
+	check_lines( "reopened log", 300 );
+
+	// a torn record: lose the last line and keep going
+	truncate_to( LOG_PATH, file_size( LOG_PATH ) - 3 );
+	check_lines( "torn record", 299 );
+	append_lines( 299, 1 );
+	check_lines( "appending after a torn record", 300 );
+
+	// the index has an entry for line 256 but the log stops at 200
+	truncate_to( LOG_PATH, log_size_200 );
+	check_lines( "index ahead of the log", 200 );
+	append_lines( 200, 100 );
+	check_lines( "appending after the index was ahead", 300 );
+
+	// the log has lines 256 and up but the index stops at 192
+	truncate_to( INDEX_PATH, index_size_200 );
+	check_lines( "index behind the log", 300 );
+	append_lines( 300, 100 );
+	check_lines( "appending after the index was behind", 400 );
+
+	// both at once, with the index cut off halfway through an entry
+	truncate_to( INDEX_PATH, index_size_200 - 3 );
+	truncate_to( LOG_PATH, file_size( LOG_PATH ) - 1 );
+	check_lines( "torn index and log", 399 );
+
+	remove_files();
+	return 0;
+}
@@ -0,0 +1,252 @@
+#include <chrono>
+#include <thread>
+
+#include "common.h"
+#include "spsc.h"
+#include "wakeup.h"
+
+/*
+ * hammers both ring types from two threads with random batch sizes and
+ * rings small enough that the threads keep running into each other. both
+ * sides only ever block on their Wakeup and follow the same protocol as
+ * net_thread.cc, so a lost wakeup stalls the test and trips the timeout
+ */
+
+static constexpr u64 NUM_MESSAGES = 2000000;
+static constexpr u64 NUM_BYTES = u64( 256 ) * 1024 * 1024;
+static constexpr size_t MAX_MESSAGE_SIZE = 300;
+static constexpr size_t MAX_CHUNK_SIZE = 3000;
+static constexpr int STALL_TIMEOUT_MS = 5000;
+
+static SPSCRing messages( 4096 );
+static SPSCByteRing bytes( 4096 );
+
+static Wakeup producer_wakeup;
+static Wakeup consumer_wakeup;
+
+struct RNG {
+	u64 state;
+};
+
+static u32 rng_next( RNG * rng ) {
+	rng->state ^= rng->state << 13;
+	rng->state ^= rng->state >> 7;
+	rng->state ^= rng->state << 17;
+	return u32( rng->state >> 32 );
+}
+
+// inclusive
+static u32 rng_range( RNG * rng, u32 lo, u32 hi ) {
+	return lo + rng_next( rng ) % ( hi - lo + 1 );
+}
+
+// widens the windows between a pop and its release, or a push and its
+// commit, which is where lost wakeups hide
+static void maybe_yield( RNG * rng ) {
+	if( rng_next( rng ) % 4 == 0 )
+		std::this_thread::yield();
+}
+
+static void wait_for( Wakeup * w, const char * who ) {
+	auto start = std::chrono::steady_clock::now();
+	wakeup_wait( w, STALL_TIMEOUT_MS );
+	if( std::chrono::steady_clock::now() - start >= std::chrono::milliseconds( STALL_TIMEOUT_MS ) )
+		FATAL( "the %s never got woken up\n", who );
+	wakeup_drain( w );
+}
+
+static size_t message_size( u64 seq ) {
+	return sizeof( seq ) + ( seq * 2654435761u ) % ( MAX_MESSAGE_SIZE - sizeof( seq ) + 1 );
+}
+
+static u8 message_byte( u64 seq, size_t i ) {
+	return u8( seq + i * 7 );
+}
+
+static u8 stream_byte( u64 i ) {
+	return u8( ( i ^ ( i >> 8 ) ^ ( i >> 16 ) ) * 31 );
+}
+
+static void produce_messages() {
+	RNG rng = { 0x9e3779b97f4a7c15 };
+	u64 seq = 0;
+
+	while( seq < NUM_MESSAGES ) {
+		u32 batch = rng_range( &rng, 1, 64 );
+
+		for( u32 i = 0; i < batch && seq < NUM_MESSAGES; ) {
+			size_t n = message_size( seq );
+			u8 * p = ( u8 * ) messages.reserve( n );
+
+			if( p == NULL ) {
+				// publish what we have so the consumer can make room
+				if( messages.commit() )
+					wakeup_signal( &consumer_wakeup );
+				wait_for( &producer_wakeup, "message producer" );
+				continue;
+			}
+
+			memcpy( p, &seq, sizeof( seq ) );
+			for( size_t j = sizeof( seq ); j < n; j++ )
+				p[ j ] = message_byte( seq, j );
+			seq++;
+			i++;
+		}
+
+		maybe_yield( &rng );
+		if( messages.commit() )
+			wakeup_signal( &consumer_wakeup );
+	}
+}
+
+static void consume_messages() {
+	RNG rng = { 0xd1b54a32d192ed03 };
+	u64 expected = 0;
+
+	while( expected < NUM_MESSAGES ) {
+		u32 batch = rng_range( &rng, 1, 64 );
+
+		Span< const u8 > msg;
+		for( u32 i = 0; i < batch && messages.pop( &msg ); i++ ) {
+			u64 seq;
+			if( msg.n < sizeof( seq ) )
+				FATAL( "message %llu is too short\n", ( unsigned long long ) expected );
+			memcpy( &seq, msg.ptr, sizeof( seq ) );
+
+			if( seq != expected || msg.n != message_size( seq ) )
+				FATAL( "expected message %llu, got %llu\n", ( unsigned long long ) expected, ( unsigned long long ) seq );
+
+			for( size_t j = sizeof( seq ); j < msg.n; j++ ) {
+				if( msg.ptr[ j ] != message_byte( seq, j ) )
+					FATAL( "message %llu is corrupt\n", ( unsigned long long ) seq );
+			}
+
+			expected++;
+		}
+
+		maybe_yield( &rng );
+		if( messages.release() )
+			wakeup_signal( &producer_wakeup );
+
+		// the producer may have committed between our last pop and the
+		// release, in which case it didn't wake us up
+		if( expected < NUM_MESSAGES && messages.empty() )
+			wait_for( &consumer_wakeup, "message consumer" );
+	}
+}
+
+static void produce_bytes() {
+	RNG rng = { 0x2545f4914f6cdd1d };
+	u8 chunk[ MAX_CHUNK_SIZE ];
+	u64 written = 0;
+
+	while( written < NUM_BYTES ) {
+		u32 batch = rng_range( &rng, 1, 8 );
+
+		for( u32 i = 0; i < batch && written < NUM_BYTES; i++ ) {
+			size_t n = size_t( min( u64( rng_range( &rng, 1, MAX_CHUNK_SIZE ) ), NUM_BYTES - written ) );
+			bool ok;
+
+			// alternate between copying writes and writing in place
+			if( rng_next( &rng ) & 1 ) {
+				for( size_t j = 0; j < n; j++ )
+					chunk[ j ] = stream_byte( written + j );
+				ok = bytes.write( chunk, n );
+			}
+			else {
+				Span< u8 > dst = bytes.reserve();
+				n = min( n, dst.n );
+				for( size_t j = 0; j < n; j++ )
+					dst.ptr[ j ] = stream_byte( written + j );
+				bytes.advance( n );
+				ok = n > 0;
+			}
+
+			if( !ok ) {
+				if( bytes.commit() )
+					wakeup_signal( &consumer_wakeup );
+				wait_for( &producer_wakeup, "byte producer" );
+				continue;
+			}
+
+			written += n;
+		}
+
+		maybe_yield( &rng );
+		if( bytes.commit() )
+			wakeup_signal( &consumer_wakeup );
+	}
+}
+
+static void consume_bytes() {
+	RNG rng = { 0xbf58476d1ce4e5b9 };
+	u8 chunk[ MAX_CHUNK_SIZE ];
+	u64 read = 0;
+
+	while( read < NUM_BYTES ) {
+		u32 batch = rng_range( &rng, 1, 8 );
+
+		for( u32 i = 0; i < batch; i++ ) {
+			size_t want = rng_range( &rng, 1, MAX_CHUNK_SIZE );
+			size_t n;
+
+			if( rng_next( &rng ) & 1 ) {
+				n = bytes.read( chunk, want );
+				for( size_t j = 0; j < n; j++ ) {
+					if( chunk[ j ] != stream_byte( read + j ) )
+						FATAL( "byte %llu is corrupt\n", ( unsigned long long ) ( read + j ) );
+				}
+			}
+			else {
+				Span< const u8 > src = bytes.peek();
+				n = min( want, src.n );
+				for( size_t j = 0; j < n; j++ ) {
+					if( src.ptr[ j ] != stream_byte( read + j ) )
+						FATAL( "byte %llu is corrupt\n", ( unsigned long long ) ( read + j ) );
+				}
+				bytes.consume( n );
+			}
+
+			read += n;
+			if( n == 0 )
+				break;
+		}
+
+		maybe_yield( &rng );
+		if( bytes.release() )
+			wakeup_signal( &producer_wakeup );
+
+		if( read < NUM_BYTES && bytes.empty() )
+			wait_for( &consumer_wakeup, "byte consumer" );
+	}
+
+	if( read != NUM_BYTES )
+		FATAL( "read %llu bytes, expected %llu\n", ( unsigned long long ) read, ( unsigned long long ) NUM_BYTES );
+}
+
+template< typename F1, typename F2 >
+static void run( const char * name, F1 producer, F2 consumer ) {
+	wakeup_init( &producer_wakeup );
+	wakeup_init( &consumer_wakeup );
+
+	auto start = std::chrono::steady_clock::now();
+
+	std::thread thread( producer );
+	consumer();
+	thread.join();
+
+	std::chrono::duration< double, std::milli > dt = std::chrono::steady_clock::now() - start;
+	printf( "%s: ok (%.0fms)\n", name, dt.count() );
+
+	wakeup_term( &producer_wakeup );
+	wakeup_term( &consumer_wakeup );
+}
+
+int main() {
+	// FATAL aborts without flushing
+	setvbuf( stdout, NULL, _IONBF, 0 );
+
+	run( "SPSCRing", produce_messages, consume_messages );
+	run( "SPSCByteRing", produce_bytes, consume_bytes );
+	return 0;
+}